@@ -0,0 +1,169 @@
+#include "BufferPool.h"
+
+using namespace std;
+
+thread_local BufferPool::ThreadCache BufferPool::cache;
+
+BufferPool::BufferPool(): central_bytes(0), heap_allocs(0), heap_frees(0), thread_hits(0), central_hits(0), oversize(0), in_use(0) {}
+
+BufferPool::~BufferPool() {
+    for(int i=0; i<POOL_CLASSES; i++) {
+        for(auto buf: central[i]) {
+            delete[] buf;
+        }
+        central[i].clear();
+    }
+}
+
+BufferPool::ThreadCache::~ThreadCache() {
+    BufferPool& pool = BufferPool::getInstance();
+
+    for(int i=0; i<POOL_CLASSES; i++) {
+        for(auto buf: free[i]) {
+            pool.releaseCentral(buf, i);
+        }
+        free[i].clear();
+    }
+
+    bytes = 0;
+}
+
+int BufferPool::sizeClass(const size_t n) {
+    int cls = 0;
+
+    while(cls < POOL_CLASSES && classSize(cls) < n) {
+        cls++;
+    }
+
+    return (cls < POOL_CLASSES) ? cls : -1;
+}
+
+size_t BufferPool::classSize(const int cls) {
+    return ((size_t) 1) << (POOL_MIN_CLASS_SHIFT + cls);
+}
+
+uint8_t* BufferPool::acquire(const size_t n, int& cls) {
+    in_use.fetch_add(1, memory_order_relaxed);
+    cls = sizeClass(n);
+
+    if(cls < 0) {
+        oversize.fetch_add(1, memory_order_relaxed);
+        return new uint8_t[n];
+    }
+
+    auto& local = cache.free[cls];
+    if(!local.empty()) {
+        uint8_t* buf = local.back();
+        local.pop_back();
+        cache.bytes -= classSize(cls);
+        thread_hits.fetch_add(1, memory_order_relaxed);
+        return buf;
+    }
+
+    {
+        lock_guard<mutex> l(central_mutex[cls]);
+        if(!central[cls].empty()) {
+            uint8_t* buf = central[cls].back();
+            central[cls].pop_back();
+            central_bytes.fetch_sub(classSize(cls), memory_order_relaxed);
+            central_hits.fetch_add(1, memory_order_relaxed);
+            return buf;
+        }
+    }
+
+    heap_allocs.fetch_add(1, memory_order_relaxed);
+    return new uint8_t[classSize(cls)];
+}
+
+void BufferPool::release(uint8_t* buf, const int cls) {
+    in_use.fetch_sub(1, memory_order_relaxed);
+
+    if(cls < 0) {
+        delete[] buf;
+        return;
+    }
+
+    if(cache.bytes + classSize(cls) <= POOL_THREAD_CACHE_BYTES) {
+        cache.free[cls].push_back(buf);
+        cache.bytes += classSize(cls);
+        return;
+    }
+
+    releaseCentral(buf, cls);
+}
+
+void BufferPool::releaseCentral(uint8_t* buf, const int cls) {
+    if(central_bytes.load(memory_order_relaxed) + classSize(cls) <= POOL_CENTRAL_BYTES) {
+        lock_guard<mutex> l(central_mutex[cls]);
+        central[cls].push_back(buf);
+        central_bytes.fetch_add(classSize(cls), memory_order_relaxed);
+        return;
+    }
+
+    heap_frees.fetch_add(1, memory_order_relaxed);
+    delete[] buf;
+}
+
+void BufferPool::getStats(pool_stats& stats) {
+    stats.heap_allocs = heap_allocs.load(memory_order_relaxed);
+    stats.heap_frees = heap_frees.load(memory_order_relaxed);
+    stats.thread_hits = thread_hits.load(memory_order_relaxed);
+    stats.central_hits = central_hits.load(memory_order_relaxed);
+    stats.oversize = oversize.load(memory_order_relaxed);
+    stats.in_use = (uint64_t) max(in_use.load(memory_order_relaxed), (int64_t) 0);
+    stats.cached_bytes = central_bytes.load(memory_order_relaxed);
+}
+
+///---------------------PooledBuffer---------------------
+
+PooledBuffer::PooledBuffer(const size_t n) {
+    reset(n);
+}
+
+PooledBuffer::PooledBuffer(PooledBuffer&& other): buf(other.buf), len(other.len), cls(other.cls) {
+    other.buf = nullptr;
+    other.len = 0;
+    other.cls = -1;
+}
+
+PooledBuffer& PooledBuffer::operator=(PooledBuffer&& other) {
+    if(this != &other) {
+        clear();
+        buf = other.buf;
+        len = other.len;
+        cls = other.cls;
+        other.buf = nullptr;
+        other.len = 0;
+        other.cls = -1;
+    }
+
+    return *this;
+}
+
+PooledBuffer::~PooledBuffer() {
+    clear();
+}
+
+void PooledBuffer::reset(const size_t n) {
+    if(buf != nullptr && cls >= 0 && BufferPool::classSize(cls) >= n) {
+        len = n;
+        return;
+    }
+
+    clear();
+
+    if(n > 0) {
+        buf = BufferPool::getInstance().acquire(n, cls);
+        len = n;
+    }
+}
+
+void PooledBuffer::clear() {
+    if(buf != nullptr) {
+        BufferPool::getInstance().release(buf, cls);
+    }
+
+    buf = nullptr;
+    len = 0;
+    cls = -1;
+}
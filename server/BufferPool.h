@@ -0,0 +1,102 @@
+#ifndef SERVER_BUFFERPOOL_H
+#define SERVER_BUFFERPOOL_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+// size classes are powers of two from 64 B to 2 MB, bigger buffers come straight from the heap
+#define POOL_MIN_CLASS_SHIFT 6
+#define POOL_CLASSES 16
+
+// buffers kept by one thread before they go back to the shared lists
+#define POOL_THREAD_CACHE_BYTES 8*1024*1024
+// buffers kept in the shared lists before they are freed
+#define POOL_CENTRAL_BYTES 64*1024*1024
+
+struct pool_stats {
+    uint64_t heap_allocs;
+    uint64_t heap_frees;
+    uint64_t thread_hits;
+    uint64_t central_hits;
+    uint64_t oversize;
+    uint64_t in_use;
+    uint64_t cached_bytes;
+};
+
+class PooledBuffer;
+
+// message buffers shared by all connections, a thread reuses its own buffers without locking
+class BufferPool {
+private:
+    struct ThreadCache {
+        std::vector<uint8_t*> free[POOL_CLASSES];
+        size_t bytes = 0;
+        ~ThreadCache();
+    };
+
+    std::vector<uint8_t*> central[POOL_CLASSES];
+    std::mutex central_mutex[POOL_CLASSES];
+    std::atomic<uint64_t> central_bytes;
+
+    std::atomic<uint64_t> heap_allocs;
+    std::atomic<uint64_t> heap_frees;
+    std::atomic<uint64_t> thread_hits;
+    std::atomic<uint64_t> central_hits;
+    std::atomic<uint64_t> oversize;
+    std::atomic<int64_t> in_use;
+
+    static thread_local ThreadCache cache;
+
+    BufferPool();
+
+    uint8_t* acquire(size_t, int&);
+    void release(uint8_t*, int);
+    void releaseCentral(uint8_t*, int);
+
+    friend class PooledBuffer;
+
+public:
+    BufferPool(const BufferPool&) = delete;
+    ~BufferPool();
+
+    static BufferPool& getInstance() {
+        static BufferPool instance;
+        return instance;
+    }
+
+    static int sizeClass(size_t);
+    static size_t classSize(int);
+
+    void getStats(pool_stats&);
+};
+
+// owns a pool buffer of at least size() bytes, gives it back when destroyed
+class PooledBuffer {
+private:
+    uint8_t* buf = nullptr;
+    size_t len = 0;
+    int cls = -1;
+
+public:
+    PooledBuffer() = default;
+    explicit PooledBuffer(size_t);
+    PooledBuffer(PooledBuffer&&);
+    PooledBuffer& operator=(PooledBuffer&&);
+    PooledBuffer(const PooledBuffer&) = delete;
+    PooledBuffer& operator=(const PooledBuffer&) = delete;
+    ~PooledBuffer();
+
+    // keeps the current buffer when it is big enough
+    void reset(size_t);
+    void clear();
+
+    uint8_t* data() { return buf; };
+    const uint8_t* data() const { return buf; };
+    size_t size() const { return len; };
+    bool empty() const { return len == 0; };
+};
+
+#endif //SERVER_BUFFERPOOL_H
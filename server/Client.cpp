@@ -1,4 +1,13 @@
 #include "Client.h"
+#include "TlsContext.h"
+
+#include <fcntl.h>
+#include <sys/sendfile.h>
+#include <linux/tls.h>
+
+#ifndef SOL_TLS
+#define SOL_TLS 282
+#endif
 
 using namespace std;
 using namespace StorageCloud;
@@ -10,6 +19,34 @@ Client::Client(int sock, connection* conn, bool* s_e, Logger* logg) {
     logger = logg;
     id = conn->addr;
     id += ":" + to_string(conn->port);
+
+    if(config.io_uring) {
+        io = new IoEngine(OUT_FILE_CHUNK_SIZE);
+        if(!io->isValid()) {
+            logger->warn(id, "io_uring not available, using regular I/O");
+            delete io;
+            io = nullptr;
+        }
+        u.setIoEngine(io);
+    }
+}
+
+Client::~Client() {
+    // waits for read-ahead still in flight before its buffers are freed, descriptors are closed by the user afterwards
+    u.setIoEngine(nullptr);
+    delete io;
+
+    closeSplicePipe();
+
+    for(auto& chunk: out_queue) {
+        if(chunk.fd != -1) {
+            close(chunk.fd);
+        }
+    }
+
+    if(epfd != -1) {
+        close(epfd);
+    }
 }
 
 HashAlgorithm Client::getHashAlgorithm() {
@@ -24,284 +61,1264 @@ void Client::setEncryptionAlgorithm(EncryptionAlgorithm newAlgorithm) {
     this_connection->encryption = newAlgorithm;
 }
 
-bool Client::getNBytes(const int n, uint8_t buf[], bool& exitReason) {
-    struct epoll_event ev, events[1];
-    int epfd = epoll_create1(0), nfds;
-    ev.events = EPOLLIN;
+bool Client::waitForSocket(uint32_t events) {
+    struct epoll_event ev, ready[1];
+    ev.events = events;
     ev.data.fd = socket;
 
-    if (epoll_ctl(epfd, EPOLL_CTL_ADD, socket, &ev) == -1) {
-        perror("epoll_ctl: listen_sock");
-        exitReason = R_ERROR;
-        return false;
+    if(epfd == -1) {
+        epfd = epoll_create1(EPOLL_CLOEXEC);
+        if(epfd == -1 || epoll_ctl(epfd, EPOLL_CTL_ADD, socket, &ev) == -1) {
+            logger->err(id, "error while creating socket readiness handle", errno);
+            return false;
+        }
+        epoll_events = events;
+    } else if(epoll_events != events) {
+        if(epoll_ctl(epfd, EPOLL_CTL_MOD, socket, &ev) == -1) {
+            logger->err(id, "error while changing socket readiness events", errno);
+            return false;
+        }
+        epoll_events = events;
     }
 
-    int received = 0;
-    int last_received = 0;
+    while(!(*should_exit)) {
+        int nfds = epoll_wait(epfd, ready, 1, 1000);
 
-    while (received != n && !(*should_exit)) {
-        nfds = epoll_wait(epfd, events, 1, 1000);
+        if(nfds > 0) {
+            return true;
+        }
 
-        if (nfds == -1) {
-            break;
+        if(nfds == -1 && errno != EINTR) {
+            logger->err(id, "error while waiting for socket", errno);
+            return false;
+        }
+    }
+
+    return false;
+}
+
+ssize_t Client::recvSocket(void* buf, const size_t len, const int flags) {
+    if(!this_connection->tls) {
+        return recv(socket, buf, len, flags);
+    }
+
+    // without room for the record type kTLS fails every record other than application data with EIO
+    uint8_t control[CMSG_SPACE(sizeof(uint8_t))];
+    struct iovec iov = {buf, len};
+    struct msghdr msg;
+    memset(&msg, 0, sizeof(msg));
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1;
+    msg.msg_control = control;
+    msg.msg_controllen = sizeof(control);
+
+    ssize_t received = recvmsg(socket, &msg, flags);
+
+    if(received < 0) {
+        if(errno == EIO) {
+            logger->warn(id, "unreadable TLS record, closing");
+            return 0;
         }
+        return received;
+    }
 
-        if (nfds > 0) {
-            last_received = (int) recv(socket, buf+received, (size_t) (n - received), 0);
-            if (last_received == 0) {
-                logger->info(id, "no new data, closing");
-                exitReason = R_DISCONNECT;
-                break;
+    struct cmsghdr* cmsg = CMSG_FIRSTHDR(&msg);
+
+    if(cmsg == nullptr || cmsg->cmsg_level != SOL_TLS || cmsg->cmsg_type != TLS_GET_RECORD_TYPE
+       || *CMSG_DATA(cmsg) == TLS_RECORD_APPLICATION_DATA) {
+        return received;
+    }
+
+    // control records end the connection like EOF, the kernel can't apply key updates
+    uint8_t type = *CMSG_DATA(cmsg);
+    const uint8_t* record = (const uint8_t*) buf;
+
+    if(type == TLS_RECORD_ALERT && received >= 2 && record[1] == TLS_ALERT_CLOSE_NOTIFY) {
+        logger->info(id, "TLS connection closed by peer");
+    } else if(type == TLS_RECORD_ALERT && received >= 2) {
+        logger->warn(id, "TLS alert " + to_string(record[1]) + ", closing");
+    } else {
+        logger->warn(id, "unsupported TLS record type " + to_string(type) + ", closing");
+    }
+
+    return 0;
+}
+
+bool Client::fillBuffer(const size_t n, bool& exitReason) {
+    exitReason = R_ERROR;
+
+    if(in_buf.size() < n || in_buf.size() < IN_BUF_MIN_SIZE) {
+        in_buf.resize(max(n, (size_t) IN_BUF_MIN_SIZE));
+    }
+
+    while(in_len < n) {
+        ssize_t received;
+
+        if(io != nullptr) {
+            // read-ahead queued for a download is submitted together with the receive
+            received = io->recv(socket, in_buf.data() + in_len, in_buf.size() - in_len, 1000);
+
+            if(received < 0 && errno == EIO && this_connection->tls) {
+                // TLS control record, read again so its type can be checked
+                received = recvSocket(in_buf.data() + in_len, in_buf.size() - in_len, MSG_DONTWAIT);
             }
 
-            if (last_received < 0) {
+            if(received < 0 && (errno == EWOULDBLOCK || errno == EAGAIN)) {
+                if(*should_exit) {
+                    return false;
+                }
+                continue;
+            }
+        } else {
+            received = recvSocket(in_buf.data() + in_len, in_buf.size() - in_len, MSG_DONTWAIT);
+        }
+
+        if(received == 0) {
+            logger->info(id, "no new data, closing");
+            exitReason = R_DISCONNECT;
+            return false;
+        }
+
+        if(received < 0) {
+            if(errno == EINTR) {
+                continue;
+            }
+
+            if(errno != EWOULDBLOCK && errno != EAGAIN) {
                 logger->err(id, "error while reading from socket", errno);
-                exitReason = R_ERROR;
-                break;
+                return false;
+            }
+
+            if(!waitForSocket(EPOLLIN)) {
+                return false;
             }
 
-            received += last_received;
+            continue;
         }
-    }
 
-    close(epfd);
+        in_len += received;
+    }
 
-    return (received == n);
+    return true;
 }
 
-bool Client::sendNBytes(const int n, uint8_t buf[]) {
-    struct epoll_event ev, events[1];
-    int epfd = epoll_create1(0), nfds;
-    ev.events = EPOLLOUT;
-    ev.data.fd = socket;
-
-    if (epoll_ctl(epfd, EPOLL_CTL_ADD, socket, &ev) == -1) {
-        perror("epoll_ctl: listen_sock");
-        return false;
+void Client::consumeBuffer(const size_t n) {
+    if(n < in_len) {
+        memmove(in_buf.data(), in_buf.data() + n, in_len - n);
     }
+    in_len -= n;
+}
 
+bool Client::sendNBytes(const int n, uint8_t buf[], const int flags) {
+    TRACE_SPAN(TRACE_NET, "send");
     int sent = 0;
-    int last_sent = 0;
 
     while (sent != n && !(*should_exit)) {
-        nfds = epoll_wait(epfd, events, 1, 1000);
+        int last_sent;
+
+        // bytes queued earlier go first
+        if(queue_output && !out_queue.empty()) {
+            queueBytes(buf+sent, (size_t) (n - sent));
+            return true;
+        }
+
+        if(io != nullptr && !queue_output) {
+            last_sent = (int) io->send(socket, buf+sent, (size_t) (n - sent));
+        } else {
+            last_sent = (int) send(socket, buf+sent, (size_t) (n - sent), MSG_DONTWAIT | MSG_NOSIGNAL | flags);
+        }
+
+        if (last_sent < 0) {
+            if(errno == EINTR) {
+                continue;
+            }
+
+            if((errno == EWOULDBLOCK || errno == EAGAIN) && queue_output) {
+                queueBytes(buf+sent, (size_t) (n - sent));
+                return true;
+            }
+
+            if((errno == EWOULDBLOCK || errno == EAGAIN) && waitForSocket(EPOLLOUT)) {
+                continue;
+            }
 
-        if (nfds == -1) {
+            logger->err(id, "error while writing to socket", errno);
+            broken = true;
             break;
         }
 
-        if (nfds > 0) {
-            last_sent = (int) send(socket, buf+sent, (size_t) (n - sent), MSG_DONTWAIT);
-            if (last_sent == 0) {
-                if(errno != EWOULDBLOCK || errno != EAGAIN) {
-                    logger->warn(id, "sent 0 bytes");
-                    break;
+        sent += last_sent;
+    }
+
+    return (sent == n);
+}
+
+bool Client::sendFileRange(int fd, uint64_t offset, const uint64_t len) {
+    TRACE_SPAN(TRACE_NET, "sendfile");
+    const uint64_t end = offset + len;
+
+    while (offset < end && !(*should_exit)) {
+        if(queue_output && !out_queue.empty()) {
+            return queueFileRange(fd, offset, end);
+        }
+
+        off_t pos = (off_t) offset;
+        ssize_t last_sent = sendfile(socket, fd, &pos, (size_t) (end - offset));
+
+        if (last_sent == 0) {
+            // file got shorter than its metadata says, errno is not set in this case
+            logger->err(id, "unexpected EOF while sending file at offset " + to_string(offset));
+            broken = true;
+            return false;
+        }
+
+        if (last_sent < 0) {
+            if(errno == EINTR) {
+                continue;
+            }
+
+            if((errno == EWOULDBLOCK || errno == EAGAIN) && queue_output) {
+                return queueFileRange(fd, offset, end);
+            }
+
+            if((errno == EWOULDBLOCK || errno == EAGAIN) && waitForSocket(EPOLLOUT)) {
+                continue;
+            }
+
+            logger->err(id, "error while sending file to socket", errno);
+            broken = true;
+            return false;
+        }
+
+        offset = (uint64_t) pos;
+    }
+
+    return (offset == end);
+}
+
+void Client::queueBytes(const uint8_t* buf, const size_t len) {
+    out_queue.emplace_back();
+    out_queue.back().data.assign(buf, buf + len);
+}
+
+bool Client::queueFileRange(int fd, const uint64_t offset, const uint64_t end) {
+    // the transfer may close its descriptor before the range is sent
+    int copy = fcntl(fd, F_DUPFD_CLOEXEC, 0);
+
+    if(copy == -1) {
+        logger->err(id, "error while queueing file range", errno);
+        broken = true;
+        return false;
+    }
+
+    out_queue.emplace_back();
+    out_queue.back().fd = copy;
+    out_queue.back().offset = offset;
+    out_queue.back().end = end;
+    return true;
+}
+
+bool Client::flushOutput() {
+    TRACE_SPAN(TRACE_NET, "flush");
+
+    while(!out_queue.empty() && !(*should_exit)) {
+        OutChunk& chunk = out_queue.front();
+        ssize_t last_sent;
+
+        if(chunk.fd == -1) {
+            last_sent = send(socket, chunk.data.data() + chunk.sent, chunk.data.size() - chunk.sent, MSG_DONTWAIT | MSG_NOSIGNAL);
+        } else {
+            off_t pos = (off_t) chunk.offset;
+            last_sent = sendfile(socket, chunk.fd, &pos, (size_t) (chunk.end - chunk.offset));
+
+            if(last_sent == 0) {
+                logger->err(id, "unexpected EOF while sending file at offset " + to_string(chunk.offset));
+                broken = true;
+                return false;
+            }
+        }
+
+        if(last_sent < 0) {
+            if(errno == EINTR) {
+                continue;
+            }
+
+            // rest waits for the next EPOLLOUT
+            if(errno == EWOULDBLOCK || errno == EAGAIN) {
+                return true;
+            }
+
+            logger->err(id, "error while writing to socket", errno);
+            broken = true;
+            return false;
+        }
+
+        bool done;
+
+        if(chunk.fd == -1) {
+            chunk.sent += last_sent;
+            done = (chunk.sent == chunk.data.size());
+        } else {
+            chunk.offset += last_sent;
+            done = (chunk.offset == chunk.end);
+        }
+
+        if(done) {
+            if(chunk.fd != -1) {
+                close(chunk.fd);
+            }
+            out_queue.pop_front();
+        }
+    }
+
+    return true;
+}
+
+void Client::closeSplicePipe() {
+    if(splice_pipe[0] != -1) {
+        close(splice_pipe[0]);
+        close(splice_pipe[1]);
+        splice_pipe[0] = splice_pipe[1] = -1;
+    }
+}
+
+bool Client::spliceToFile(int fd, uint64_t offset, const uint64_t len, uint64_t& consumed) {
+    TRACE_SPAN(TRACE_NET, "splice");
+    consumed = 0;
+
+    if(splice_pipe[0] == -1) {
+        if(pipe2(splice_pipe, O_CLOEXEC) == -1) {
+            logger->err(id, "error while creating splice pipe", errno);
+            splice_pipe[0] = splice_pipe[1] = -1;
+            return false;
+        }
+
+        // kernel default is kept when the pipe can't be enlarged
+        fcntl(splice_pipe[1], F_SETPIPE_SZ, SPLICE_PIPE_SIZE);
+        int size = fcntl(splice_pipe[1], F_GETPIPE_SZ);
+        splice_pipe_size = (size > 0) ? (size_t) size : 65536;
+    }
+
+    while(consumed < len) {
+        if(!waitForSocket(EPOLLIN)) {
+            broken = true;
+            return false;
+        }
+
+        ssize_t in = splice(socket, nullptr, splice_pipe[1], nullptr, min((size_t) (len - consumed), splice_pipe_size), SPLICE_F_MOVE | SPLICE_F_NONBLOCK);
+
+        if(in == 0) {
+            logger->info(id, "no new data, closing");
+            broken = true;
+            return false;
+        }
+
+        if(in < 0) {
+            if(errno == EINTR || errno == EAGAIN || errno == EWOULDBLOCK) {
+                continue;
+            }
+
+            // kTLS doesn't splice control records, peeking tells a TLS close from an error
+            uint8_t byte;
+            if(this_connection->tls && (errno == EINVAL || errno == EIO) && recvSocket(&byte, 1, MSG_PEEK | MSG_DONTWAIT) == 0) {
+                broken = true;
+                return false;
+            }
+
+            logger->err(id, "error while reading from socket", errno);
+            broken = true;
+            return false;
+        }
+
+        consumed += in;
+
+        // the pipe is emptied after every read, so it never holds more than it was asked for
+        while(in > 0) {
+            loff_t pos = (loff_t) offset;
+            ssize_t out = splice(splice_pipe[0], nullptr, fd, &pos, (size_t) in, SPLICE_F_MOVE);
+
+            if(out <= 0) {
+                if(out < 0 && errno == EINTR) {
+                    continue;
                 }
+                logger->err(id, "error while writing to file", errno);
+                // drops bytes left in the pipe
+                closeSplicePipe();
+                return false;
             }
 
-            if (last_sent < 0) {
-                logger->err(id, "error while writing to socket", errno);
-                break;
+            offset += out;
+            in -= out;
+        }
+    }
+
+    return true;
+}
+
+bool Client::discardBytes(uint64_t n) {
+    // kTLS can't truncate, there bytes are read into a scratch buffer
+    uint8_t scratch[TLS_DISCARD_SIZE];
+
+    while(n > 0) {
+        ssize_t dropped;
+
+        if(this_connection->tls) {
+            dropped = recvSocket(scratch, (size_t) min(n, (uint64_t) sizeof(scratch)), MSG_DONTWAIT);
+        } else {
+            dropped = recv(socket, nullptr, (size_t) min(n, (uint64_t) SPLICE_PIPE_SIZE), MSG_TRUNC | MSG_DONTWAIT);
+        }
+
+        if(dropped == 0) {
+            return false;
+        }
+
+        if(dropped < 0) {
+            if(errno == EINTR) {
+                continue;
+            }
+            if((errno == EWOULDBLOCK || errno == EAGAIN) && waitForSocket(EPOLLIN)) {
+                continue;
+            }
+            return false;
+        }
+
+        n -= dropped;
+    }
+
+    return true;
+}
+
+static bool pwriteAll(int fd, const uint8_t* data, uint64_t len, uint64_t offset) {
+    while(len > 0) {
+        ssize_t written = pwrite(fd, data, (size_t) len, (off_t) offset);
+
+        if(written < 0 && errno == EINTR) {
+            continue;
+        }
+
+        if(written <= 0) {
+            return false;
+        }
+
+        data += written;
+        len -= written;
+        offset += written;
+    }
+
+    return true;
+}
+
+void Client::receiveFileChunk(const raw_frame_header& header, const uint8_t* data, const uint64_t buffered) {
+    ServerResponse res;
+    const uint64_t len = header.length - RAW_HEADER_SIZE;
+    uint64_t received = buffered;
+    int fd;
+
+    if(!(u.isValid() && u.isAuthorized())) {
+        resError(res, "You are not logged in", "tried to put data, but was not logged in");
+    } else if(!rawDataEnabled() || header.type != RAW_USR_DATA || len == 0) {
+        resError(res, "Wrong command format", "tried to put data, but raw frame was not expected");
+    } else if(uploadFailed(header.stream) || !u.beginFileChunk(header.offset, len, fd, header.stream)) {
+        resError(res, "Error occured", "tried to put data, but error occured");
+    } else {
+        // bytes already read are written from the buffer, the rest goes from socket to file in kernel
+        bool written = pwriteAll(fd, data, buffered, header.offset);
+
+        if(written && buffered < len) {
+            uint64_t consumed;
+            written = spliceToFile(fd, header.offset + buffered, len - buffered, consumed);
+            received += consumed;
+        }
+
+        if(written && u.commitFileChunk(len, header.stream)) {
+            if(u.getCurrentInFileMetadata(header.stream).isValid) {
+                LOG_DEBUG(logger, id, "user " + username + ": adding file accomplished");
             }
+            res.set_type(ResponseType::OK);
+        } else {
+            resError(res, "Error occured", "tried to put data, but error occured");
+        }
+    }
+
+    // rest of the payload is dropped so the next frame starts where it should
+    if(!broken && received < len && !discardBytes(len - received)) {
+        broken = true;
+    }
+
+    if(!broken && uploadResponse(res, len, header.stream)) {
+        addStreamParam(res, header.stream);
+        sendServerResponse(&res);
+    }
+}
 
-            sent += last_sent;
+uint32_t Client::streamOf(const Command* cmd) {
+    for(auto& param: cmd->params()) {
+        if(param.paramid() == "stream_id") {
+            return (uint32_t) param.iparamval();
         }
     }
 
-    close(epfd);
+    return frame_stream;
+}
 
-    return (sent == n);
+void Client::addStreamParam(ServerResponse& res, const uint32_t stream) {
+    if(stream != 0) {
+        Param* tmp = res.add_params();
+        tmp->set_paramid("stream_id");
+        tmp->set_iparamval(stream);
+    }
+}
+
+void Client::addWindowParam(ServerResponse& res, const uint32_t stream) {
+    auto st = uploads.find(stream);
+
+    if(st != uploads.end() && st->second.window > 0) {
+        Param* tmp = res.add_params();
+        tmp->set_paramid("window");
+        tmp->set_iparamval(st->second.window);
+    }
+}
+
+bool Client::uploadFailed(const uint32_t stream) {
+    auto st = uploads.find(stream);
+    return st != uploads.end() && st->second.failed;
+}
+
+bool Client::uploadResponse(ServerResponse& res, const uint64_t len, const uint32_t stream) {
+    auto st = uploads.find(stream);
+
+    if(st == uploads.end() || st->second.window == 0) {
+        return true;
+    }
+
+    // chunks already in flight after an error are dropped quietly until the next METADATA
+    if(st->second.failed) {
+        return false;
+    }
+
+    const UFile& file = u.getCurrentInFileMetadata(stream);
+
+    if(res.type() != ResponseType::OK) {
+        st->second.failed = true;
+    } else {
+        st->second.unacked += len;
+
+        // cumulative ack every half window, so the client never runs out of credit
+        if(st->second.unacked * 2 < st->second.window && file.lastValid != file.size) {
+            return false;
+        }
+
+        st->second.unacked = 0;
+        addWindowParam(res, stream);
+    }
+
+    Param* tmp = res.add_params();
+    tmp->set_paramid("acked");
+    tmp->set_iparamval(file.lastValid);
+
+    if(file.lastValid == file.size) {
+        uploads.erase(st);
+    }
+
+    return true;
+}
+
+bool Client::rawDataEnabled() {
+    // raw frames carry no hash, they are used only when payload would not be encrypted anyway
+    return this_connection->raw_frames && getEncryptionAlgorithm() == EncryptionAlgorithm::NOENCRYPTION;
+}
+
+bool Client::sendFileChunk(ServerResponse& res, const uint32_t stream) {
+    int fd;
+    raw_frame_header header;
+    uint64_t len;
+
+    if(!u.getFileChunkRange(fd, header.offset, len, stream)) {
+        resError(res, "Error occured", "tried to download file, but error occured");
+        addStreamParam(res, stream);
+        sendServerResponse(&res);
+        return false;
+    }
+
+    uint8_t buf[RAW_HEADER_SIZE];
+    header.length = (uint32_t) (RAW_HEADER_SIZE + len);
+    header.type = RAW_SRV_DATA;
+    header.flags = u.isCurrentOutFileValid(stream) ? 0 : RAW_FLAG_LAST;
+    header.stream = stream;
+    writeRawHeader(buf, header);
+
+    LOG_DEBUG(logger, id, "sending raw chunk " + to_string(header.offset) + "+" + to_string(len));
+
+    return sendNBytes(RAW_HEADER_SIZE, buf, MSG_MORE) && sendFileRange(fd, header.offset, len);
+}
+
+bool Client::sendDownloadChunk(const uint32_t stream) {
+    ServerResponse res;
+
+    if(rawDataEnabled()) {
+        return sendFileChunk(res, stream);
+    }
+
+    string data;
+    if(u.getFileChunk(data, stream)) {
+        res.set_type(ResponseType::SRV_DATA);
+        res.set_data(std::move(data));
+    } else {
+        resError(res, "Error occured", "tried to download file, but error occured");
+    }
+
+    addStreamParam(res, stream);
+    return sendServerResponse(&res) && res.type() == ResponseType::SRV_DATA;
+}
+
+bool Client::startDownload(const uint32_t stream, const uint64_t pos, const uint64_t window) {
+    downloads.erase(stream);
+
+    if(window == 0) {
+        return sendDownloadChunk(stream);
+    }
+
+    DownloadWindow& st = downloads[stream];
+    st.window = min(window, (uint64_t) DOWNLOAD_MAX_WINDOW);
+    st.limit = pos + st.window;
+
+    return pushDownload(stream);
+}
+
+bool Client::pushDownload(const uint32_t stream) {
+    auto st = downloads.find(stream);
+
+    if(st == downloads.end()) {
+        return false;
+    }
+
+    // one slice per call, the rest of the window waits until requests already received are handled
+    uint64_t end = min(st->second.limit, u.getCurrentOutFilePos(stream) + DOWNLOAD_SLICE_SIZE);
+
+    // pages of this slice and the next one are fetched while earlier chunks are being sent
+    u.readAheadOutFile(min(st->second.limit, end + DOWNLOAD_SLICE_SIZE), stream);
+
+    bool sent = true;
+
+    // the rest of the slice waits once the socket is full
+    while(!broken && !hasPendingOutput() && u.isCurrentOutFileValid(stream) && u.getCurrentOutFilePos(stream) < end) {
+        if(!sendDownloadChunk(stream)) {
+            sent = false;
+            break;
+        }
+    }
+
+    if(!sent || !u.isCurrentOutFileValid(stream)) {
+        downloads.erase(st);
+    }
+
+    return sent;
+}
+
+bool Client::hasPendingDownloads() {
+    for(auto& st: downloads) {
+        if(u.isCurrentOutFileValid(st.first) && u.getCurrentOutFilePos(st.first) < st.second.limit) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void Client::pushDownloads() {
+    vector<uint32_t> streams;
+
+    for(auto& st: downloads) {
+        if(u.isCurrentOutFileValid(st.first) && u.getCurrentOutFilePos(st.first) < st.second.limit) {
+            streams.push_back(st.first);
+        }
+    }
+
+    // streams take turns, each gets one slice
+    for(auto stream: streams) {
+        if(broken) {
+            break;
+        }
+        pushDownload(stream);
+    }
 }
 
 bool Client::processMessage(uint8_t buf[], int len) {
     MessageType msg_type;
 
-    uint8_t* parsed_msg = nullptr;
-    uint32_t parsed_len;
+    const uint8_t* parsed_msg = nullptr;
+    uint32_t parsed_len = 0;
 
-    bool parsed = parseMessage(buf, len, &msg_type, &parsed_msg, &parsed_len);
+    bool parsed = parseMessage(buf, len, &msg_type, parsed_msg, parsed_len);
 
     if(!parsed || parsed_len == 0) {
         logger->warn(id, "There was an error during message parsing");
         return false;
     }
 
+    return dispatchMessage(msg_type, parsed_msg, parsed_len);
+}
+
+bool Client::processFrameV2(uint8_t buf[], const uint32_t len) {
+    frame_header header;
+
+    if(!parseFrameHeader(buf, header) || header.version != PROTOCOL_V2) {
+        logger->warn(id, "wrong v2 frame header");
+        return false;
+    }
+
+    uint8_t* payload = buf + V2_HEADER_SIZE;
+    uint32_t payload_len = len - V2_HEADER_SIZE;
+
+    // handshakes too, a plaintext one could switch encryption off or replace the keys
+    bool encrypted = (getEncryptionAlgorithm() != EncryptionAlgorithm::NOENCRYPTION);
+
+    if(encrypted != ((header.flags & V2_FLAG_ENCRYPTED) != 0)) {
+        logger->warn(id, "v2 frame encryption does not match connection");
+        if(header.type == MessageType::HANDSHAKE) {
+            broken = true;
+        }
+        return false;
+    }
+
+    if(encrypted && SessionCipher::isAead(getEncryptionAlgorithm())) {
+        // header up to the checksum is authenticated, the tag replaces the checksum
+        if(payload_len < GCM_TAG_SIZE || !cipher.open(payload, payload_len - GCM_TAG_SIZE, buf, V2_HEADER_SIZE - 4)) {
+            logger->warn(id, "message authentication failed");
+            broken = true;
+            return false;
+        }
+        payload_len -= GCM_TAG_SIZE;
+    } else {
+        // decrypted in place, the receive buffer is not needed afterwards
+        if(encrypted && !decrypt(getEncryptionAlgorithm(), {payload, payload_len}, {payload, payload_len})) {
+            return false;
+        }
+
+        if(crc32c(payload, payload_len) != header.checksum) {
+            logger->warn(id, "wrong checksum");
+            return false;
+        }
+    }
+
+    frame_stream = header.stream;
+    bool processed = dispatchMessage((MessageType) header.type, payload, payload_len);
+    frame_stream = 0;
+
+    return processed;
+}
+
+bool Client::processFrame(uint8_t buf[], const uint32_t len) {
+    if(this_connection->protocol == PROTOCOL_V2) {
+        return processFrameV2(buf, len);
+    }
+
+    return processMessage(buf + 4, len - 4);
+}
+
+bool Client::dispatchMessage(const MessageType msg_type, const uint8_t* payload, const uint32_t len) {
+    // messages of one request live in an arena backed by a pooled block, freed at once when it ends
+    PooledBuffer arena_block(REQUEST_ARENA_SIZE);
+    google::protobuf::ArenaOptions arena_options;
+    arena_options.initial_block = (char*) arena_block.data();
+    arena_options.initial_block_size = arena_block.size();
+    google::protobuf::Arena arena(arena_options);
+
     if(msg_type == MessageType::COMMAND) {
-        Command cmd;
-        cmd.ParseFromArray(parsed_msg, parsed_len);
-        if(cmd.type() != CommandType::USR_DATA) {
-            logger->info(id, cmd.DebugString());
+        Command* cmd = google::protobuf::Arena::CreateMessage<Command>(&arena);
+        cmd->ParseFromArray(payload, len);
+        if(cmd->type() != CommandType::USR_DATA) {
+            LOG_INFO(logger, id, cmd->DebugString());
+        }
+
+        response_bytes = 0;
+        response_error = false;
+        RequestTrace trace(config.slow_request_ms != 0);
+        auto start = chrono::steady_clock::now();
+
+        processCommand(cmd);
+
+        uint64_t us = (uint64_t) chrono::duration_cast<chrono::microseconds>(chrono::steady_clock::now() - start).count();
+        Stats::getInstance().record(cmd->type(), us, response_error, len, response_bytes);
+
+        if(trace.isActive() && us >= config.slow_request_ms * 1000ull) {
+            logger->warn(id, "slow request cmd=" + CommandType_Name(cmd->type()) + " user=" + (username.empty() ? "-" : username)
+                             + " " + trace.summary(us));
         }
-        processCommand(&cmd);
     } else if(msg_type == MessageType::HANDSHAKE) {
-        Handshake handshake;
-        handshake.ParseFromArray(parsed_msg, parsed_len);
-        processHandshake(&handshake);
+        Handshake* handshake = google::protobuf::Arena::CreateMessage<Handshake>(&arena);
+        handshake->ParseFromArray(payload, len);
+        processHandshake(handshake);
     } else {
         logger->err(id, "Error: unknown message type! (" + MessageType_Name(msg_type) + ")");
+        return false;
     }
 
-    delete parsed_msg;
+    return true;
 }
 
-bool Client::parseMessage(uint8_t buf[], int len, MessageType* msg_type, uint8_t** parsed_data, uint32_t* parsed_len) {
-    EncodedMessage msg;
-    msg.ParseFromArray(buf, len);
-    logger->log(id, "Parsing message");
-    logger->log(id, "size: " + to_string(msg.datasize()));
-    logger->log(id, "hash: " + printHash(msg.hashalgorithm(), (uint8_t*) msg.hash().c_str()));
-    logger->log(id, "data length: " + to_string(msg.data().length()));
+bool Client::parseMessage(uint8_t buf[], int len, MessageType* msg_type, const uint8_t*& parsed_data, uint32_t& parsed_len) {
+    encoded_view msg;
 
-    if(!msg.data().length() || msg.hash().length() != HASH_SIZE[msg.hashalgorithm()]) {
-        logger->log(id, "wrong data or hash length");
+    if(!parseEncodedMessage(buf, len, msg) || !HashAlgorithm_IsValid(msg.hash_algorithm)) {
+        LOG_DEBUG(logger, id, "malformed message");
         return false;
     }
 
-    *parsed_len = 0; //decrypted data size
+    LOG_DEBUG(logger, id, "Parsing message");
+    LOG_DEBUG(logger, id, "size: " + to_string(msg.data_size));
+    LOG_DEBUG(logger, id, "data length: " + to_string(msg.data_len));
 
-    EncryptionAlgorithm decrypt_alg = getEncryptionAlgorithm();
-    if(msg.type() == MessageType::HANDSHAKE) {
-        decrypt_alg = EncryptionAlgorithm::NOENCRYPTION;
+    if(!msg.data_len || msg.hash_len != HASH_SIZE[msg.hash_algorithm]) {
+        LOG_DEBUG(logger, id, "wrong data or hash length");
+        return false;
     }
 
-    decrypt(decrypt_alg, (uint8_t*) msg.data().c_str(), msg.datasize(), parsed_data, parsed_len);
+    LOG_DEBUG(logger, id, "hash: " + printHash(msg.hash_algorithm, msg.hash));
+
+    // handshakes are decrypted like everything else, plaintext is accepted only until encryption is set
+    EncryptionAlgorithm decrypt_alg = getEncryptionAlgorithm();
+
+    if(SessionCipher::isAead(decrypt_alg)) {
+        // decrypted in place in the receive buffer, message type is authenticated with the payload
+        uint8_t type_byte = (uint8_t) msg.type;
+        uint8_t* data = const_cast<uint8_t*>(msg.data);
 
-    if(msg.datasize() != *parsed_len) {
+        if(msg.data_size + GCM_TAG_SIZE != msg.data_len || !cipher.open(data, msg.data_size, &type_byte, 1)) {
+            logger->warn(id, "message authentication failed");
+            broken = true;
+            return false;
+        }
+
+        parsed_data = data;
+        parsed_len = (uint32_t) msg.data_size;
+    } else if(msg.data_size != msg.data_len) {
         logger->warn(id, "wrong data length");
         return false;
+    } else {
+        // payload is used straight from the receive buffer, decrypted in place if needed
+        uint8_t* data = const_cast<uint8_t*>(msg.data);
+
+        if(!decrypt(decrypt_alg, {data, msg.data_len}, {data, msg.data_len})) {
+            return false;
+        }
+
+        parsed_data = data;
+        parsed_len = msg.data_len;
     }
 
-    uint8_t* hash = nullptr;
-    uint16_t hash_size;
+    uint8_t hash[MAX_HASH_SIZE];
 
-    calculateHash(msg.hashalgorithm(), *parsed_data, *parsed_len, &hash, &hash_size);
+    size_t hash_len = calculateHash(msg.hash_algorithm, {parsed_data, parsed_len}, {hash, sizeof(hash)});
 
-    bool hash_ok = compareHash(hash, hash_size, (uint8_t*) msg.hash().c_str(), msg.hash().length());
+    bool hash_ok = compareHash(hash, (uint16_t) hash_len, msg.hash, (uint16_t) msg.hash_len);
 
     if(!hash_ok) {
         logger->warn(id, "wrong hash");
-        logger->warn(id, "should be " + printHash(msg.hashalgorithm(), (uint8_t*) msg.hash().c_str()));
-        logger->warn(id, "got       " + printHash(msg.hashalgorithm(), hash));
-        delete hash;
+        logger->warn(id, "should be " + printHash(msg.hash_algorithm, msg.hash));
+        logger->warn(id, "got       " + printHash(msg.hash_algorithm, hash));
+
+        // most likely a plaintext handshake on an encrypted connection
+        if(msg.type == MessageType::HANDSHAKE && decrypt_alg != EncryptionAlgorithm::NOENCRYPTION) {
+            broken = true;
+        }
         return false;
     }
 
-    logger->log(id, "Received message type: " + MessageType_Name(msg.type()) + " (" + to_string(msg.type()) + ")");
+    LOG_DEBUG(logger, id, "Received message type: " + MessageType_Name(msg.type) + " (" + to_string(msg.type) + ")");
 
-    *msg_type = msg.type();
+    *msg_type = msg.type;
 
-    delete hash;
     return true;
 }
 
 bool Client::processHandshake(Handshake* handshake) {
     logger->info(id, "Setting encryption to " + EncryptionAlgorithm_Name(handshake->encryptionalgorithm()));
 
-    setEncryptionAlgorithm(handshake->encryptionalgorithm());
+    EncryptionAlgorithm encryption = handshake->encryptionalgorithm();
+    bool aead = SessionCipher::isAead(encryption);
+    uint8_t protocol = (handshake->protocolversion() >= PROTOCOL_V2) ? PROTOCOL_V2 : PROTOCOL_V1;
 
     ServerResponse res;
+
+    // derived aside, the answer (or the error) still goes under the keys the peer has now
+    SessionCipher next_cipher;
+
+    if(aead && !(next_cipher.generateKey() && next_cipher.deriveKeys(encryption, handshake->publickey()))) {
+        resError(res, "Key exchange failed", "sent handshake, but key exchange failed");
+        return sendServerResponse(&res);
+    }
+
+    if(!aead) {
+        setEncryptionAlgorithm(encryption);
+    }
+
+    this_connection->raw_frames = handshake->rawdataframes();
     res.set_type(ResponseType::OK);
-    sendServerResponse(&res);
+
+    if(aead) {
+        Param* tmp_param = res.add_params();
+        tmp_param->set_paramid("public_key");
+        tmp_param->set_bparamval(next_cipher.publicKey());
+    }
+
+    if(handshake->rawdataframes()) {
+        Param* tmp_param = res.add_params();
+        tmp_param->set_paramid("raw_frames");
+        tmp_param->set_iparamval(1);
+    }
+
+    if(handshake->hashalgorithm() != HashAlgorithm::NULL2) {
+        if(isHashSupported(handshake->hashalgorithm())) {
+            this_connection->hash_algorithm = handshake->hashalgorithm();
+        } else {
+            logger->warn(id, "Unsupported hashing algorithm " + to_string(handshake->hashalgorithm()) + ", keeping " + HashAlgorithm_Name(getHashAlgorithm()));
+        }
+
+        Param* tmp_param = res.add_params();
+        tmp_param->set_paramid("hash_algorithm");
+        tmp_param->set_iparamval(getHashAlgorithm());
+    }
+
+    if(protocol == PROTOCOL_V2) {
+        Param* tmp_param = res.add_params();
+        tmp_param->set_paramid("protocol");
+        tmp_param->set_iparamval(protocol);
+    }
+
+    // answer goes in the framing the handshake came in, the new one applies from the next message
+    bool sent = sendServerResponse(&res);
+    this_connection->protocol = protocol;
+
+    // keys are used from the next message, the peer needs our public key first
+    if(aead) {
+        cipher.swap(next_cipher);
+        setEncryptionAlgorithm(encryption);
+    }
+
+    return sent;
 }
 
 bool Client::sendServerResponse(const ServerResponse* res) {
-    uint32_t data_len = res->ByteSize();
-    uint8_t* data = new uint8_t[data_len];
-    res->SerializeToArray(data, data_len);
-    if(prepareDataToSend(data, data_len)) {
-        logger->log(id + "/sendResponse", res->DebugString());
+    uint32_t data_len = (uint32_t) res->ByteSizeLong();
+    bool sent;
+
+    if(this_connection->protocol == PROTOCOL_V2) {
+        sent = sendFrameV2(res, data_len);
+    } else {
+        PooledBuffer data(data_len);
+        res->SerializeToArray(data.data(), data_len);
+        sent = prepareDataToSend(data.data(), data_len);
+    }
+
+    if(sent) {
+        LOG_DEBUG(logger, id + "/sendResponse", res->DebugString());
+        response_bytes += data_len;
+    }
+
+    if(res->type() == ResponseType::ERROR) {
+        response_error = true;
     }
 
-    delete data;
+    return sent;
+}
+
+bool Client::sendFrameV2(const ServerResponse* res, const uint32_t len) {
+    bool aead = SessionCipher::isAead(getEncryptionAlgorithm());
+
+    frame_header header;
+    header.length = V2_HEADER_SIZE + len + (aead ? GCM_TAG_SIZE : 0);
+    header.version = PROTOCOL_V2;
+    header.type = MessageType::SERVER_RESPONSE;
+    header.flags = 0;
+    header.stream = 0;
+
+    if(header.length > MAX_PACKET_SIZE - 4) {
+        logger->warn(id, "response message too big (" + to_string(header.length) + ">" + to_string(MAX_PACKET_SIZE + 4) + ")");
+        return false;
+    }
+
+    for(auto& param: res->params()) {
+        if(param.paramid() == "stream_id") {
+            header.stream = (uint32_t) param.iparamval();
+        }
+    }
+
+    // response is serialized once, straight behind the header
+    PooledBuffer out_buf(header.length);
+    uint8_t* payload = out_buf.data() + V2_HEADER_SIZE;
+    res->SerializeToArray(payload, len);
+
+    if(aead) {
+        header.checksum = 0;
+        header.flags |= V2_FLAG_ENCRYPTED;
+        writeFrameHeader(out_buf.data(), header);
+
+        if(!cipher.seal(payload, len, out_buf.data(), V2_HEADER_SIZE - 4)) {
+            logger->err(id, "error while encrypting response");
+            return false;
+        }
+    } else if(getEncryptionAlgorithm() != EncryptionAlgorithm::NOENCRYPTION) {
+        header.checksum = crc32c(payload, len);
+        if(!encrypt(getEncryptionAlgorithm(), {payload, len}, {payload, len})) {
+            return false;
+        }
+        header.flags |= V2_FLAG_ENCRYPTED;
+        writeFrameHeader(out_buf.data(), header);
+    } else {
+        header.checksum = crc32c(payload, len);
+        writeFrameHeader(out_buf.data(), header);
+    }
+
+    LOG_DEBUG(logger, id, "sending v2 response with size: " + to_string(header.length));
+
+    if(sendNBytes(header.length, out_buf.data())) {
+        LOG_DEBUG(logger, id, "response sent successfully");
+        return true;
+    }
+
+    logger->warn(id, "response not sent successfully");
+    return false;
 }
 
 bool Client::prepareDataToSend(uint8_t in_buf[], uint32_t len) {
-    EncodedMessage msg;
+    encoded_view msg;
 
-    uint8_t* hash = nullptr;
-    uint16_t hash_len;
-    uint8_t* data = nullptr;
-    uint32_t size = 0;
-    uint8_t* out_buf = nullptr;
+    uint8_t hash[MAX_HASH_SIZE];
     uint32_t out_len = 0;
+    bool aead = SessionCipher::isAead(getEncryptionAlgorithm());
 
-    calculateHash(getHashAlgorithm(), in_buf, len, &hash, &hash_len);
+    msg.data_size = len;
+    msg.type = MessageType::SERVER_RESPONSE;
 
-    encrypt(getEncryptionAlgorithm(), in_buf, len, &data, &size);
+    // payload is written by the cipher straight into its place in the output buffer
+    msg.data = nullptr;
 
-    msg.set_hash((char*)hash, hash_len);
-    msg.set_datasize(len);
-    msg.set_data((char*)data, size);
-    msg.set_type(MessageType::SERVER_RESPONSE);
-    msg.set_hashalgorithm(getHashAlgorithm());
+    if(aead) {
+        // GCM tag authenticates the message
+        msg.hash_algorithm = HashAlgorithm::H_NOHASH;
+        msg.data_len = len + GCM_TAG_SIZE;
+    } else {
+        msg.hash = hash;
+        msg.hash_len = (uint32_t) calculateHash(getHashAlgorithm(), {in_buf, len}, {hash, sizeof(hash)});
+        msg.hash_algorithm = getHashAlgorithm();
+        msg.data_len = len;
+    }
 
-    out_len = msg.ByteSize() + 4;
+    out_len = (uint32_t) encodedMessageSize(msg) + 4;
 
     if(out_len > MAX_PACKET_SIZE - 4) {
         logger->warn(id, "response message too big (" + to_string(out_len) + ">" + to_string(MAX_PACKET_SIZE + 4) + ")");
-        delete hash;
-        delete data;
         return false;
     }
 
-    out_buf = new uint8_t[out_len];
+    PooledBuffer out_buf(out_len);
 
-    msg.SerializeToArray(out_buf + 4, out_len - 4);
+    uint8_t* end = writeEncodedMessage(msg, out_buf.data() + 4);
+    uint8_t* payload = end - msg.data_len;
 
-    logger->log(id, "sending response with size: " + to_string(out_len) + " (" + to_string(out_len-4) + "+4)");
+    if(aead) {
+        uint8_t type_byte = (uint8_t) msg.type;
+        memcpy(payload, in_buf, len);
 
-    out_buf[3] = out_len & 0xFF;
-    out_buf[2] = (out_len >> 8) & 0xFF;
-    out_buf[1] = (out_len >> 16) & 0xFF;
-    out_buf[0] = (out_len >> 24) & 0xFF;
+        if(!cipher.seal(payload, len, &type_byte, 1)) {
+            logger->err(id, "error while encrypting response");
+            return false;
+        }
+    } else if(!encrypt(getEncryptionAlgorithm(), {in_buf, len}, {payload, len})) {
+        return false;
+    }
 
-    if(sendNBytes(out_len, out_buf)) {
-        logger->log(id, "response sent successfully");
-        delete hash;
-        delete data;
+    LOG_DEBUG(logger, id, "sending response with size: " + to_string(out_len) + " (" + to_string(out_len-4) + "+4)");
+
+    out_buf.data()[3] = out_len & 0xFF;
+    out_buf.data()[2] = (out_len >> 8) & 0xFF;
+    out_buf.data()[1] = (out_len >> 16) & 0xFF;
+    out_buf.data()[0] = (out_len >> 24) & 0xFF;
+
+    if(sendNBytes(out_len, out_buf.data())) {
+        LOG_DEBUG(logger, id, "response sent successfully");
         return true;
     }
 
     logger->warn(id, "response not sent successfully");
-    delete hash;
-    delete data;
     return false;
 }
 
 bool Client::getMessage() {
-    uint8_t msg_buf[MAX_PACKET_SIZE];
-    uint8_t size_buf[4];
     bool lastReason;
 
-    if(!getNBytes(4, size_buf, lastReason)) {
+    if(!fillBuffer(4, lastReason)) {
         if(!(*should_exit) && lastReason == R_ERROR)
             logger->warn(id, "connection error (size)");
         return false;
     }
 
-    uint32_t size = parseSize(size_buf);
+    uint32_t size = parseSize(in_buf.data());
+
+    if(size & RAW_FRAME_FLAG) {
+        return getRawFrame();
+    }
 
-    if(size > MAX_PACKET_SIZE) {
-        logger->err(id, "incoming message too big (" + to_string(size) + ">" + to_string(MAX_PACKET_SIZE) + ")");
+    if(size < minFrameSize() || size > MAX_PACKET_SIZE) {
+        logger->err(id, "incoming message has wrong size (" + to_string(size) + ")");
         return false;
     }
 
-    if(!getNBytes(size - 4, msg_buf, lastReason)) {
+    if(!fillBuffer(size, lastReason)) {
         if(!(*should_exit) && lastReason == R_ERROR)
             logger->err(id, "connection error while getting message body");
         return false;
     }
 
-    logger->log(id, "got all data (" + to_string(size) + ")");
+    LOG_DEBUG(logger, id, "got all data (" + to_string(size) + ")");
 
-    processMessage(msg_buf, size);
+    processFrame(in_buf.data(), size);
+    consumeBuffer(size);
 
-    return true;
+    return !broken;
+}
+
+bool Client::getRawFrame() {
+    bool lastReason;
+    raw_frame_header header;
+
+    if(!fillBuffer(RAW_HEADER_SIZE, lastReason)) {
+        if(!(*should_exit) && lastReason == R_ERROR)
+            logger->warn(id, "connection error (raw header)");
+        return false;
+    }
+
+    if(!parseRawHeader(in_buf.data(), header) || header.length > MAX_PACKET_SIZE) {
+        logger->err(id, "incoming raw frame has wrong size (" + to_string(parseSize(in_buf.data()) & ~RAW_FRAME_FLAG) + ")");
+        return false;
+    }
+
+    // payload is not waited for, whatever is missing is spliced straight into the file
+    uint64_t buffered = min((uint64_t) in_len, (uint64_t) header.length) - RAW_HEADER_SIZE;
+
+    receiveFileChunk(header, in_buf.data() + RAW_HEADER_SIZE, buffered);
+    consumeBuffer(RAW_HEADER_SIZE + buffered);
+
+    return !broken;
+}
+
+bool Client::readAvailable() {
+    while(true) {
+        if(in_buf.size() - in_len < 4096) {
+            size_t needed = in_len + IN_BUF_MIN_SIZE;
+
+            if(in_len >= 4) {
+                uint32_t size = parseSize(in_buf.data()) & ~RAW_FRAME_FLAG;
+                if(size < 4 || size > MAX_PACKET_SIZE || in_len >= size) {
+                    // hasFrame handles it, the rest of data stays in the kernel
+                    return true;
+                }
+                needed = max(needed, (size_t) size);
+            }
+
+            in_buf.resize(needed);
+        }
+
+        ssize_t received = recvSocket(in_buf.data() + in_len, in_buf.size() - in_len, MSG_DONTWAIT);
+
+        if(received == 0) {
+            logger->info(id, "no new data, closing");
+            return false;
+        }
+
+        if(received < 0) {
+            if(errno == EWOULDBLOCK || errno == EAGAIN) {
+                return true;
+            }
+            if(errno == EINTR) {
+                continue;
+            }
+            logger->err(id, "error while reading from socket", errno);
+            return false;
+        }
+
+        in_len += received;
+    }
+}
+
+uint32_t Client::minFrameSize() {
+    return (this_connection->protocol == PROTOCOL_V2) ? V2_HEADER_SIZE : 4;
+}
+
+bool Client::hasFrame(size_t offset) {
+    if(in_len - offset < 4) {
+        return false;
+    }
+
+    uint32_t size = parseSize(in_buf.data() + offset);
+    uint32_t min_size = (size & RAW_FRAME_FLAG) ? RAW_HEADER_SIZE : minFrameSize();
+    size &= ~RAW_FRAME_FLAG;
+
+    if(size < min_size || size > MAX_PACKET_SIZE) {
+        logger->err(id, "incoming message has wrong size (" + to_string(size) + ")");
+        broken = true;
+        return false;
+    }
+
+    return in_len - offset >= size;
+}
+
+void Client::processFrames() {
+    size_t offset = 0;
+
+    // responses of a peer which doesn't read are not piled up, its requests wait until the queue is sent
+    if(!flushOutput()) {
+        return;
+    }
+
+    // frames are processed in place, the buffer is compacted once at the end
+    while(!broken && !hasPendingOutput() && hasFrame(offset)) {
+        raw_frame_header header;
+
+        if(parseRawHeader(in_buf.data() + offset, header)) {
+            receiveFileChunk(header, in_buf.data() + offset + RAW_HEADER_SIZE, header.length - RAW_HEADER_SIZE);
+            offset += header.length;
+            continue;
+        }
+
+        uint32_t size = parseSize(in_buf.data() + offset);
+        LOG_DEBUG(logger, id, "got all data (" + to_string(size) + ")");
+        processFrame(in_buf.data() + offset, size);
+        offset += size;
+    }
+
+    consumeBuffer(offset);
+
+    if(!broken && !hasPendingOutput()) {
+        pushDownloads();
+    }
+
+    if(io != nullptr) {
+        io->submitPending();
+    }
+}
+
+bool Client::inputPending() {
+    if(in_len > 0) {
+        return true;
+    }
+
+    // end of stream counts too, getMessage notices it
+    uint8_t byte;
+    ssize_t peeked = recv(socket, &byte, 1, MSG_PEEK | MSG_DONTWAIT);
+    return peeked >= 0 || (errno != EWOULDBLOCK && errno != EAGAIN && errno != EINTR);
 }
 
 void Client::loop() {
 
-    while(!(*should_exit)) {
+    while(!(*should_exit) && !broken) {
+        // downloads go on between requests, reading blocks only when none of them has credit
+        if(!inputPending() && hasPendingDownloads()) {
+            pushDownloads();
+            continue;
+        }
+
         if (!getMessage()) {
             break;
         }
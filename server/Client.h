@@ -5,10 +5,21 @@
 #include "utils.h"
 #include "Logger.h"
 #include "User.h"
+#include "SessionCipher.h"
+#include "Stats.h"
+#include "Trace.h"
+
+#include <deque>
 
 #define R_DISCONNECT true
 #define R_ERROR false
 
+#define IN_BUF_MIN_SIZE 64*1024
+// bytes dropped from a kTLS socket per read
+#define TLS_DISCARD_SIZE 16*1024
+// first arena block of a request, bigger messages make the arena allocate more
+#define REQUEST_ARENA_SIZE 16*1024
+
 using namespace std;
 using namespace StorageCloud;
 
@@ -20,27 +31,123 @@ private:
     bool* should_exit;
     Logger* logger;
     std::string id;
-    User u = User(UserManager::getInstance());
+    User u{UserManager::getInstance()};
     string sessionId;
 
+    // bytes received but not yet processed
+    vector<uint8_t> in_buf;
+    size_t in_len = 0;
+    bool broken = false;
+
+    // created on first wait and kept for the whole connection
+    int epfd = -1;
+    uint32_t epoll_events = 0;
+
+    // reactor mode, sends never wait for the socket and what didn't fit is sent by flushOutput
+    struct OutChunk {
+        std::vector<uint8_t> data;
+        size_t sent = 0;
+        // file range when not -1, own duplicate of the descriptor
+        int fd = -1;
+        uint64_t offset = 0;
+        uint64_t end = 0;
+    };
+
+    bool queue_output = false;
+    std::deque<OutChunk> out_queue;
+
+    // socket and file I/O through io_uring when enabled
+    IoEngine* io = nullptr;
+
+    // flow control of windowed transfers, keyed by stream id
+    struct UploadWindow {
+        uint64_t window = 0;
+        uint64_t unacked = 0;
+        bool failed = false;
+    };
+
+    struct DownloadWindow {
+        uint64_t window = 0;
+        uint64_t limit = 0;
+    };
+
+    std::map<uint32_t, UploadWindow> uploads;
+    std::map<uint32_t, DownloadWindow> downloads;
+
+    // keys of AES-GCM encrypted connection
+    SessionCipher cipher;
+
+    // stream id from the header of the v2 frame being processed
+    uint32_t frame_stream = 0;
+
+    // responses to the command being processed, recorded in Stats when it ends
+    uint64_t response_bytes = 0;
+    bool response_error = false;
+
+    // moves raw upload payload from socket to file
+    int splice_pipe[2] = {-1, -1};
+    size_t splice_pipe_size = 0;
+
     HashAlgorithm getHashAlgorithm();
     EncryptionAlgorithm getEncryptionAlgorithm();
     void setEncryptionAlgorithm(EncryptionAlgorithm);
-    bool getNBytes(int, uint8_t*, bool&);
-    bool sendNBytes(int, uint8_t*);
+    bool waitForSocket(uint32_t);
+    // recv which ends a kTLS connection cleanly on alerts and other control records, returning 0 like EOF
+    ssize_t recvSocket(void*, size_t, int);
+    bool fillBuffer(size_t, bool&);
+    void consumeBuffer(size_t);
+    bool sendNBytes(int, uint8_t*, int = 0);
+    bool sendFileRange(int, uint64_t, uint64_t);
+    void queueBytes(const uint8_t*, size_t);
+    bool queueFileRange(int, uint64_t, uint64_t);
+    bool flushOutput();
+    bool rawDataEnabled();
+    bool sendFileChunk(ServerResponse&, uint32_t);
+    bool sendDownloadChunk(uint32_t);
+    bool startDownload(uint32_t, uint64_t, uint64_t);
+    bool pushDownload(uint32_t);
+    void pushDownloads();
+    bool inputPending();
+    bool spliceToFile(int, uint64_t, uint64_t, uint64_t&);
+    void closeSplicePipe();
+    bool discardBytes(uint64_t);
+    void receiveFileChunk(const raw_frame_header&, const uint8_t*, uint64_t);
+    bool getRawFrame();
+    uint32_t streamOf(const Command*);
+    void addStreamParam(ServerResponse&, uint32_t);
+    void addWindowParam(ServerResponse&, uint32_t);
+    bool uploadFailed(uint32_t);
+    bool uploadResponse(ServerResponse&, uint64_t, uint32_t);
+    bool processFrame(uint8_t*, uint32_t);
+    bool processFrameV2(uint8_t*, uint32_t);
+    uint32_t minFrameSize();
     bool processMessage(uint8_t*, int);
-    bool parseMessage(uint8_t*, int, MessageType*, uint8_t**, uint32_t*);
+    bool dispatchMessage(MessageType, const uint8_t*, uint32_t);
+    // parsed data points into the frame, or into the last buffer when it had to be decrypted
+    bool parseMessage(uint8_t*, int, MessageType*, const uint8_t*&, uint32_t&);
     bool processCommand(Command*);
     bool processHandshake(Handshake*);
     bool sendServerResponse(const ServerResponse*);
     bool prepareDataToSend(uint8_t*, uint32_t);
+    bool sendFrameV2(const ServerResponse*, uint32_t);
     bool getMessage();
 
     void resError(ServerResponse&, string&&, string&&);
 
 public:
     Client(int, connection*, bool*, Logger*);
+    ~Client();
     void loop();
+
+    // reactor mode
+    void enableOutputQueue() { queue_output = true; };
+    bool hasPendingOutput() { return !out_queue.empty(); };
+    bool readAvailable();
+    bool hasFrame(size_t = 0);
+    void processFrames();
+    bool isBroken() { return broken; };
+    // some download has credit left, it is sent a slice at a time between requests
+    bool hasPendingDownloads();
 };
 
 #endif //SERVER_CLIENT_H
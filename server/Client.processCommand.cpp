@@ -8,14 +8,16 @@ void Client::resError(ServerResponse& res, string&& reason, string&& loggerReaso
     Param* tmp_param = res.add_params();
     tmp_param->set_paramid("msg");
     tmp_param->set_sparamval(reason);
-    logger->log(id, "client " + username + " " + loggerReason);
+    LOG_DEBUG(logger, id, "client " + username + " " + loggerReason);
 }
 
 bool Client::processCommand(Command* cmd) {
-    logger->log(id, "Received command '" + CommandType_Name(cmd->type()) + "' (" + to_string(cmd->type()) +
+    LOG_DEBUG(logger, id, "Received command '" + CommandType_Name(cmd->type()) + "' (" + to_string(cmd->type()) +
                     "), with " + to_string(cmd->params_size()) + " params");
 
-    ServerResponse res;
+    // response shares the arena of the command
+    ServerResponse& res = *google::protobuf::Arena::CreateMessage<ServerResponse>(cmd->GetArena());
+    unique_ptr<ServerResponse> res_owner(cmd->GetArena() == nullptr ? &res : nullptr);
 
     if(cmd->type() == CommandType::LOGIN) {
         bool params_ok = (cmd->params_size() == 2);
@@ -49,7 +51,7 @@ bool Client::processCommand(Command* cmd) {
             Param* tmp_param = res.add_params();
             tmp_param->set_paramid("sid");
             tmp_param->set_bparamval(sid);
-            logger->log(id, "user " + t_username + " logged in");
+            LOG_DEBUG(logger, id, "user " + t_username + " logged in");
             vector<string> warns;
             u.getWarnings(warns);
             for(auto& warn: warns) {
@@ -63,19 +65,19 @@ bool Client::processCommand(Command* cmd) {
             if(params_ok) {
                 tmp_param->set_sparamval("Invalid username/password");
                 if(!u.isValid()) {
-                    logger->log(id, "client " + t_username + " tried to log in, but that user doesn't exist");
+                    LOG_DEBUG(logger, id, "client " + t_username + " tried to log in, but that user doesn't exist");
                 } else if(!u.isAuthorized()) {
-                    logger->log(id, "client " + t_username + " tried to log in, but provided wrong password");
+                    LOG_DEBUG(logger, id, "client " + t_username + " tried to log in, but provided wrong password");
                 } else {
                     logger->warn(id, "client " + t_username + " tried to log in, but internal error occurred");
                 }
             } else {
                 if(!alreadyAuthorized) {
                     tmp_param->set_sparamval("Invalid command format");
-                    logger->log(id, "client send login command, but command format was wrong");
+                    LOG_DEBUG(logger, id, "client send login command, but command format was wrong");
                 } else {
                     tmp_param->set_sparamval("You have to logout first");
-                    logger->log(id, "client tried to login, but is already logged in");
+                    LOG_DEBUG(logger, id, "client tried to login, but is already logged in");
                 }
             }
         }
@@ -112,7 +114,7 @@ bool Client::processCommand(Command* cmd) {
             Param* tmp_param = res.add_params();
             tmp_param->set_paramid("sid");
             tmp_param->set_bparamval(sid);
-            logger->log(id, "user " + t_username + " relogged in");
+            LOG_DEBUG(logger, id, "user " + t_username + " relogged in");
             vector<string> warns;
             u.getWarnings(warns);
             for(auto& warn: warns) {
@@ -126,19 +128,19 @@ bool Client::processCommand(Command* cmd) {
             if(params_ok) {
                 tmp_param->set_sparamval("Invalid username or session ID");
                 if(!u.isValid()) {
-                    logger->log(id, "client " + t_username + " tried to relogin, but that user doesn't exist");
+                    LOG_DEBUG(logger, id, "client " + t_username + " tried to relogin, but that user doesn't exist");
                 } else if(!u.isAuthorized()) {
-                    logger->log(id, "client " + t_username + " tried to relogin, but provided wrong sid");
+                    LOG_DEBUG(logger, id, "client " + t_username + " tried to relogin, but provided wrong sid");
                 } else {
                     logger->warn(id, "client " + t_username + " tried to relogin, but internal error occurred");
                 }
             } else {
                 if(!alreadyAuthorized) {
                     tmp_param->set_sparamval("Invalid command format");
-                    logger->log(id, "client send relogin command, but command format was wrong");
+                    LOG_DEBUG(logger, id, "client send relogin command, but command format was wrong");
                 } else {
                     tmp_param->set_sparamval("You have to logout first");
-                    logger->log(id, "client tried to relogin, but is already logged in");
+                    LOG_DEBUG(logger, id, "client tried to relogin, but is already logged in");
                 }
             }
         }
@@ -150,11 +152,11 @@ bool Client::processCommand(Command* cmd) {
             Param* tmp_param = res.add_params();
             tmp_param->set_paramid("msg");
             tmp_param->set_sparamval("You are not logged in");
-            logger->log(id, "client " + username + " tried to log out, but was not logged in");
+            LOG_DEBUG(logger, id, "client " + username + " tried to log out, but was not logged in");
         } else {
             u.logout(sessionId);
             res.set_type(ResponseType::OK);
-            logger->log(id, "client " + username + " logged out");
+            LOG_DEBUG(logger, id, "client " + username + " logged out");
             sessionId = "";
             username = "";
         }
@@ -197,6 +199,8 @@ bool Client::processCommand(Command* cmd) {
         } else {
             string path, hash;
             uint64_t size = 0;
+            uint64_t window = 0;
+            uint32_t stream = streamOf(cmd);
             uint8_t validFields = 0;
 
             for(auto& param: cmd->params()) {
@@ -209,9 +213,14 @@ bool Client::processCommand(Command* cmd) {
                 } else if(param.paramid() == "size") {
                     size = param.iparamval();
                     validFields++;
+                } else if(param.paramid() == "window") {
+                    window = (uint64_t) max(param.iparamval(), (int64_t) 0);
                 }
             }
 
+            // new upload, chunks left from the previous one are not accepted any more
+            uploads.erase(stream);
+
             bool paramsOk = false;
 
             if(validFields == 3) {
@@ -227,23 +236,29 @@ bool Client::processCommand(Command* cmd) {
                 file.hash = hash;
                 file.size = size;
 
-                uint8_t wyn = u.addFile(file);
+                uint8_t wyn = u.addFile(file, stream);
+
+                if((wyn == ADD_FILE_OK || wyn == ADD_FILE_CONTINUE_OK) && window > 0) {
+                    uploads[stream].window = min(window, (uint64_t) UPLOAD_MAX_WINDOW);
+                }
 
                 if(wyn == ADD_FILE_OK) {
                     res.set_type(ResponseType::CAN_SEND);
                     Param* tmp = res.add_params();
                     tmp->set_paramid("starting_chunk");
                     tmp->set_iparamval(0);
+                    addWindowParam(res, stream);
                 } else if(wyn == ADD_FILE_CONTINUE_OK) {
                     res.set_type(ResponseType::CAN_SEND);
-                    UFile tmp_file = u.getCurrentInFileMetadata();
-                    if(!u.isCurrentInFileValid()) {
+                    UFile tmp_file = u.getCurrentInFileMetadata(stream);
+                    if(!u.isCurrentInFileValid(stream)) {
                         resError(res, "Internal error occured (2)", "tried to add metadata, tried to continue, but internal error occured");
                         logger->err(id, "client " + username + " tried to add metadata, tried to continue, but internal error occured");
                     } else {
                         Param* tmp = res.add_params();
                         tmp->set_paramid("starting_chunk");
                         tmp->set_iparamval(tmp_file.lastValid);
+                        addWindowParam(res, stream);
                     }
                 } else {
                     if(wyn == ADD_FILE_INTERNAL_ERROR) {
@@ -256,6 +271,8 @@ bool Client::processCommand(Command* cmd) {
                         resError(res, "File already exists", "tried to add metadata, but filename already exists");
                     } else if(wyn == ADD_FILE_NO_SPACE) {
                         resError(res, "Not enough space left", "tried to add metadata, but doesn't have enough free space");
+                    } else if(wyn == ADD_FILE_TOO_MANY_STREAMS) {
+                        resError(res, "Too many transfers", "tried to add metadata, but has too many transfers in progress");
                     } else {
                         resError(res, "Unknown error", "tried to add metadata, but unknown error occured");
                     }
@@ -266,6 +283,7 @@ bool Client::processCommand(Command* cmd) {
 
         }
 
+        addStreamParam(res, streamOf(cmd));
         sendServerResponse(&res);
     } else if (cmd->type() == CommandType::MKDIR) {
         if(!(u.isValid() && u.isAuthorized())) {
@@ -301,13 +319,25 @@ bool Client::processCommand(Command* cmd) {
 
         sendServerResponse(&res);
     } else if (cmd->type() == CommandType::USR_DATA) {
+        uint32_t stream = streamOf(cmd);
+        uint64_t len = 0;
+
         if(!(u.isValid() && u.isAuthorized())) {
             resError(res, "You are not logged in", "tried to put data, but was not logged in");
         } else {
-            if(cmd->params_size() == 1 && cmd->params(0).paramid() == "data" && cmd->params(0).bparamval().length()) {
-                if(u.addFileChunk(cmd->params(0).bparamval())) {
-                    if(u.getCurrentInFileMetadata().isValid) {
-                        logger->log(id, "user " + username + ": adding file accomplished");
+            const string* data = nullptr;
+
+            for(auto& param: cmd->params()) {
+                if(param.paramid() == "data") {
+                    data = &param.bparamval();
+                }
+            }
+
+            if(data != nullptr && data->length()) {
+                len = data->length();
+                if(!uploadFailed(stream) && u.addFileChunk(*data, stream)) {
+                    if(u.getCurrentInFileMetadata(stream).isValid) {
+                        LOG_DEBUG(logger, id, "user " + username + ": adding file accomplished");
                     }
                     res.set_type(ResponseType::OK);
                 } else {
@@ -319,7 +349,10 @@ bool Client::processCommand(Command* cmd) {
 
         }
 
-        sendServerResponse(&res);
+        if(uploadResponse(res, len, stream)) {
+            addStreamParam(res, stream);
+            sendServerResponse(&res);
+        }
     } else if (cmd->type() == CommandType::LIST_USERS) {
         if(!(u.isAdmin())) {
             resError(res, "Not enough permissions", "tried to list users, but was not logged as admin");
@@ -594,6 +627,7 @@ bool Client::processCommand(Command* cmd) {
         } else {
             string filename;
             uint64_t startingChunk = 0;
+            uint64_t window = 0;
             uint8_t validFields = 0;
 
             for(auto& param: cmd->params()) {
@@ -603,36 +637,56 @@ bool Client::processCommand(Command* cmd) {
                 } else if(param.paramid() == "starting_chunk") {
                     startingChunk = (uint64_t) param.iparamval();
                     validFields++;
+                } else if(param.paramid() == "window") {
+                    window = (uint64_t) max(param.iparamval(), (int64_t) 0);
                 }
             }
 
             if(validFields == 2 && !filename.empty()) {
-                string data;
-                if(u.initFileDownload(filename, startingChunk, data)) {
-                    res.set_type(ResponseType::SRV_DATA);
-                    res.set_data(data);
-                } else {
-                    resError(res, "Error occured", "tried to download file " + filename + ", but error occured");
+                if(u.prepareFileDownload(filename, startingChunk, streamOf(cmd))) {
+                    return startDownload(streamOf(cmd), startingChunk, window);
                 }
+                resError(res, "Error occured", "tried to download file " + filename + ", but error occured");
             } else {
                 resError(res, "Wrong command format", "tried to download file, but command format was wrong");
             }
         }
 
+        addStreamParam(res, streamOf(cmd));
         sendServerResponse(&res);
     } else if (cmd->type() == CommandType::C_DOWNLOAD) {
+        uint32_t stream = streamOf(cmd);
+        auto st = downloads.find(stream);
+
         if(!(u.isValid() && u.isAuthorized())) {
             resError(res, "You are not logged in", "tried to continue downloading file, but was not logged in");
-        } else {
-            string data;
-            if (u.getFileChunk(data)) {
-                res.set_type(ResponseType::SRV_DATA);
-                res.set_data(data);
-            } else {
-                resError(res, "Error occured", "tried to continue downloading file, but error occured");
+        } else if (st != downloads.end()) {
+            bool validFields = false;
+            uint64_t received = 0;
+
+            // window update: the client has everything before "received"
+            for(auto& param: cmd->params()) {
+                if(param.paramid() == "received") {
+                    received = (uint64_t) max(param.iparamval(), (int64_t) 0);
+                    validFields = true;
+                } else if(param.paramid() == "window") {
+                    st->second.window = min((uint64_t) max(param.iparamval(), (int64_t) 1), (uint64_t) DOWNLOAD_MAX_WINDOW);
+                }
             }
+
+            if(validFields) {
+                // the client can't have received more than was sent
+                received = min(received, u.getCurrentOutFilePos(stream));
+                st->second.limit = max(st->second.limit, received + st->second.window);
+                return pushDownload(stream);
+            }
+
+            resError(res, "Wrong command format", "tried to update download window, but command format was wrong");
+        } else {
+            return sendDownloadChunk(stream);
         }
 
+        addStreamParam(res, stream);
         sendServerResponse(&res);
     } else if (cmd->type() == CommandType::SHARE) {
         if(!(u.isValid() && u.isAuthorized())) {
@@ -753,6 +807,7 @@ bool Client::processCommand(Command* cmd) {
         } else {
             string filename, hash, ownerUsername;
             uint64_t startingChunk = 0;
+            uint64_t window = 0;
             uint8_t validFields = 0;
 
             for(auto& param: cmd->params()) {
@@ -768,22 +823,22 @@ bool Client::processCommand(Command* cmd) {
                 } else if(param.paramid() == "hash") {
                     hash = param.sparamval();
                     validFields++;
+                } else if(param.paramid() == "window") {
+                    window = (uint64_t) max(param.iparamval(), (int64_t) 0);
                 }
             }
 
             if(validFields == 4 && !filename.empty()) {
-                string data;
-                if(u.initSharedFileDownload(filename, ownerUsername, hash, startingChunk, data)) {
-                    res.set_type(ResponseType::SRV_DATA);
-                    res.set_data(data);
-                } else {
-                    resError(res, "Error occured", "tried to download shared file " + filename + ", but error occured");
+                if(u.prepareSharedFileDownload(filename, ownerUsername, hash, startingChunk, streamOf(cmd))) {
+                    return startDownload(streamOf(cmd), startingChunk, window);
                 }
+                resError(res, "Error occured", "tried to download shared file " + filename + ", but error occured");
             } else {
                 resError(res, "Wrong command format", "tried to download shared file, but command format was wrong");
             }
         }
 
+        addStreamParam(res, streamOf(cmd));
         sendServerResponse(&res);
     } else if (cmd->type() == CommandType::CLEAR_CACHE) {
         if(!(u.isValid() && u.isAuthorized())) {
@@ -879,6 +934,35 @@ bool Client::processCommand(Command* cmd) {
             }
         }
 
+        sendServerResponse(&res);
+    } else if (cmd->type() == CommandType::STATS) {
+        if(!(u.isAdmin())) {
+            resError(res, "Not enough permissions", "tried to get server stats, but was not logged as admin");
+        } else {
+            command_summary summary[CommandType_ARRAYSIZE];
+            Stats::getInstance().getSummary(summary);
+
+            for(int i=0; i<CommandType_ARRAYSIZE; i++) {
+                if(summary[i].count == 0) {
+                    continue;
+                }
+
+                CommandStats* tmp = res.add_stats();
+                tmp->set_type((CommandType) i);
+                tmp->set_count(summary[i].count);
+                tmp->set_errors(summary[i].errors);
+                tmp->set_bytesin(summary[i].bytes_in);
+                tmp->set_bytesout(summary[i].bytes_out);
+                tmp->set_meanus(summary[i].mean());
+                tmp->set_p50us(summary[i].percentile(0.5));
+                tmp->set_p90us(summary[i].percentile(0.9));
+                tmp->set_p99us(summary[i].percentile(0.99));
+                tmp->set_maxus(summary[i].max_us);
+            }
+
+            res.set_type(ResponseType::CMD_STATS);
+        }
+
         sendServerResponse(&res);
     } else if (cmd->type() == CommandType::WARN) {
         if(!(u.isAdmin())) {
@@ -7,31 +7,235 @@ using namespace std;
 
 using bsoncxx::builder::basic::sub_array;
 
+static const vector<db_index> DB_INDEXES = {
+        {"users", {{"username", 1}}, true},
+        {"sessions", {{"sid", 1}}, true},
+        {"sessions", {{"userId", 1}}, false},
+        {"sessions", {{"expires", 1}}, false, true},
+        // lookups by full path
+        {"files", {{"owner", 1}, {"filename", 1}}, false},
+        // directory listing and subtree walks
+        {"files", {{"owner", 1}, {"parent", 1}, {"name", 1}}, false},
+        {"files", {{"owner", 1}, {"hash", 1}}, false},
+        {"files", {{"sharedWith.userId", 1}}, false},
+        // garbage collector looks for old unfinished uploads
+        {"files", {{"isValid", 1}, {"type", 1}, {"lastChunkTime", 1}}, false},
+};
+
+// indexes of older versions which no query uses anymore, as {collection, name}
+static const vector<std::pair<const char*, const char*> > DB_OLD_INDEXES = {
+        // sids live in the sessions collection now
+        {"users", "sids.sid_1"},
+};
+
+thread_local mongocxx::client* Database::thread_client = nullptr;
+
 Database::Database(Logger* l) {
     inst = new mongocxx::instance{};
-    client = new mongocxx::client{mongocxx::uri{DB_URI}};
+    pool = nullptr;
     logger = l;
-    db = (*client)[DB_NAME];
     connected = false;
+}
+
+Database::~Database() {
+    logger->info(l_id, "closing database connection");
+    delete pool;
+    delete inst;
+}
+
+bool Database::connect(const unsigned pool_size) {
+    string uri = DB_URI;
+
+    if(pool_size > 0) {
+        uri += "/?maxPoolSize=" + to_string(pool_size);
+    }
+
+    pool = new mongocxx::pool{mongocxx::uri{uri}};
+    max_clients = pool_size ? pool_size : DB_DEFAULT_POOL_SIZE;
 
     try {
-        db.run_command(make_document(kvp("isMaster", 1)));
-        l->info(l_id, "connected to database");
+        ScopedClient client(*this);
+        client.database().run_command(make_document(kvp("isMaster", 1)));
+        logger->info(l_id, "connected to database, up to " + to_string(max_clients) + " connections");
         connected = true;
     } catch (const std::exception& ex) {
-        l->err(l_id, "error while connecting to database: " + string(ex.what()));
+        logger->err(l_id, "error while connecting to database: " + string(ex.what()));
     } catch (...) {
-        l->err(l_id, "error while connecting to database: unknown error");
+        logger->err(l_id, "error while connecting to database: unknown error");
     }
+
+    if(connected) {
+        ensureIndexes();
+        addPathKeys();
+    }
+
+    return connected;
 }
 
-Database::~Database() {
-    logger->info(l_id, "closing database connection");
-    delete client;
-    delete inst;
+bool Database::ensureIndexes() {
+    ScopedClient client(*this);
+    mongocxx::database db = client.database();
+    bool all_present = true;
+
+    for(auto& index: DB_INDEXES) {
+        // same name the server would give it, so indexes created by hand are recognized too
+        string name;
+        bsoncxx::builder::basic::document keys;
+
+        for(auto& key: index.keys) {
+            name += string(name.empty() ? "" : "_") + key.first + "_" + to_string(key.second);
+            keys.append(kvp(key.first, key.second));
+        }
+
+        string full_name = string(index.collection) + "." + name;
+
+        try {
+            bool exists = false;
+
+            for(auto&& doc: db[index.collection].list_indexes()) {
+                auto el = doc["name"];
+                if(el && bsoncxx::string::to_string(el.get_utf8().value) == name) {
+                    exists = true;
+                    break;
+                }
+            }
+
+            if(exists) {
+                continue;
+            }
+
+            mongocxx::options::index opts{};
+            opts.name(name);
+            opts.unique(index.unique);
+
+            if(index.ttl) {
+                opts.expire_after(std::chrono::seconds(0));
+            }
+
+            db[index.collection].create_index(keys.view(), opts);
+            logger->info(l_id, "created missing index " + full_name);
+        } catch (const std::exception& ex) {
+            logger->err(l_id, "missing index " + full_name + ": " + string(ex.what()));
+            all_present = false;
+        } catch (...) {
+            logger->err(l_id, "missing index " + full_name + ": unknown error");
+            all_present = false;
+        }
+    }
+
+    for(auto& index: DB_OLD_INDEXES) {
+        string full_name = string(index.first) + "." + index.second;
+
+        try {
+            for(auto&& doc: db[index.first].list_indexes()) {
+                auto el = doc["name"];
+                if(el && bsoncxx::string::to_string(el.get_utf8().value) == index.second) {
+                    db.run_command(make_document(kvp("dropIndexes", index.first), kvp("index", index.second)));
+                    logger->info(l_id, "dropped obsolete index " + full_name);
+                    break;
+                }
+            }
+        } catch (const std::exception& ex) {
+            logger->warn(l_id, "couldn't drop obsolete index " + full_name + ": " + string(ex.what()));
+        } catch (...) {
+            logger->warn(l_id, "couldn't drop obsolete index " + full_name + ": unknown error");
+        }
+    }
+
+    return all_present;
+}
+
+bool Database::addPathKeys() {
+    ScopedClient client(*this);
+    mongocxx::database db = client.database();
+    uint64_t updated = 0;
+
+    mongocxx::options::find opts{};
+    opts.projection(make_document(kvp("filename", 1)));
+
+    try {
+        // no index serves the filter below, so files are scanned only until the first complete run is recorded
+        if(db[DB_MIGRATIONS].find_one(make_document(kvp("_id", DB_MIGRATION_PATH_KEYS)))) {
+            return true;
+        }
+
+        auto cursor = db["files"].find(make_document(kvp("parent", make_document(kvp("$exists", false)))), opts);
+
+        for(auto doc: cursor) {
+            bsoncxx::document::element filename = doc["filename"];
+
+            if(!filename || filename.type() != bsoncxx::type::k_utf8) {
+                continue;
+            }
+
+            string parent, name;
+            splitPath(bsoncxx::string::to_string(filename.get_utf8().value), parent, name);
+
+            db["files"].update_one(make_document(kvp("_id", doc["_id"].get_oid())),
+                                   make_document(kvp("$set", make_document(kvp("parent", parent), kvp("name", name)))));
+            updated++;
+        }
+
+        db[DB_MIGRATIONS].insert_one(make_document(kvp("_id", DB_MIGRATION_PATH_KEYS), kvp("date", bsoncxx::types::b_date(chrono::system_clock::now()))));
+    } catch (const std::exception& ex) {
+        logger->err(l_id, "error while adding path keys: " + string(ex.what()));
+        return false;
+    } catch (...) {
+        logger->err(l_id, "error while adding path keys: unknown error");
+        return false;
+    }
+
+    if(updated > 0) {
+        logger->info(l_id, "added parent and name to " + to_string(updated) + " files");
+    }
+
+    return true;
+}
+
+void Database::getPoolStats(db_pool_stats& stats) {
+    stats.max_clients = max_clients;
+    stats.in_use = (uint64_t) max(in_use.load(memory_order_relaxed), (int64_t) 0);
+    stats.acquired = acquired.load(memory_order_relaxed);
+    stats.wait_us = wait_us.load(memory_order_relaxed);
+    stats.max_wait_us = max_wait_us.load(memory_order_relaxed);
+}
+
+Database::ScopedClient::ScopedClient(Database& owner): owner(owner) {
+    if(thread_client != nullptr) {
+        return;
+    }
+
+    auto start = chrono::steady_clock::now();
+    entry = owner.pool->acquire();
+    uint64_t us = (uint64_t) chrono::duration_cast<chrono::microseconds>(chrono::steady_clock::now() - start).count();
+
+    owner.acquired.fetch_add(1, memory_order_relaxed);
+    owner.wait_us.fetch_add(us, memory_order_relaxed);
+    owner.in_use.fetch_add(1, memory_order_relaxed);
+
+    uint64_t max_us = owner.max_wait_us.load(memory_order_relaxed);
+    while(us > max_us && !owner.max_wait_us.compare_exchange_weak(max_us, us, memory_order_relaxed)) {}
+
+    thread_client = entry.get();
+}
+
+Database::ScopedClient::~ScopedClient() {
+    if(entry) {
+        thread_client = nullptr;
+        owner.in_use.fetch_sub(1, memory_order_relaxed);
+    }
+}
+
+mongocxx::database Database::ScopedClient::database() {
+    return (*thread_client)[DB_NAME];
 }
 
 bool Database::getField(string& colName, string& fieldName, bsoncxx::oid id, bsoncxx::document::element& el) {
+    TRACE_SPAN_DETAIL(TRACE_DB, __func__, colName);
+
+    ScopedClient client(*this);
+    mongocxx::database db = client.database();
+
     mongocxx::options::find opts{};
     opts.projection(make_document(kvp(fieldName, 1), kvp("_id", 0)));
 
@@ -41,7 +245,7 @@ bool Database::getField(string& colName, string& fieldName, bsoncxx::oid id, bso
         auto doc_i = cursor.begin();
 
         if (doc_i == cursor.end() || doc_i->empty()) {
-            logger->log(l_id, "getField got empty resultSet");
+            LOG_DEBUG(logger, l_id, "getField got empty resultSet");
             return false;
         }
 
@@ -52,7 +256,7 @@ bool Database::getField(string& colName, string& fieldName, bsoncxx::oid id, bso
             return true;
         }
 
-        logger->log(l_id, "getField got invalid field");
+        LOG_DEBUG(logger, l_id, "getField got invalid field");
         return false;
     } catch (const std::exception& ex) {
         logger->err(l_id, "error while getting field: " + string(ex.what()));
@@ -64,10 +268,14 @@ bool Database::getField(string& colName, string& fieldName, bsoncxx::oid id, bso
 }
 
 bool Database::getField(string&& colName, string&& fieldName, bsoncxx::oid id, bsoncxx::document::element& el) {
+    TRACE_SPAN_DETAIL(TRACE_DB, __func__, colName);
+
     return getField(colName, fieldName, id, el);
 }
 
 bool Database::getField(string&& colName, string&& fieldName, bsoncxx::oid id, string& res) {
+    TRACE_SPAN_DETAIL(TRACE_DB, __func__, colName);
+
     bsoncxx::document::element el;
 
     if(getField(colName, fieldName, id, el)) {
@@ -75,7 +283,7 @@ bool Database::getField(string&& colName, string&& fieldName, bsoncxx::oid id, s
             res = bsoncxx::string::to_string(el.get_utf8().value);
             return true;
         } else {
-            logger->log(l_id, "getField got invalid field type (should be k_utf8)");
+            LOG_DEBUG(logger, l_id, "getField got invalid field type (should be k_utf8)");
         }
     }
 
@@ -83,6 +291,8 @@ bool Database::getField(string&& colName, string&& fieldName, bsoncxx::oid id, s
 }
 
 bool Database::getField(string&& colName, string&& fieldName, bsoncxx::oid id, int64_t& res) {
+    TRACE_SPAN_DETAIL(TRACE_DB, __func__, colName);
+
     bsoncxx::document::element el;
 
     if(getField(colName, fieldName, id, el)) {
@@ -90,7 +300,7 @@ bool Database::getField(string&& colName, string&& fieldName, bsoncxx::oid id, i
             res = el.get_int64().value;
             return true;
         } else {
-            logger->log(l_id, "getField got invalid field type (should be k_int64)");
+            LOG_DEBUG(logger, l_id, "getField got invalid field type (should be k_int64)");
         }
     }
 
@@ -98,6 +308,8 @@ bool Database::getField(string&& colName, string&& fieldName, bsoncxx::oid id, i
 }
 
 bool Database::getField(string&& colName, string&& fieldName, bsoncxx::oid id, const uint8_t*& res, uint32_t& resSize) {
+    TRACE_SPAN_DETAIL(TRACE_DB, __func__, colName);
+
     bsoncxx::document::element el;
 
     if(getField(colName, fieldName, id, el)) {
@@ -106,7 +318,7 @@ bool Database::getField(string&& colName, string&& fieldName, bsoncxx::oid id, c
             resSize = el.get_binary().size;
             return true;
         } else {
-            logger->log(l_id, "getField got invalid field type (should be k_binary)");
+            LOG_DEBUG(logger, l_id, "getField got invalid field type (should be k_binary)");
         }
     }
 
@@ -115,6 +327,10 @@ bool Database::getField(string&& colName, string&& fieldName, bsoncxx::oid id, c
 
 bool Database::getField(string&& colName, string&& fieldToGetName, string&& idFieldName, bsoncxx::oid& id,
                         string&& fieldName, const string& fieldVal, int64_t& res) {
+    TRACE_SPAN_DETAIL(TRACE_DB, __func__, colName);
+
+    ScopedClient client(*this);
+    mongocxx::database db = client.database();
 
     mongocxx::options::find opts{};
     opts.projection(make_document(kvp("_id", 0), kvp(fieldToGetName, 1)));
@@ -125,7 +341,7 @@ bool Database::getField(string&& colName, string&& fieldToGetName, string&& idFi
         auto doc_i = cursor.begin();
 
         if (doc_i == cursor.end() || doc_i->empty()) {
-            logger->log(l_id, "getField (2) got empty resultSet");
+            LOG_DEBUG(logger, l_id, "getField (2) got empty resultSet");
             return false;
         }
 
@@ -136,7 +352,7 @@ bool Database::getField(string&& colName, string&& fieldToGetName, string&& idFi
             return true;
         }
 
-        logger->log(l_id, "getField (2) got invalid field");
+        LOG_DEBUG(logger, l_id, "getField (2) got invalid field");
         return false;
     } catch (const std::exception& ex) {
         logger->err(l_id, "error while getting field (2): " + string(ex.what()));
@@ -148,6 +364,11 @@ bool Database::getField(string&& colName, string&& fieldToGetName, string&& idFi
 }
 
 bool Database::getFieldM(string&& colName, string&& fieldName, bsoncxx::document::value&& fDoc, std::vector<string>& res) {
+    TRACE_SPAN_DETAIL(TRACE_DB, __func__, colName);
+
+    ScopedClient client(*this);
+    mongocxx::database db = client.database();
+
     auto doc = bsoncxx::builder::basic::document{};
     doc.append(kvp("_id", 0));
     doc.append(kvp(fieldName, 1));
@@ -166,7 +387,7 @@ bool Database::getFieldM(string&& colName, string&& fieldName, bsoncxx::document
             auto obj = doc_v.begin();
 
             if (distance(obj, doc_v.end()) != 1) {
-                logger->log(l_id, "getFieldM got too much fields");
+                LOG_DEBUG(logger, l_id, "getFieldM got too much fields");
                 return false;
             }
 
@@ -174,7 +395,7 @@ bool Database::getFieldM(string&& colName, string&& fieldName, bsoncxx::document
         }
 
         if(!notEmpty) {
-            logger->log(l_id, "getFieldM got empty result");
+            LOG_DEBUG(logger, l_id, "getFieldM got empty result");
         }
 
         return true;
@@ -188,6 +409,11 @@ bool Database::getFieldM(string&& colName, string&& fieldName, bsoncxx::document
 }
 
 bool Database::getFieldMAdvanced(string&& colName, string&& fieldName, mongocxx::pipeline& stages, std::vector<string>& res) {
+    TRACE_SPAN_DETAIL(TRACE_DB, __func__, colName);
+
+    ScopedClient client(*this);
+    mongocxx::database db = client.database();
+
     stages.project(make_document(kvp("_id", 0), kvp(fieldName, 1)));
 
     try {
@@ -201,7 +427,7 @@ bool Database::getFieldMAdvanced(string&& colName, string&& fieldName, mongocxx:
             auto obj = doc_v.begin();
 
             if (distance(obj, doc_v.end()) != 1) {
-                logger->log(l_id, "getFieldMAdvanced got too much fields");
+                LOG_DEBUG(logger, l_id, "getFieldMAdvanced got too much fields");
                 return false;
             }
 
@@ -209,7 +435,7 @@ bool Database::getFieldMAdvanced(string&& colName, string&& fieldName, mongocxx:
         }
 
         if(!notEmpty) {
-            logger->log(l_id, "getFieldMAdvanced got empty result");
+            LOG_DEBUG(logger, l_id, "getFieldMAdvanced got empty result");
         }
 
         return true;
@@ -223,6 +449,11 @@ bool Database::getFieldMAdvanced(string&& colName, string&& fieldName, mongocxx:
 }
 
 bool Database::getId(string&& colName, string&& fieldName, const string& fieldValue, bsoncxx::oid& id) {
+    TRACE_SPAN_DETAIL(TRACE_DB, __func__, colName);
+
+    ScopedClient client(*this);
+    mongocxx::database db = client.database();
+
     mongocxx::options::find opts{};
     opts.projection(make_document(kvp("_id", 1)));
 
@@ -232,7 +463,7 @@ bool Database::getId(string&& colName, string&& fieldName, const string& fieldVa
         auto doc_i = cursor.begin();
 
         if (doc_i == cursor.end() || doc_i->empty()) {
-            logger->log(l_id, "getId got empty resultSet");
+            LOG_DEBUG(logger, l_id, "getId got empty resultSet");
             return false;
         }
 
@@ -243,7 +474,7 @@ bool Database::getId(string&& colName, string&& fieldName, const string& fieldVa
             return true;
         }
 
-        logger->log(l_id, "getId got invalid field type (should be k_oid)");
+        LOG_DEBUG(logger, l_id, "getId got invalid field type (should be k_oid)");
         return false;
     } catch (const std::exception& ex) {
         logger->err(l_id, "error while getting id: " + string(ex.what()));
@@ -255,6 +486,11 @@ bool Database::getId(string&& colName, string&& fieldName, const string& fieldVa
 }
 
 bool Database::getIdById(string&& colName, string&& fieldName, const string& fieldValue, string&& idFieldName, bsoncxx::oid& id) {
+    TRACE_SPAN_DETAIL(TRACE_DB, __func__, colName);
+
+    ScopedClient client(*this);
+    mongocxx::database db = client.database();
+
     mongocxx::options::find opts{};
     opts.projection(make_document(kvp("_id", 1)));
 
@@ -264,7 +500,7 @@ bool Database::getIdById(string&& colName, string&& fieldName, const string& fie
         auto doc_i = cursor.begin();
 
         if (doc_i == cursor.end() || doc_i->empty()) {
-            logger->log(l_id, "getIdById got empty resultSet");
+            LOG_DEBUG(logger, l_id, "getIdById got empty resultSet");
             return false;
         }
 
@@ -275,7 +511,7 @@ bool Database::getIdById(string&& colName, string&& fieldName, const string& fie
             return true;
         }
 
-        logger->log(l_id, "getIdById got invalid field type (should be k_oid)");
+        LOG_DEBUG(logger, l_id, "getIdById got invalid field type (should be k_oid)");
         return false;
     } catch (const std::exception& ex) {
         logger->err(l_id, "error while getting id by id: " + string(ex.what()));
@@ -287,6 +523,11 @@ bool Database::getIdById(string&& colName, string&& fieldName, const string& fie
 }
 
 bool Database::getIdByDoc(string&& colName, bsoncxx::document::value&& doc, bsoncxx::oid& res) {
+    TRACE_SPAN_DETAIL(TRACE_DB, __func__, colName);
+
+    ScopedClient client(*this);
+    mongocxx::database db = client.database();
+
     mongocxx::options::find opts{};
     opts.projection(make_document(kvp("_id", 1)));
 
@@ -296,7 +537,7 @@ bool Database::getIdByDoc(string&& colName, bsoncxx::document::value&& doc, bson
         auto doc_i = cursor.begin();
 
         if (doc_i == cursor.end() || doc_i->empty()) {
-            logger->log(l_id, "getIdByDoc got empty resultSet");
+            LOG_DEBUG(logger, l_id, "getIdByDoc got empty resultSet");
             return false;
         }
 
@@ -307,7 +548,7 @@ bool Database::getIdByDoc(string&& colName, bsoncxx::document::value&& doc, bson
             return true;
         }
 
-        logger->log(l_id, "getIdByDoc got invalid field type (should be k_oid)");
+        LOG_DEBUG(logger, l_id, "getIdByDoc got invalid field type (should be k_oid)");
         return false;
     } catch (const std::exception& ex) {
         logger->err(l_id, "error while getting id by doc: " + string(ex.what()));
@@ -320,6 +561,11 @@ bool Database::getIdByDoc(string&& colName, bsoncxx::document::value&& doc, bson
 
 // get fields values described in map
 bool Database::getFields(string&& colName, bsoncxx::oid id, map<string, bsoncxx::types::value>& elements) {
+    TRACE_SPAN_DETAIL(TRACE_DB, __func__, colName);
+
+    ScopedClient client(*this);
+    mongocxx::database db = client.database();
+
     auto doc = bsoncxx::builder::basic::document{};
     doc.append(kvp("_id", 0));
 
@@ -336,12 +582,12 @@ bool Database::getFields(string&& colName, bsoncxx::oid id, map<string, bsoncxx:
         auto doc_i = cursor.begin();
 
         if (doc_i == cursor.end() || doc_i->empty()) {
-            logger->log(l_id, "getFields got empty resultSet");
+            LOG_DEBUG(logger, l_id, "getFields got empty resultSet");
             return false;
         }
 
         if (distance(doc_i->begin(), doc_i->end()) != elements.size()) {
-            logger->log(l_id, "getFields got invalid element count");
+            LOG_DEBUG(logger, l_id, "getFields got invalid element count");
             return false;
         }
 
@@ -364,6 +610,11 @@ bool Database::getFields(string&& colName, bsoncxx::oid id, map<string, bsoncxx:
 }
 
 bool Database::getFields(string&& colName, vector<string>& fields, map<bsoncxx::oid, map<string, bsoncxx::types::value> >& elements) {
+    TRACE_SPAN_DETAIL(TRACE_DB, __func__, colName);
+
+    ScopedClient client(*this);
+    mongocxx::database db = client.database();
+
     auto doc = bsoncxx::builder::basic::document{};
 
     for(const auto &name: fields) {
@@ -383,15 +634,15 @@ bool Database::getFields(string&& colName, vector<string>& fields, map<bsoncxx::
 
             //TODO check if id was passed as field
             if ((distance(doc_v.begin(), doc_v.end()) != fields.size() + 1) && (distance(doc_v.begin(), doc_v.end()) != fields.size()) && (distance(doc_v.begin(), doc_v.end()) != fields.size() - 1)) {
-                logger->log(l_id, std::to_string(distance(doc_v.begin(), doc_v.end())) + " != " + std::to_string(fields.size()));
-                logger->log(l_id, "getFields got invalid fields count");
+                LOG_DEBUG(logger, l_id, std::to_string(distance(doc_v.begin(), doc_v.end())) + " != " + std::to_string(fields.size()));
+                LOG_DEBUG(logger, l_id, "getFields got invalid fields count");
                 return false;
             }
 
             bsoncxx::document::element t_id = doc_v["_id"];
 
             if (!t_id || t_id.type() != bsoncxx::type::k_oid) {
-                logger->log(l_id, "getFields got invalid _id field");
+                LOG_DEBUG(logger, l_id, "getFields got invalid _id field");
                 return false;
             }
 
@@ -408,7 +659,7 @@ bool Database::getFields(string&& colName, vector<string>& fields, map<bsoncxx::
         }
 
         if(!notEmpty) {
-            logger->log(l_id, "getFields got empty result");
+            LOG_DEBUG(logger, l_id, "getFields got empty result");
         }
 
         return notEmpty;
@@ -422,6 +673,11 @@ bool Database::getFields(string&& colName, vector<string>& fields, map<bsoncxx::
 }
 
 bool Database::getFields(string&& colName, bsoncxx::document::value&& doc, const vector<string>& fields, map<string, map<string, bsoncxx::types::value> >& elements) {
+    TRACE_SPAN_DETAIL(TRACE_DB, __func__, colName);
+
+    ScopedClient client(*this);
+    mongocxx::database db = client.database();
+
     auto odoc = bsoncxx::builder::basic::document{};
 
     for(const auto &name: fields) {
@@ -441,14 +697,14 @@ bool Database::getFields(string&& colName, bsoncxx::document::value&& doc, const
 
             //TODO check if id was passed as field
             if (distance(doc_v.begin(), doc_v.end()) != fields.size() + 1) {
-                logger->log(l_id, "getFields got invalid fields count");
+                LOG_DEBUG(logger, l_id, "getFields got invalid fields count");
                 return false;
             }
 
             bsoncxx::document::element t_id = doc_v["filename"];
 
             if (!t_id || t_id.type() != bsoncxx::type::k_utf8) {
-                logger->log(l_id, "getFields got invalid filename field");
+                LOG_DEBUG(logger, l_id, "getFields got invalid filename field");
                 return false;
             }
 
@@ -463,7 +719,7 @@ bool Database::getFields(string&& colName, bsoncxx::document::value&& doc, const
         }
 
         if(!notEmpty) {
-            logger->log(l_id, "getFields got empty result");
+            LOG_DEBUG(logger, l_id, "getFields got empty result");
         }
 
         return notEmpty;
@@ -477,6 +733,11 @@ bool Database::getFields(string&& colName, bsoncxx::document::value&& doc, const
 }
 
 bool Database::getFieldsAdvanced(string&& colName, mongocxx::pipeline& stages, vector<string>& fields, map<string, map<string, bsoncxx::types::value> >& elements) {
+    TRACE_SPAN_DETAIL(TRACE_DB, __func__, colName);
+
+    ScopedClient client(*this);
+    mongocxx::database db = client.database();
+
     auto odoc = bsoncxx::builder::basic::document{};
 
     for(const auto &name: fields) {
@@ -495,15 +756,15 @@ bool Database::getFieldsAdvanced(string&& colName, mongocxx::pipeline& stages, v
 
             //TODO check if id was passed as field
             if ((distance(doc_v.begin(), doc_v.end()) != fields.size() - 1) && (distance(doc_v.begin(), doc_v.end()) != fields.size())) {
-                logger->log(l_id, "getFieldsAdvanced got invalid fields count");
-                logger->log(l_id, std::to_string(distance(doc_v.begin(), doc_v.end())) + " != " + std::to_string(fields.size()));
+                LOG_DEBUG(logger, l_id, "getFieldsAdvanced got invalid fields count");
+                LOG_DEBUG(logger, l_id, std::to_string(distance(doc_v.begin(), doc_v.end())) + " != " + std::to_string(fields.size()));
                 return false;
             }
 
             bsoncxx::document::element t_id = doc_v["filename"];
 
             if (!t_id || t_id.type() != bsoncxx::type::k_utf8) {
-                logger->log(l_id, "getFieldsAdvanced got invalid filename field");
+                LOG_DEBUG(logger, l_id, "getFieldsAdvanced got invalid filename field");
                 return false;
             }
 
@@ -518,7 +779,7 @@ bool Database::getFieldsAdvanced(string&& colName, mongocxx::pipeline& stages, v
         }
 
         if(!notEmpty) {
-            logger->log(l_id, "getFieldsAdvanced got empty result");
+            LOG_DEBUG(logger, l_id, "getFieldsAdvanced got empty result");
         }
 
         return true;
@@ -532,6 +793,11 @@ bool Database::getFieldsAdvanced(string&& colName, mongocxx::pipeline& stages, v
 }
 
 bool Database::setField(string& colName, string& fieldName, bsoncxx::oid id, bsoncxx::types::value& val) {
+    TRACE_SPAN_DETAIL(TRACE_DB, __func__, colName);
+
+    ScopedClient client(*this);
+    mongocxx::database db = client.database();
+
     try {
         db[colName].update_one(make_document(kvp("_id", id)),
                                make_document(kvp("$set", make_document(kvp(fieldName, val)))));
@@ -547,18 +813,26 @@ bool Database::setField(string& colName, string& fieldName, bsoncxx::oid id, bso
 }
 
 bool Database::setField(string& colName, string& fieldName, bsoncxx::oid id, bsoncxx::types::value&& val) {
+    TRACE_SPAN_DETAIL(TRACE_DB, __func__, colName);
+
     return setField(colName, fieldName, id, val);
 }
 
 bool Database::setField(string&& colName, string&& fieldName, bsoncxx::oid id, bsoncxx::types::value&& val) {
+    TRACE_SPAN_DETAIL(TRACE_DB, __func__, colName);
+
     return setField(colName, fieldName, id, val);
 }
 
 bool Database::setField(string&& colName, string&& fieldName, bsoncxx::oid id, string& newVal) {
+    TRACE_SPAN_DETAIL(TRACE_DB, __func__, colName);
+
     return setField(colName, fieldName, id, bsoncxx::types::value{bsoncxx::types::b_utf8{newVal}});
 }
 
 bool Database::setField(string&& colName, string&& fieldName, bsoncxx::oid id, const uint8_t* newVal, uint32_t newValSize) {
+    TRACE_SPAN_DETAIL(TRACE_DB, __func__, colName);
+
     bsoncxx::types::b_binary b_val{};
     b_val.bytes = newVal;
     b_val.size = newValSize;
@@ -566,12 +840,16 @@ bool Database::setField(string&& colName, string&& fieldName, bsoncxx::oid id, c
 }
 
 bool Database::setField(string&& colName, string&& fieldName, bsoncxx::oid id, int64_t& newVal) {
+    TRACE_SPAN_DETAIL(TRACE_DB, __func__, colName);
+
     bsoncxx::types::b_int64 tmp{};
     tmp.value = newVal;
     return setField(colName, fieldName, id, bsoncxx::types::value{tmp});
 }
 
 bool Database::setFieldCurrentDate(string&& colName, string&& fieldName, bsoncxx::oid id, std::chrono::system_clock::time_point& returnVal) {
+    TRACE_SPAN_DETAIL(TRACE_DB, __func__, colName);
+
     bsoncxx::types::b_date tmp{std::chrono::system_clock::now()};
     if(setField(colName, fieldName, id, bsoncxx::types::value{tmp})) {
         returnVal = tmp;
@@ -582,6 +860,8 @@ bool Database::setFieldCurrentDate(string&& colName, string&& fieldName, bsoncxx
 }
 
 bool Database::setField(string&& colName, string&& fieldName, bsoncxx::oid id, bool newVal) {
+    TRACE_SPAN_DETAIL(TRACE_DB, __func__, colName);
+
     bsoncxx::types::b_bool tmp{};
     tmp.value = newVal;
     return setField(colName, fieldName, id, bsoncxx::types::value{tmp});
@@ -589,6 +869,11 @@ bool Database::setField(string&& colName, string&& fieldName, bsoncxx::oid id, b
 
 bool Database::incField(string&& colName, string&& fieldName, string&& idFieldName, bsoncxx::oid& id,
                         string&& matchFieldName, string& matchFieldVal, int64_t diff) {
+    TRACE_SPAN_DETAIL(TRACE_DB, __func__, colName);
+
+    ScopedClient client(*this);
+    mongocxx::database db = client.database();
+
     try {
         db[colName].update_one(make_document(kvp(idFieldName, id), kvp(matchFieldName, matchFieldVal)),
                                make_document(kvp("$inc", make_document(kvp(fieldName, diff)))));
@@ -604,6 +889,11 @@ bool Database::incField(string&& colName, string&& fieldName, string&& idFieldNa
 }
 
 bool Database::incField(string&& colName, bsoncxx::oid& id, string&& incField, int64_t incVal = 1) {
+    TRACE_SPAN_DETAIL(TRACE_DB, __func__, colName);
+
+    ScopedClient client(*this);
+    mongocxx::database db = client.database();
+
     try {
         db[colName].update_one(make_document(kvp("_id", id)),
                                make_document(kvp("$inc", make_document(kvp(incField, incVal)))));
@@ -619,6 +909,11 @@ bool Database::incField(string&& colName, bsoncxx::oid& id, string&& incField, i
 }
 
 bool Database::countField(string&& colName, string&& fieldName, bsoncxx::oid id, const uint8_t* valToCheck, uint32_t valSize, uint64_t& res) {
+    TRACE_SPAN_DETAIL(TRACE_DB, __func__, colName);
+
+    ScopedClient client(*this);
+    mongocxx::database db = client.database();
+
     bsoncxx::types::b_binary b_val{};
     b_val.bytes = valToCheck;
     b_val.size = valSize;
@@ -636,6 +931,11 @@ bool Database::countField(string&& colName, string&& fieldName, bsoncxx::oid id,
 }
 
 bool Database::countField(string&& colName, string&& fieldName, const string& fieldVal, string&& idFieldName, bsoncxx::oid id, uint64_t& res) {
+    TRACE_SPAN_DETAIL(TRACE_DB, __func__, colName);
+
+    ScopedClient client(*this);
+    mongocxx::database db = client.database();
+
     try {
         res = (uint64_t) db[colName].count(make_document(kvp(idFieldName, id), kvp(fieldName, fieldVal)));
         return true;
@@ -649,6 +949,11 @@ bool Database::countField(string&& colName, string&& fieldName, const string& fi
 }
 
 bool Database::countField(string&& colName, string&& fieldName, const string& fieldVal, uint64_t& res) {
+    TRACE_SPAN_DETAIL(TRACE_DB, __func__, colName);
+
+    ScopedClient client(*this);
+    mongocxx::database db = client.database();
+
     try {
         res = (uint64_t) db[colName].count(make_document(kvp(fieldName, fieldVal)));
         return true;
@@ -662,6 +967,11 @@ bool Database::countField(string&& colName, string&& fieldName, const string& fi
 }
 
 bool Database::removeFieldFromArray(string&& colName, string&& arrayName, bsoncxx::oid id, bsoncxx::document::value&& val) {
+    TRACE_SPAN_DETAIL(TRACE_DB, __func__, colName);
+
+    ScopedClient client(*this);
+    mongocxx::database db = client.database();
+
     try {
         db[colName].update_one(make_document(kvp("_id", id)),
                                make_document(kvp("$pull", make_document(kvp(arrayName, val)))));
@@ -677,6 +987,11 @@ bool Database::removeFieldFromArray(string&& colName, string&& arrayName, bsoncx
 }
 
 bool Database::removeFieldFromArrays(string&& colName, string&& arrayName, string&& fieldName, bsoncxx::types::value&& val) {
+    TRACE_SPAN_DETAIL(TRACE_DB, __func__, colName);
+
+    ScopedClient client(*this);
+    mongocxx::database db = client.database();
+
     string fullName = arrayName + "." + fieldName;
     try {
         db[colName].update_many(make_document(kvp(fullName, val)),
@@ -693,6 +1008,11 @@ bool Database::removeFieldFromArrays(string&& colName, string&& arrayName, strin
 }
 
 bool Database::pushValToArr(string&& colName, string&& arrayName, bsoncxx::oid id, bsoncxx::document::value&& val) {
+    TRACE_SPAN_DETAIL(TRACE_DB, __func__, colName);
+
+    ScopedClient client(*this);
+    mongocxx::database db = client.database();
+
     try {
         db[colName].update_one(make_document(kvp("_id", id)),
                                make_document(kvp("$push", make_document(kvp(arrayName, val)))));
@@ -708,16 +1028,21 @@ bool Database::pushValToArr(string&& colName, string&& arrayName, bsoncxx::oid i
 }
 
 bool Database::insertDoc(string&& colName, bsoncxx::oid& id, bsoncxx::builder::basic::document& doc) {
+    TRACE_SPAN_DETAIL(TRACE_DB, __func__, colName);
+
+    ScopedClient client(*this);
+    mongocxx::database db = client.database();
+
     try {
         auto res = db[colName].insert_one(doc.view());
 
         if(!res) {
-            logger->log(l_id, "insertDoc failed while inserting");
+            LOG_DEBUG(logger, l_id, "insertDoc failed while inserting");
             return false;
         }
 
         if (res->inserted_id().type() != bsoncxx::type::k_oid) {
-            logger->log(l_id, "insertDoc hasn't got inserted id");
+            LOG_DEBUG(logger, l_id, "insertDoc hasn't got inserted id");
             return false;
         }
 
@@ -739,7 +1064,25 @@ bsoncxx::types::b_binary Database::stringToBinary(const string& str) {
     return b_sid;
 }
 
+void Database::splitPath(const string& path, string& parent, string& name) {
+    size_t slash = path.rfind('/');
+
+    if(slash == string::npos) {
+        parent.clear();
+        name = path;
+        return;
+    }
+
+    parent = slash == 0 ? "/" : path.substr(0, slash);
+    name = path.substr(slash + 1);
+}
+
 bool Database::removeByOid(string&& colName, string&& fieldName, bsoncxx::oid& fieldValue) {
+    TRACE_SPAN_DETAIL(TRACE_DB, __func__, colName);
+
+    ScopedClient client(*this);
+    mongocxx::database db = client.database();
+
     try {
         db[colName].delete_many(make_document(kvp(fieldName, fieldValue)));
     } catch (const std::exception& ex) {
@@ -754,6 +1097,11 @@ bool Database::removeByOid(string&& colName, string&& fieldName, bsoncxx::oid& f
 }
 
 bool Database::sumFieldAdvanced(string&& colName, string&& resFieldName, mongocxx::pipeline& stages, uint64_t& res) {
+    TRACE_SPAN_DETAIL(TRACE_DB, __func__, colName);
+
+    ScopedClient client(*this);
+    mongocxx::database db = client.database();
+
     stages.project(make_document(kvp(resFieldName, 1)));
 
     try {
@@ -762,7 +1110,7 @@ bool Database::sumFieldAdvanced(string&& colName, string&& resFieldName, mongocx
         auto doc_i = cursor.begin();
 
         if (doc_i == cursor.end() || doc_i->empty()) {
-            logger->log(l_id, "sumFieldAdvanced got empty resultSet");
+            LOG_DEBUG(logger, l_id, "sumFieldAdvanced got empty resultSet");
             res = 0;
             return true; // !!
         }
@@ -785,6 +1133,11 @@ bool Database::sumFieldAdvanced(string&& colName, string&& resFieldName, mongocx
 }
 
 bool Database::deleteDocs(string&& colName, bsoncxx::document::value&& doc) {
+    TRACE_SPAN_DETAIL(TRACE_DB, __func__, colName);
+
+    ScopedClient client(*this);
+    mongocxx::database db = client.database();
+
     try {
        db[colName].delete_many(doc.view());
        return true;
@@ -795,4 +1148,55 @@ bool Database::deleteDocs(string&& colName, bsoncxx::document::value&& doc) {
         logger->err(l_id, "error while summing field: unknown error");
         return false;
     }
-}
\ No newline at end of file
+}
+
+bool Database::unsetField(string&& colName, bsoncxx::document::value&& doc, string&& fieldName) {
+    TRACE_SPAN_DETAIL(TRACE_DB, __func__, colName);
+
+    ScopedClient client(*this);
+    mongocxx::database db = client.database();
+
+    try {
+        db[colName].update_many(doc.view(), make_document(kvp("$unset", make_document(kvp(fieldName, "")))));
+        return true;
+    } catch (const std::exception& ex) {
+        logger->err(l_id, "error while unsetting field: " + string(ex.what()));
+        return false;
+    } catch (...) {
+        logger->err(l_id, "error while unsetting field: unknown error");
+        return false;
+    }
+}
+
+bool Database::forEachDoc(string&& colName, bsoncxx::document::value&& doc, const vector<string>& fields,
+                          const function<void(const bsoncxx::document::view&)>& callback) {
+    TRACE_SPAN_DETAIL(TRACE_DB, __func__, colName);
+
+    ScopedClient client(*this);
+    mongocxx::database db = client.database();
+
+    auto odoc = bsoncxx::builder::basic::document{};
+
+    for(const auto &name: fields) {
+        odoc.append(kvp(name, 1));
+    }
+
+    mongocxx::options::find opts{};
+    opts.projection(odoc.view());
+
+    try {
+        auto cursor = db[colName].find(doc.view(), opts);
+
+        for(auto doc_v: cursor) {
+            callback(doc_v);
+        }
+
+        return true;
+    } catch (const std::exception& ex) {
+        logger->err(l_id, "error while iterating documents: " + string(ex.what()));
+        return false;
+    } catch (...) {
+        logger->err(l_id, "error while iterating documents: unknown error");
+        return false;
+    }
+}
@@ -3,6 +3,9 @@
 
 #include "main.h"
 #include "Logger.h"
+#include "Trace.h"
+
+#include <functional>
 
 #include <mongocxx/instance.hpp>
 #include <mongocxx/uri.hpp>
@@ -24,27 +27,79 @@
 
 #include <mongocxx/client.hpp>
 #include <mongocxx/instance.hpp>
+#include <mongocxx/pool.hpp>
 
 
 #define DB_URI "mongodb://localhost:27017"
 #define DB_NAME "tin"
+// maxPoolSize of the driver when none is given
+#define DB_DEFAULT_POOL_SIZE 100
+
+// one document per finished startup migration, keyed by its name
+#define DB_MIGRATIONS "migrations"
+#define DB_MIGRATION_PATH_KEYS "filesPathKeys"
+
+// index the queries of UserManager rely on, created at startup when missing
+struct db_index {
+    const char* collection;
+    std::vector<std::pair<const char*, int> > keys;
+    bool unique;
+    // documents are removed by the server once the date in the only key has passed
+    bool ttl;
+};
+
+struct db_pool_stats {
+    uint64_t max_clients;
+    uint64_t in_use;
+    uint64_t acquired;
+    uint64_t wait_us;
+    uint64_t max_wait_us;
+};
 
 using std::string;
 
 class Database {
 private:
-    mongocxx::client* client;
-    mongocxx::database db;
+    // client taken from the pool by the outermost operation of a thread, nested calls reuse it
+    class ScopedClient {
+    private:
+        Database& owner;
+        mongocxx::pool::entry entry;
+
+    public:
+        explicit ScopedClient(Database&);
+        ScopedClient(const ScopedClient&) = delete;
+        ~ScopedClient();
+
+        mongocxx::database database();
+    };
+
+    mongocxx::pool* pool;
     Logger* logger;
     std::string l_id = "DB";
     bool connected;
     mongocxx::instance* inst;
 
+    static thread_local mongocxx::client* thread_client;
+
+    uint64_t max_clients = 0;
+    std::atomic<int64_t> in_use{0};
+    std::atomic<uint64_t> acquired{0};
+    std::atomic<uint64_t> wait_us{0};
+    std::atomic<uint64_t> max_wait_us{0};
+
     bool getField(string&, string&, bsoncxx::oid, bsoncxx::document::element&);
     bool setField(string&, string&, bsoncxx::oid id, bsoncxx::types::value&);
 public:
     Database(Logger*);
     ~Database();
+    // 0 - driver default pool size
+    bool connect(unsigned);
+    // creates indexes from DB_INDEXES which don't exist yet and drops DB_OLD_INDEXES, false when some are still missing
+    bool ensureIndexes();
+    // fills parent and name of files stored before they were kept next to the filename, once per database
+    bool addPathKeys();
+    void getPoolStats(db_pool_stats&);
     bool getField(string&&, string&&, bsoncxx::oid, bsoncxx::document::element&);
     bool getField(string&&, string&&, bsoncxx::oid, string&);
     bool getField(string&&, string&&, bsoncxx::oid, int64_t&);
@@ -77,9 +132,15 @@ public:
     bool pushValToArr(string&&, string&&, bsoncxx::oid, bsoncxx::document::value&&);
     bool insertDoc(string&&, bsoncxx::oid&, bsoncxx::builder::basic::document&);
     static bsoncxx::types::b_binary stringToBinary(const string&);
+    // "/a/b" -> "/a" and "b", "/a" -> "/" and "a"
+    static void splitPath(const string&, string&, string&);
     bool removeByOid(string&&, string&&, bsoncxx::oid&);
     bool sumFieldAdvanced(string&&, string&&, mongocxx::pipeline&, uint64_t&);
     bool deleteDocs(string&&, bsoncxx::document::value&&);
+    bool unsetField(string&&, bsoncxx::document::value&&, string&&);
+    // views passed to the callback are valid only during the call
+    bool forEachDoc(string&&, bsoncxx::document::value&&, const std::vector<string>&,
+            const std::function<void(const bsoncxx::document::view&)>&);
 };
 
 #endif //SERVER_DATABASE_H
@@ -0,0 +1,506 @@
+#include "IoUring.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+
+using namespace std;
+
+#define TAG_WRITE 1
+#define TAG_READ_SYNC 9
+// read-ahead slots use TAG_READ + slot index
+#define TAG_READ 10
+#define TAG_RECV 20
+#define TAG_TIMEOUT 21
+#define TAG_SEND 22
+
+#ifdef HAVE_IO_URING
+
+#ifndef __NR_io_uring_setup
+#define __NR_io_uring_setup 425
+#endif
+#ifndef __NR_io_uring_enter
+#define __NR_io_uring_enter 426
+#endif
+#ifndef __NR_io_uring_register
+#define __NR_io_uring_register 427
+#endif
+
+IoUring::IoUring(unsigned entries) {
+    struct io_uring_params p;
+    memset(&p, 0, sizeof(p));
+
+    int fd = (int) syscall(__NR_io_uring_setup, entries, &p);
+    if(fd < 0) {
+        return;
+    }
+
+    sq_size = p.sq_off.array + p.sq_entries * sizeof(unsigned);
+    cq_size = p.cq_off.cqes + p.cq_entries * sizeof(struct io_uring_cqe);
+
+    if(p.features & IORING_FEAT_SINGLE_MMAP) {
+        sq_size = cq_size = max(sq_size, cq_size);
+    }
+
+    sq_ptr = mmap(nullptr, sq_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQ_RING);
+    if(sq_ptr == MAP_FAILED) {
+        sq_ptr = nullptr;
+        close(fd);
+        return;
+    }
+
+    if(p.features & IORING_FEAT_SINGLE_MMAP) {
+        cq_ptr = sq_ptr;
+    } else {
+        cq_ptr = mmap(nullptr, cq_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_CQ_RING);
+        if(cq_ptr == MAP_FAILED) {
+            cq_ptr = nullptr;
+            munmap(sq_ptr, sq_size);
+            sq_ptr = nullptr;
+            close(fd);
+            return;
+        }
+    }
+
+    sqes_size = p.sq_entries * sizeof(struct io_uring_sqe);
+    void* sqes_ptr = mmap(nullptr, sqes_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQES);
+    if(sqes_ptr == MAP_FAILED) {
+        if(cq_ptr != sq_ptr) {
+            munmap(cq_ptr, cq_size);
+        }
+        munmap(sq_ptr, sq_size);
+        sq_ptr = cq_ptr = nullptr;
+        close(fd);
+        return;
+    }
+
+    sqes = (struct io_uring_sqe*) sqes_ptr;
+    sq_entries = p.sq_entries;
+
+    sq_head = (unsigned*) ((char*) sq_ptr + p.sq_off.head);
+    sq_tail = (unsigned*) ((char*) sq_ptr + p.sq_off.tail);
+    sq_mask = (unsigned*) ((char*) sq_ptr + p.sq_off.ring_mask);
+    sq_array = (unsigned*) ((char*) sq_ptr + p.sq_off.array);
+    cq_head = (unsigned*) ((char*) cq_ptr + p.cq_off.head);
+    cq_tail = (unsigned*) ((char*) cq_ptr + p.cq_off.tail);
+    cq_mask = (unsigned*) ((char*) cq_ptr + p.cq_off.ring_mask);
+    cqes = (struct io_uring_cqe*) ((char*) cq_ptr + p.cq_off.cqes);
+
+    sq_local_tail = *sq_tail;
+    ring_fd = fd;
+}
+
+IoUring::~IoUring() {
+    if(ring_fd == -1) {
+        return;
+    }
+
+    munmap(sqes, sqes_size);
+    if(cq_ptr != sq_ptr) {
+        munmap(cq_ptr, cq_size);
+    }
+    munmap(sq_ptr, sq_size);
+    close(ring_fd);
+}
+
+bool IoUring::registerBuffers(const vector<iovec>& buffers) {
+    if(ring_fd == -1 || buffers_registered) {
+        return false;
+    }
+
+    buffers_registered = (syscall(__NR_io_uring_register, ring_fd, IORING_REGISTER_BUFFERS, buffers.data(), (unsigned) buffers.size()) == 0);
+    return buffers_registered;
+}
+
+struct io_uring_sqe* IoUring::getSqe() {
+    if(ring_fd == -1) {
+        return nullptr;
+    }
+
+    if(sq_local_tail - __atomic_load_n(sq_head, __ATOMIC_ACQUIRE) >= sq_entries) {
+        // queue full, hand queued entries to the kernel first
+        submit();
+        if(sq_local_tail - __atomic_load_n(sq_head, __ATOMIC_ACQUIRE) >= sq_entries) {
+            return nullptr;
+        }
+    }
+
+    unsigned idx = sq_local_tail & *sq_mask;
+    struct io_uring_sqe* sqe = &sqes[idx];
+    memset(sqe, 0, sizeof(*sqe));
+    sq_array[idx] = idx;
+    sq_local_tail++;
+    to_submit++;
+
+    return sqe;
+}
+
+bool IoUring::prepRead(int fd, void* buf, unsigned len, uint64_t offset, uint64_t tag, int buf_index) {
+    struct io_uring_sqe* sqe = getSqe();
+    if(sqe == nullptr) {
+        return false;
+    }
+
+    sqe->opcode = (buf_index >= 0 && buffers_registered) ? IORING_OP_READ_FIXED : IORING_OP_READ;
+    sqe->fd = fd;
+    sqe->addr = (uint64_t) buf;
+    sqe->len = len;
+    sqe->off = offset;
+    sqe->user_data = tag;
+    if(buf_index >= 0 && buffers_registered) {
+        sqe->buf_index = (uint16_t) buf_index;
+    }
+
+    return true;
+}
+
+bool IoUring::prepWrite(int fd, const void* buf, unsigned len, uint64_t offset, uint64_t tag, int buf_index) {
+    struct io_uring_sqe* sqe = getSqe();
+    if(sqe == nullptr) {
+        return false;
+    }
+
+    sqe->opcode = (buf_index >= 0 && buffers_registered) ? IORING_OP_WRITE_FIXED : IORING_OP_WRITE;
+    sqe->fd = fd;
+    sqe->addr = (uint64_t) buf;
+    sqe->len = len;
+    sqe->off = offset;
+    sqe->user_data = tag;
+    if(buf_index >= 0 && buffers_registered) {
+        sqe->buf_index = (uint16_t) buf_index;
+    }
+
+    return true;
+}
+
+bool IoUring::prepRecv(int sock, void* buf, unsigned len, uint64_t tag, bool link) {
+    struct io_uring_sqe* sqe = getSqe();
+    if(sqe == nullptr) {
+        return false;
+    }
+
+    sqe->opcode = IORING_OP_RECV;
+    sqe->fd = sock;
+    sqe->addr = (uint64_t) buf;
+    sqe->len = len;
+    sqe->user_data = tag;
+    if(link) {
+        sqe->flags |= IOSQE_IO_LINK;
+    }
+
+    return true;
+}
+
+bool IoUring::prepSend(int sock, const void* buf, unsigned len, uint64_t tag) {
+    struct io_uring_sqe* sqe = getSqe();
+    if(sqe == nullptr) {
+        return false;
+    }
+
+    sqe->opcode = IORING_OP_SEND;
+    sqe->fd = sock;
+    sqe->addr = (uint64_t) buf;
+    sqe->len = len;
+    sqe->msg_flags = MSG_NOSIGNAL;
+    sqe->user_data = tag;
+
+    return true;
+}
+
+bool IoUring::prepLinkTimeout(int timeout_ms, uint64_t tag) {
+    struct io_uring_sqe* sqe = getSqe();
+    if(sqe == nullptr) {
+        return false;
+    }
+
+    link_timeout.tv_sec = timeout_ms / 1000;
+    link_timeout.tv_nsec = (timeout_ms % 1000) * 1000000LL;
+
+    sqe->opcode = IORING_OP_LINK_TIMEOUT;
+    sqe->fd = -1;
+    sqe->addr = (uint64_t) &link_timeout;
+    sqe->len = 1;
+    sqe->user_data = tag;
+
+    return true;
+}
+
+int IoUring::submit(unsigned min_complete) {
+    if(ring_fd == -1) {
+        return -1;
+    }
+
+    __atomic_store_n(sq_tail, sq_local_tail, __ATOMIC_RELEASE);
+
+    int ret = (int) syscall(__NR_io_uring_enter, ring_fd, to_submit, min_complete,
+                            min_complete ? IORING_ENTER_GETEVENTS : 0, nullptr, 0);
+
+    if(ret > 0) {
+        to_submit -= min((unsigned) ret, to_submit);
+    }
+
+    return ret;
+}
+
+void IoUring::reap() {
+    unsigned head = *cq_head;
+    unsigned tail = __atomic_load_n(cq_tail, __ATOMIC_ACQUIRE);
+
+    while(head != tail) {
+        struct io_uring_cqe* cqe = &cqes[head & *cq_mask];
+        completed[cqe->user_data] = cqe->res;
+        head++;
+    }
+
+    __atomic_store_n(cq_head, head, __ATOMIC_RELEASE);
+}
+
+bool IoUring::wait(uint64_t tag, int& res) {
+    if(ring_fd == -1) {
+        return false;
+    }
+
+    while(true) {
+        reap();
+
+        auto it = completed.find(tag);
+        if(it != completed.end()) {
+            res = it->second;
+            completed.erase(it);
+            return true;
+        }
+
+        if(submit(1) < 0 && errno != EINTR && errno != EAGAIN && errno != EBUSY) {
+            return false;
+        }
+    }
+}
+
+#else
+
+IoUring::IoUring(unsigned entries) {}
+
+IoUring::~IoUring() {}
+
+bool IoUring::registerBuffers(const vector<iovec>& buffers) { return false; }
+
+bool IoUring::prepRead(int fd, void* buf, unsigned len, uint64_t offset, uint64_t tag, int buf_index) { return false; }
+
+bool IoUring::prepWrite(int fd, const void* buf, unsigned len, uint64_t offset, uint64_t tag, int buf_index) { return false; }
+
+bool IoUring::prepRecv(int sock, void* buf, unsigned len, uint64_t tag, bool link) { return false; }
+
+bool IoUring::prepSend(int sock, const void* buf, unsigned len, uint64_t tag) { return false; }
+
+bool IoUring::prepLinkTimeout(int timeout_ms, uint64_t tag) { return false; }
+
+int IoUring::submit(unsigned min_complete) { return -1; }
+
+void IoUring::reap() {}
+
+bool IoUring::wait(uint64_t tag, int& res) { return false; }
+
+#endif
+
+///---------------------IoEngine---------------------
+
+IoEngine::IoEngine(size_t r_size): ring(IO_URING_ENTRIES), read_size(r_size) {}
+
+IoEngine::~IoEngine() {
+    int res;
+
+    for(int i=0; i<IO_READ_SLOTS; i++) {
+        waitReadSlot(i, res);
+        free(read_slots[i].buf);
+    }
+}
+
+bool IoEngine::prepareBuffers() {
+    if(buffers_ready) {
+        return true;
+    }
+
+    vector<iovec> iovecs;
+
+    for(auto& slot: read_slots) {
+        if(posix_memalign((void**) &slot.buf, 4096, read_size) != 0) {
+            slot.buf = nullptr;
+            return false;
+        }
+        iovecs.push_back(iovec{slot.buf, read_size});
+    }
+
+    // without registration (e.g. low RLIMIT_MEMLOCK) plain read operations are used
+    ring.registerBuffers(iovecs);
+
+    buffers_ready = true;
+    return true;
+}
+
+void IoEngine::submitPending() {
+    if(ring.hasPending()) {
+        ring.submit();
+    }
+}
+
+bool IoEngine::waitReadSlot(int idx, int& res) {
+    Slot& slot = read_slots[idx];
+
+    if(!slot.busy) {
+        return false;
+    }
+
+    slot.busy = false;
+    return ring.wait(TAG_READ + idx, res);
+}
+
+int IoEngine::findReadSlot(int fd) {
+    for(int i=0; i<IO_READ_SLOTS; i++) {
+        if(read_slots[i].busy && read_slots[i].fd == fd) {
+            return i;
+        }
+    }
+
+    return -1;
+}
+
+int IoEngine::takeReadSlot() {
+    int oldest = 0;
+
+    for(int i=0; i<IO_READ_SLOTS; i++) {
+        if(!read_slots[i].busy) {
+            return i;
+        }
+        if(read_slots[i].started < read_slots[oldest].started) {
+            oldest = i;
+        }
+    }
+
+    int res;
+    waitReadSlot(oldest, res);
+    return oldest;
+}
+
+void IoEngine::forgetFile(int fd) {
+    int idx = findReadSlot(fd);
+
+    if(idx >= 0) {
+        int res;
+        waitReadSlot(idx, res);
+    }
+}
+
+bool IoEngine::writeFile(int fd, const uint8_t* data, size_t len, uint64_t offset) {
+    // completion is reaped before returning, the caller commits only data which is on the file
+    while(len > 0) {
+        int res;
+
+        if(!ring.prepWrite(fd, data, (unsigned) len, offset, TAG_WRITE) || !ring.wait(TAG_WRITE, res)) {
+            return false;
+        }
+
+        if(res == -EINTR || res == -EAGAIN) {
+            continue;
+        }
+
+        if(res <= 0) {
+            return false;
+        }
+
+        data += res;
+        len -= res;
+        offset += res;
+    }
+
+    return true;
+}
+
+bool IoEngine::readFile(int fd, uint8_t* out, size_t len, uint64_t offset, size_t next_len) {
+    if(!prepareBuffers()) {
+        return false;
+    }
+
+    int res;
+    bool served = false;
+    int idx = findReadSlot(fd);
+
+    if(idx >= 0) {
+        Slot& slot = read_slots[idx];
+        bool expected = (slot.offset == offset && slot.len == len);
+
+        if(waitReadSlot(idx, res) && expected && res == (int) len) {
+            memcpy(out, slot.buf, len);
+            served = true;
+        }
+    }
+
+    if(!served && !ring.prepRead(fd, out, (unsigned) len, offset, TAG_READ_SYNC)) {
+        return false;
+    }
+
+    // read-ahead of the next chunk goes to the kernel in the same submission
+    if(next_len > 0 && next_len <= read_size) {
+        if(idx < 0) {
+            idx = takeReadSlot();
+        }
+
+        Slot& slot = read_slots[idx];
+
+        if(ring.prepRead(fd, slot.buf, (unsigned) next_len, offset + len, TAG_READ + idx, idx)) {
+            slot.busy = true;
+            slot.fd = fd;
+            slot.offset = offset + len;
+            slot.len = (unsigned) next_len;
+            slot.started = ++reads_started;
+        }
+    }
+
+    if(served) {
+        submitPending();
+        return true;
+    }
+
+    return ring.wait(TAG_READ_SYNC, res) && res == (int) len;
+}
+
+ssize_t IoEngine::recv(int sock, void* buf, size_t len, int timeout_ms) {
+    int res, timeout_res;
+
+    if(!ring.prepRecv(sock, buf, (unsigned) len, TAG_RECV, true) || !ring.prepLinkTimeout(timeout_ms, TAG_TIMEOUT)) {
+        errno = EIO;
+        return -1;
+    }
+
+    if(!ring.wait(TAG_RECV, res) || !ring.wait(TAG_TIMEOUT, timeout_res)) {
+        errno = EIO;
+        return -1;
+    }
+
+    if(res == -ECANCELED) {
+        errno = EAGAIN;
+        return -1;
+    }
+
+    if(res < 0) {
+        errno = -res;
+        return -1;
+    }
+
+    return res;
+}
+
+ssize_t IoEngine::send(int sock, const void* buf, size_t len) {
+    int res;
+
+    if(!ring.prepSend(sock, buf, (unsigned) len, TAG_SEND) || !ring.wait(TAG_SEND, res)) {
+        errno = EIO;
+        return -1;
+    }
+
+    if(res < 0) {
+        errno = -res;
+        return -1;
+    }
+
+    return res;
+}
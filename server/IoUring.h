@@ -0,0 +1,117 @@
+#ifndef SERVER_IOURING_H
+#define SERVER_IOURING_H
+
+#include "main.h"
+
+#include <sys/uio.h>
+#include <vector>
+
+#ifdef HAVE_IO_URING
+#include <linux/io_uring.h>
+#endif
+
+#define IO_URING_ENTRIES 16
+#define IO_READ_SLOTS 4
+
+// minimal io_uring wrapper built directly on the kernel interface
+class IoUring {
+private:
+    int ring_fd = -1;
+    void* sq_ptr = nullptr;
+    void* cq_ptr = nullptr;
+    size_t sq_size = 0;
+    size_t cq_size = 0;
+    unsigned sq_entries = 0;
+    unsigned* sq_head = nullptr;
+    unsigned* sq_tail = nullptr;
+    unsigned* sq_mask = nullptr;
+    unsigned* sq_array = nullptr;
+    unsigned* cq_head = nullptr;
+    unsigned* cq_tail = nullptr;
+    unsigned* cq_mask = nullptr;
+    unsigned sq_local_tail = 0;
+    unsigned to_submit = 0;
+    bool buffers_registered = false;
+    std::map<uint64_t, int> completed;
+
+#ifdef HAVE_IO_URING
+    struct io_uring_sqe* sqes = nullptr;
+    struct io_uring_cqe* cqes = nullptr;
+    size_t sqes_size = 0;
+    // read by the kernel when the linked timeout is submitted
+    struct __kernel_timespec link_timeout;
+
+    struct io_uring_sqe* getSqe();
+#endif
+
+    void reap();
+
+public:
+    explicit IoUring(unsigned);
+    ~IoUring();
+
+    bool isValid() { return ring_fd != -1; };
+    bool hasFixedBuffers() { return buffers_registered; };
+    bool registerBuffers(const std::vector<iovec>&);
+
+    // buf_index >= 0 uses registered buffer with that index
+    bool prepRead(int, void*, unsigned, uint64_t, uint64_t, int = -1);
+    bool prepWrite(int, const void*, unsigned, uint64_t, uint64_t, int = -1);
+    bool prepRecv(int, void*, unsigned, uint64_t, bool = false);
+    bool prepSend(int, const void*, unsigned, uint64_t);
+    bool prepLinkTimeout(int, uint64_t);
+
+    bool hasPending() { return to_submit > 0; };
+    // submits queued operations, waits for min_complete completions
+    int submit(unsigned = 0);
+    // blocks until operation with given tag completes
+    bool wait(uint64_t, int&);
+};
+
+// per connection engine: file writes, read-ahead and socket I/O on one ring
+class IoEngine {
+private:
+    struct Slot {
+        uint8_t* buf = nullptr;
+        bool busy = false;
+        int fd = -1;
+        uint64_t offset = 0;
+        unsigned len = 0;
+        // when all slots are busy the least recently started read-ahead is dropped
+        uint64_t started = 0;
+    };
+
+    IoUring ring;
+    // read-ahead kept per file, so downloads interleaved on one connection don't drop each other's
+    Slot read_slots[IO_READ_SLOTS];
+    size_t read_size;
+    bool buffers_ready = false;
+    uint64_t reads_started = 0;
+
+    bool prepareBuffers();
+    bool waitReadSlot(int, int&);
+    int findReadSlot(int);
+    int takeReadSlot();
+
+public:
+    explicit IoEngine(size_t);
+    ~IoEngine();
+
+    bool isValid() { return ring.isValid(); };
+    void submitPending();
+
+    // descriptors are opened and closed by the caller, one per transfer
+
+    // written straight from the caller's buffer, returns once all len bytes are on the file
+    bool writeFile(int, const uint8_t*, size_t, uint64_t);
+    // reads len bytes at offset and starts reading next_len following bytes in background
+    bool readFile(int, uint8_t*, size_t, uint64_t, size_t);
+    // must be called before the descriptor is closed, its number may be reused for another file
+    void forgetFile(int);
+
+    // timeout in ms, returns -1 with EAGAIN when nothing arrived in time
+    ssize_t recv(int, void*, size_t, int);
+    ssize_t send(int, const void*, size_t);
+};
+
+#endif //SERVER_IOURING_H
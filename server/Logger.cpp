@@ -1,93 +1,245 @@
 #include "Logger.h"
 
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+
 using namespace std;
 
-void Logger::print_msg() {
-    while(true) {
-        unique_lock<mutex> l(queue_mutex);
-        if (msg_queue.empty()) {
-            queue_empty.wait(l);
+static const char* LEVEL_COLOR[] = {"", LIGHTBLUE, YELLOW, RED};
+static const char* LEVEL_NAME[] = {"[DEBUG]", "[INFO]", "[WARN]", "[ERROR]"};
+
+static void writeFully(int fd, struct iovec* iov, int count) {
+    while(count > 0) {
+        ssize_t written = writev(fd, iov, count);
+
+        if(written == -1) {
+            if(errno == EINTR) {
+                continue;
+            }
+            return;
         }
 
-        if(destroying) {
-            cout<<"\r[LOGGER] Bye!"<<endl;
-            break;
+        while(count > 0 && (size_t) written >= iov->iov_len) {
+            written -= iov->iov_len;
+            iov++;
+            count--;
         }
 
-        bool printed = false;
+        if(count > 0) {
+            iov->iov_base = (char*) iov->iov_base + written;
+            iov->iov_len -= written;
+        }
+    }
+}
+
+void Logger::format(MessageLevel lvl, const string& author, const string& body, time_t t, string& console, string& file) {
+    if(t != cached_time) {
+        tm tm_buf;
+        localtime_r(&t, &tm_buf);
+        strftime(time_text, sizeof(time_text), "%Y-%m-%d %H:%M:%S", &tm_buf);
+        cached_time = t;
+    }
 
-        if(!msg_queue.empty()) {
-            Msg msg = msg_queue.front();
-            msg_queue.pop();
+    // console shows only the time of day
+    console += "\r";
+    console += LEVEL_COLOR[lvl];
+    console += "[";
+    console.append(time_text + 11);
+    console += "]";
+    console += LEVEL_NAME[lvl];
+    console += "[" + author + "] ";
+    console += body;
+    console += RESET "\n";
 
-            string message;
+    if(file_fd.load(memory_order_acquire) != -1) {
+        file += "[";
+        file += time_text;
+        file += "]";
+        file += LEVEL_NAME[lvl];
+        file += "[" + author + "] ";
+        file += body;
+        file += "\n";
+    }
+}
 
-            char time_buf[12];
-            tm *t = localtime(&msg.time);
-            strftime(time_buf, 12, "[%H:%M:%S]", t);
-            string time(time_buf);
+bool Logger::rotate(time_t now) {
+    close(file_fd.load());
+    file_fd = -1;
 
-            message = time;
+    for(int i=LOG_ROTATE_KEEP-1; i>0; i--) {
+        rename((file_path + "." + to_string(i)).c_str(), (file_path + "." + to_string(i+1)).c_str());
+    }
+    rename(file_path.c_str(), (file_path + ".1").c_str());
 
-            if (msg.level == DEBUG) {
-                message += "[DEBUG]";
-            }
-            if (msg.level == INFO) {
-                message = LIGHTBLUE + message;
-                message += "[INFO]";
-            }
-            if (msg.level == WARN) {
-                message = YELLOW + message;
-                message += "[WARN]";
-            }
-            if (msg.level == ERR) {
-                message = RED + message;
-                message += "[ERROR]";
-            }
+    int fd = open(file_path.c_str(), O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC, 0644);
+
+    if(fd == -1) {
+        cout<<"\r[LOGGER] could not reopen "<<file_path<<", file logging stopped"<<endl;
+        return false;
+    }
 
-            message += "[" + msg.author + "] ";
+    file_size = 0;
+    file_opened = now;
+    file_fd = fd;
+    return true;
+}
+
+void Logger::write_file(const string& buf, time_t now) {
+    if(buf.empty() || file_fd.load(memory_order_acquire) == -1) {
+        return;
+    }
+
+    if((file_size > 0 && file_size + buf.size() > LOG_ROTATE_SIZE) || now >= file_opened + LOG_ROTATE_INTERVAL) {
+        if(!rotate(now)) {
+            return;
+        }
+    }
+
+    struct iovec iov;
+    iov.iov_base = (void*) buf.data();
+    iov.iov_len = buf.size();
+    writeFully(file_fd.load(), &iov, 1);
+
+    file_size += buf.size();
+}
+
+void Logger::print_msg() {
+    string console_buf;
+    string file_buf;
+    string prompt;
 
-            message += msg.body;
+    while(true) {
+        // whatever was queued before destroying was set is still printed
+        bool exiting = destroying.load();
+        unsigned count = 0;
+        time_t now = time(nullptr);
 
-            cout << "\r" << message << RESET << endl;
+        console_buf.clear();
+        file_buf.clear();
 
-            printed = true;
+        uint64_t lost = dropped.exchange(0);
+        if(lost > 0) {
+            format(WARN, "LOGGER", to_string(lost) + " messages dropped, queue was full", now, console_buf, file_buf);
         }
 
-        if(input != nullptr) {
-            if(*input != last_printed) {
-                printed = true;
-            }
+        while(count < LOG_BATCH_SIZE) {
+            Slot& slot = ring[head & (LOG_QUEUE_CAPACITY - 1)];
 
-            if(printed) {
-                last_printed = *input;
-                cout<<"\r> "<<last_printed<<" \b"<<flush;
+            if(slot.seq.load(memory_order_acquire) != head + 1) {
+                break;
             }
+
+            format(slot.level, slot.author, slot.body, slot.time, console_buf, file_buf);
+
+            slot.seq.store(head + LOG_QUEUE_CAPACITY, memory_order_release);
+            head++;
+            count++;
+        }
+
+        bool printed = !console_buf.empty();
+
+        if(input != nullptr && (printed || *input != last_printed)) {
+            last_printed = *input;
+            prompt = "\r> " + last_printed + " \b";
+        } else {
+            prompt.clear();
+        }
+
+        // one write per batch instead of a flush per line
+        if(printed || !prompt.empty()) {
+            struct iovec iov[2];
+            iov[0].iov_base = (void*) console_buf.data();
+            iov[0].iov_len = console_buf.size();
+            iov[1].iov_base = (void*) prompt.data();
+            iov[1].iov_len = prompt.size();
+            writeFully(STDOUT_FILENO, iov, 2);
+        }
+
+        write_file(file_buf, now);
+
+        if(count == LOG_BATCH_SIZE) {
+            continue;
+        }
+
+        if(exiting && dropped == 0) {
+            cout<<"\r[LOGGER] Bye!"<<endl;
+            break;
         }
+
+        unique_lock<mutex> l(wake_mutex);
+        sleeping = true;
+        atomic_thread_fence(memory_order_seq_cst);
+
+        if(!wake_pending && !destroying && ring[head & (LOG_QUEUE_CAPACITY - 1)].seq.load(memory_order_acquire) != head + 1) {
+            wake.wait_for(l, chrono::milliseconds(LOG_IDLE_WAIT_MS));
+        }
+
+        sleeping = false;
+        wake_pending = false;
     }
 }
 
-Logger::Logger(bool* s_e) {
+Logger::Logger(bool* s_e): ring(new Slot[LOG_QUEUE_CAPACITY]), tail(0), dropped(0), overflow(LOG_DROP), sleeping(false),
+                           destroying(false), min_level(LOG_MIN_LEVEL), file_fd(-1) {
     should_exit = s_e;
 
+    for(size_t i=0; i<LOG_QUEUE_CAPACITY; i++) {
+        ring[i].seq.store(i, memory_order_relaxed);
+    }
+
     printer = thread(&Logger::print_msg, this);
 }
 
 Logger::~Logger() {
     destroying = true;
-    queue_empty.notify_one();
+    wake_printer();
     if(printer.joinable())
         printer.join();
+
+    if(file_fd != -1) {
+        close(file_fd);
+    }
+}
+
+void Logger::wake_printer() {
+    lock_guard<mutex> l(wake_mutex);
+    wake_pending = true;
+    wake.notify_one();
 }
 
 void Logger::notify() {
-    queue_empty.notify_one();
+    wake_printer();
 }
 
 void Logger::set_input_string(string* in) {
     input = in;
 }
 
+void Logger::set_level(MessageLevel lvl) {
+    min_level = max((int) lvl, (int) LOG_MIN_LEVEL);
+}
+
+void Logger::set_overflow(LogOverflow policy) {
+    overflow = policy;
+}
+
+bool Logger::open_file(const string& path) {
+    int fd = open(path.c_str(), O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC, 0644);
+
+    if(fd == -1) {
+        return false;
+    }
+
+    struct stat st;
+    file_path = path;
+    file_size = fstat(fd, &st) == 0 ? (uint64_t) st.st_size : 0;
+    file_opened = time(nullptr);
+    file_fd.store(fd, memory_order_release);
+
+    return true;
+}
+
 void Logger::log(const string& author, const string& body) {
     add_message(DEBUG, author, body);
 }
@@ -110,29 +262,65 @@ void Logger::err(const string& author, const string& body, int errn) {
     add_message(ERR, author, full_body);
 }
 
-void Logger::add_message(MessageLevel lvl, const string& author, const string& body) {
-    if(body.find('\n') != string::npos) {
-        std::stringstream ss(body);
-        std::string line;
-
-        if (!body.empty())
-        {
-            while(std::getline(ss,line,'\n')){
-                if(!line.empty()) {
-                    add_message(lvl, author, line);
-                }
+bool Logger::push(MessageLevel lvl, const string& author, const char* body, size_t len, time_t now) {
+    size_t pos = tail.load(memory_order_relaxed);
+    Slot* slot;
+
+    while(true) {
+        slot = &ring[pos & (LOG_QUEUE_CAPACITY - 1)];
+        intptr_t diff = (intptr_t) slot->seq.load(memory_order_acquire) - (intptr_t) pos;
+
+        if(diff == 0) {
+            if(tail.compare_exchange_weak(pos, pos + 1, memory_order_relaxed)) {
+                break;
+            }
+        } else if(diff < 0) {
+            // full, the printer has not released this slot yet
+            if(overflow == LOG_DROP || destroying) {
+                dropped++;
+                return false;
             }
+            wake_printer();
+            this_thread::yield();
+            pos = tail.load(memory_order_relaxed);
+        } else {
+            pos = tail.load(memory_order_relaxed);
         }
+    }
+
+    slot->level = lvl;
+    slot->time = now;
+    slot->author.assign(author);
+    slot->body.assign(body, len);
+    slot->seq.store(pos + 1, memory_order_release);
 
+    return true;
+}
+
+void Logger::add_message(MessageLevel lvl, const string& author, const string& body) {
+    if(!enabled(lvl)) {
         return;
     }
-    Msg msg;
-    msg.level = lvl;
-    msg.author = author;
-    msg.body = body;
-    time(&msg.time);
-    queue_mutex.lock();
-    msg_queue.push(msg);
-    queue_mutex.unlock();
-    queue_empty.notify_one();
+
+    time_t now = time(nullptr);
+
+    // multi-line bodies are queued line by line, empty lines are dropped
+    size_t start = 0;
+    size_t end;
+
+    do {
+        end = body.find('\n', start);
+        size_t line_len = (end == string::npos ? body.size() : end) - start;
+
+        if(line_len > 0 || (start == 0 && end == string::npos)) {
+            push(lvl, author, body.data() + start, line_len, now);
+        }
+
+        start = end + 1;
+    } while(end != string::npos);
+
+    atomic_thread_fence(memory_order_seq_cst);
+    if(sleeping.load(memory_order_relaxed)) {
+        wake_printer();
+    }
 }
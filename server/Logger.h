@@ -2,7 +2,6 @@
 #define SERVER_LOGGER_H
 
 #include "main.h"
-#include <sstream>
 
 #define RED "\033[;31m"
 #define LIGHTBLUE "\033[;36m"
@@ -16,24 +15,84 @@ enum MessageLevel {
     ERR,
 };
 
+// messages below this level are compiled out of LOG_* macros, release builds drop DEBUG
+#ifndef LOG_MIN_LEVEL
+#ifdef NDEBUG
+#define LOG_MIN_LEVEL INFO
+#else
+#define LOG_MIN_LEVEL DEBUG
+#endif
+#endif
+
+// arguments are evaluated only when the level is enabled, use these where building the message costs something
+#define LOG_AT(logger, lvl, author, body) \
+    do { \
+        if ((lvl) >= LOG_MIN_LEVEL && (logger)->enabled(lvl)) { \
+            (logger)->add_message(lvl, author, body); \
+        } \
+    } while(0)
+
+#define LOG_DEBUG(logger, author, body) LOG_AT(logger, DEBUG, author, body)
+#define LOG_INFO(logger, author, body) LOG_AT(logger, INFO, author, body)
+
+#define LOG_QUEUE_CAPACITY 8192 // power of two
+#define LOG_BATCH_SIZE 256
+#define LOG_IDLE_WAIT_MS 50
+#define LOG_ROTATE_SIZE (64*1024*1024)
+#define LOG_ROTATE_INTERVAL (24*60*60)
+#define LOG_ROTATE_KEEP 5
+
+// what producers do when the queue is full
+enum LogOverflow {
+    LOG_DROP,
+    LOG_BLOCK,
+};
+
 class Logger {
 private:
-    struct Msg {
+    // bounded MPSC ring, seq tells whose turn the slot is, strings keep their capacity between uses
+    struct Slot {
+        std::atomic<size_t> seq;
         MessageLevel level;
-        std::string body;
-        std::string author;
         time_t time;
+        std::string author;
+        std::string body;
     };
-    std::queue<Msg> msg_queue;
-    std::mutex queue_mutex;
-    std::condition_variable queue_empty;
+    std::unique_ptr<Slot[]> ring;
+    alignas(64) std::atomic<size_t> tail;
+    alignas(64) size_t head = 0;
+    std::atomic<uint64_t> dropped;
+    std::atomic<int> overflow;
+
+    // printer sleeps only when the ring is empty, producers wake it when they see the flag
+    std::mutex wake_mutex;
+    std::condition_variable wake;
+    std::atomic<bool> sleeping;
+    bool wake_pending = false;
+
     std::string* input = nullptr;
     std::string last_printed = "";
     std::thread printer;
     bool* should_exit;
-    bool destroying = false;
+    std::atomic<bool> destroying;
+    std::atomic<int> min_level;
+
+    // log file is written only by the printer thread
+    std::string file_path;
+    std::atomic<int> file_fd;
+    uint64_t file_size = 0;
+    time_t file_opened = 0;
+
+    // formatted once per second
+    time_t cached_time = 0;
+    char time_text[20];
 
     void print_msg();
+    bool push(MessageLevel, const std::string&, const char*, size_t, time_t);
+    void wake_printer();
+    void format(MessageLevel, const std::string&, const std::string&, time_t, std::string&, std::string&);
+    void write_file(const std::string&, time_t);
+    bool rotate(time_t);
 
 public:
     Logger(bool* s_e);
@@ -44,6 +103,17 @@ public:
 
     void set_input_string(std::string*);
 
+    void set_level(MessageLevel);
+
+    void set_overflow(LogOverflow);
+
+    // messages are also appended to the file, rotated by size and age
+    bool open_file(const std::string&);
+
+    bool enabled(MessageLevel lvl) const {
+        return lvl >= LOG_MIN_LEVEL && lvl >= min_level.load(std::memory_order_relaxed);
+    };
+
     void log(const std::string&, const std::string&);
 
     void info(const std::string&, const std::string&);
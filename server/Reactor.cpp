@@ -0,0 +1,235 @@
+#include "Reactor.h"
+
+#include <fcntl.h>
+
+using namespace std;
+
+Reactor::Reactor(unsigned loop_count, WorkerPool& w, bool* s_e, Logger* logg): next_loop(0), workers(w), should_exit(s_e), logger(logg) {
+    for(unsigned i=0; i<loop_count; i++) {
+        Loop* loop = new Loop;
+        loop->epfd = epoll_create1(0);
+
+        if(loop->epfd == -1) {
+            logger->err(l_id, "error while creating epoll instance", errno);
+            delete loop;
+            continue;
+        }
+
+        loops.push_back(loop);
+    }
+
+    for(auto loop: loops) {
+        loop->t = thread(&Reactor::loopMain, this, loop);
+    }
+
+    logger->info(l_id, "started " + to_string(loops.size()) + " event loops");
+}
+
+Reactor::~Reactor() {
+    stop();
+    closeAll();
+}
+
+bool Reactor::addConnection(int sock, const sockaddr_in& addr, bool tls) {
+    if(loops.empty()) {
+        return false;
+    }
+
+    int flags = fcntl(sock, F_GETFL, 0);
+    if(flags == -1 || fcntl(sock, F_SETFL, flags | O_NONBLOCK) == -1) {
+        logger->err(l_id, "error while setting socket non-blocking", errno);
+        return false;
+    }
+
+    Conn* c = new Conn;
+    c->sock = sock;
+    c->info.encryption = DEFAULT_ENCRYPTION_ALGORITHM;
+    c->info.hash_algorithm = DEFAULT_HASHING_ALGORITHM;
+    string tmp_addr = inet_ntoa(addr.sin_addr);
+    tmp_addr.copy(c->info.addr, tmp_addr.size());
+    c->info.addr[tmp_addr.size()] = 0;
+    c->info.port = (int) ntohs(addr.sin_port);
+    c->info.running = true;
+    c->info.tls = tls;
+    c->client = new Client(sock, &c->info, should_exit, logger);
+    c->client->enableOutputQueue();
+    c->loop = loops[next_loop++ % loops.size()];
+
+    {
+        lock_guard<mutex> l(conns_mutex);
+        conns[sock] = c;
+    }
+
+    struct epoll_event ev;
+    ev.events = EPOLLIN | EPOLLRDHUP | EPOLLONESHOT;
+    ev.data.ptr = c;
+
+    if(epoll_ctl(c->loop->epfd, EPOLL_CTL_ADD, sock, &ev) == -1) {
+        logger->err(l_id, "error while adding socket to event loop", errno);
+        lock_guard<mutex> l(conns_mutex);
+        conns.erase(sock);
+        delete c->client;
+        delete c;
+        return false;
+    }
+
+    return true;
+}
+
+void Reactor::loopMain(Loop* loop) {
+    struct epoll_event events[64];
+
+    while(!(*should_exit)) {
+        int nfds = epoll_wait(loop->epfd, events, 64, loop->deferred.empty() ? 1000 : WORKER_RETRY_MS);
+
+        if(nfds == -1) {
+            if(errno == EINTR) {
+                continue;
+            }
+            logger->err(l_id, "error while waiting for events", errno);
+            break;
+        }
+
+        for(int i=0; i<nfds; i++) {
+            onReadable((Conn*) events[i].data.ptr);
+        }
+
+        retryDeferred(loop);
+    }
+}
+
+void Reactor::retryDeferred(Loop* loop) {
+    if(loop->deferred.empty()) {
+        return;
+    }
+
+    vector<Conn*> waiting;
+    waiting.swap(loop->deferred);
+
+    for(auto c: waiting) {
+        dispatch(c);
+    }
+}
+
+void Reactor::onReadable(Conn* c) {
+    // nothing is read while responses wait to be sent
+    if(!c->client->hasPendingOutput() && !c->client->readAvailable()) {
+        closeConnection(c);
+        return;
+    }
+
+    bool frame = c->client->hasFrame();
+
+    if(c->client->isBroken()) {
+        closeConnection(c);
+        return;
+    }
+
+    // downloads with credit are pushed a slice per dispatch and queued responses are sent, both woken up by EPOLLOUT
+    if(!frame && !c->client->hasPendingDownloads() && !c->client->hasPendingOutput()) {
+        rearm(c);
+        return;
+    }
+
+    dispatch(c);
+}
+
+void Reactor::dispatch(Conn* c) {
+    // socket stays disarmed until the worker is done, so a connection is handled by one thread at a time
+    bool submitted = workers.submit([this, c]() {
+        c->client->processFrames();
+
+        if(c->client->isBroken()) {
+            closeConnection(c);
+        } else {
+            rearm(c);
+        }
+    });
+
+    if(submitted) {
+        return;
+    }
+
+    if(workers.isStopping()) {
+        closeConnection(c);
+        return;
+    }
+
+    // only this connection waits, the loop keeps serving the others
+    c->loop->deferred.push_back(c);
+}
+
+void Reactor::rearm(Conn* c) {
+    struct epoll_event ev;
+
+    if(c->client->hasPendingOutput()) {
+        // input is left in the kernel until the peer reads what was already sent
+        ev.events = EPOLLOUT | EPOLLONESHOT;
+    } else {
+        ev.events = EPOLLIN | EPOLLRDHUP | EPOLLONESHOT | (c->client->hasPendingDownloads() ? EPOLLOUT : 0);
+    }
+    ev.data.ptr = c;
+
+    if(epoll_ctl(c->loop->epfd, EPOLL_CTL_MOD, c->sock, &ev) == -1) {
+        logger->err(l_id, "error while rearming socket", errno);
+        closeConnection(c);
+    }
+}
+
+void Reactor::closeConnection(Conn* c) {
+    epoll_ctl(c->loop->epfd, EPOLL_CTL_DEL, c->sock, nullptr);
+
+    {
+        lock_guard<mutex> l(conns_mutex);
+        conns.erase(c->sock);
+    }
+
+    delete c->client;
+    close(c->sock);
+
+    logger->info(l_id, "closed connection, fd was " + to_string(c->sock));
+
+    delete c;
+}
+
+void Reactor::listConnections(vector<string>& res) {
+    lock_guard<mutex> l(conns_mutex);
+    for(auto& c: conns) {
+        res.emplace_back(string(c.second->info.addr) + ":" + to_string(c.second->info.port) + (c.second->info.tls ? " (tls)" : ""));
+    }
+}
+
+size_t Reactor::size() {
+    lock_guard<mutex> l(conns_mutex);
+    return conns.size();
+}
+
+void Reactor::stop() {
+    for(auto loop: loops) {
+        if(loop->t.joinable()) {
+            loop->t.join();
+        }
+    }
+}
+
+void Reactor::closeAll() {
+    vector<Conn*> left;
+
+    {
+        lock_guard<mutex> l(conns_mutex);
+        for(auto& c: conns) {
+            left.push_back(c.second);
+        }
+    }
+
+    for(auto c: left) {
+        closeConnection(c);
+    }
+
+    for(auto loop: loops) {
+        close(loop->epfd);
+        delete loop;
+    }
+
+    loops.clear();
+}
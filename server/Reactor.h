@@ -0,0 +1,60 @@
+#ifndef SERVER_REACTOR_H
+#define SERVER_REACTOR_H
+
+#include "main.h"
+#include "Logger.h"
+#include "Client.h"
+#include "WorkerPool.h"
+
+#include <atomic>
+
+// event loop threads owning all client sockets, complete messages are handed to the worker pool
+class Reactor {
+private:
+    struct Conn;
+
+    struct Loop {
+        int epfd;
+        std::thread t;
+        // connections with frames waiting for room in the worker queue, their sockets stay disarmed
+        std::vector<Conn*> deferred;
+    };
+
+    struct Conn {
+        int sock;
+        connection info;
+        Client* client;
+        Loop* loop;
+    };
+
+    std::vector<Loop*> loops;
+    std::atomic<unsigned> next_loop;
+    std::map<int, Conn*> conns;
+    std::mutex conns_mutex;
+    WorkerPool& workers;
+    bool* should_exit;
+    Logger* logger;
+    std::string l_id = "Reactor";
+
+    void loopMain(Loop*);
+    void onReadable(Conn*);
+    void dispatch(Conn*);
+    void retryDeferred(Loop*);
+    void rearm(Conn*);
+    void closeConnection(Conn*);
+
+public:
+    Reactor(unsigned, WorkerPool&, bool*, Logger*);
+    ~Reactor();
+
+    bool addConnection(int, const sockaddr_in&, bool = false);
+    void listConnections(std::vector<std::string>&);
+    size_t size();
+
+    // joins event loops, must be called before stopping the worker pool
+    void stop();
+    // closes connections left after workers are gone
+    void closeAll();
+};
+
+#endif //SERVER_REACTOR_H
@@ -0,0 +1,169 @@
+#include "SessionCipher.h"
+
+#include <openssl/crypto.h>
+#include <openssl/kdf.h>
+
+using namespace std;
+using namespace StorageCloud;
+
+SessionCipher::~SessionCipher() {
+    reset();
+}
+
+void SessionCipher::reset() {
+    EVP_CIPHER_CTX_free(seal_ctx);
+    EVP_CIPHER_CTX_free(open_ctx);
+    EVP_PKEY_free(own_key);
+    seal_ctx = open_ctx = nullptr;
+    own_key = nullptr;
+    own_public.clear();
+    seal_counter = open_counter = 0;
+    ready = false;
+}
+
+void SessionCipher::swap(SessionCipher& other) {
+    std::swap(seal_ctx, other.seal_ctx);
+    std::swap(open_ctx, other.open_ctx);
+    std::swap(own_key, other.own_key);
+    own_public.swap(other.own_public);
+    std::swap(seal_salt, other.seal_salt);
+    std::swap(open_salt, other.open_salt);
+    std::swap(seal_counter, other.seal_counter);
+    std::swap(open_counter, other.open_counter);
+    std::swap(ready, other.ready);
+}
+
+bool SessionCipher::isAead(const EncryptionAlgorithm algo) {
+    return algo == EncryptionAlgorithm::AES_128_GCM || algo == EncryptionAlgorithm::AES_256_GCM;
+}
+
+bool SessionCipher::generateKey() {
+    reset();
+
+    EVP_PKEY_CTX* ctx = EVP_PKEY_CTX_new_id(EVP_PKEY_X25519, nullptr);
+    bool ok = ctx != nullptr && EVP_PKEY_keygen_init(ctx) > 0 && EVP_PKEY_keygen(ctx, &own_key) > 0;
+    EVP_PKEY_CTX_free(ctx);
+
+    if(!ok) {
+        return false;
+    }
+
+    size_t len = X25519_KEY_SIZE;
+    own_public.resize(len);
+
+    if(EVP_PKEY_get_raw_public_key(own_key, (uint8_t*) &own_public[0], &len) <= 0 || len != X25519_KEY_SIZE) {
+        reset();
+        return false;
+    }
+
+    return true;
+}
+
+bool SessionCipher::deriveKeys(const EncryptionAlgorithm algo, const string& peer_public) {
+    if(!isAead(algo) || own_key == nullptr || peer_public.size() != X25519_KEY_SIZE) {
+        return false;
+    }
+
+    EVP_PKEY* peer_key = EVP_PKEY_new_raw_public_key(EVP_PKEY_X25519, nullptr, (const uint8_t*) peer_public.c_str(), peer_public.size());
+    if(peer_key == nullptr) {
+        return false;
+    }
+
+    uint8_t shared[X25519_KEY_SIZE];
+    size_t shared_len = sizeof(shared);
+
+    EVP_PKEY_CTX* ctx = EVP_PKEY_CTX_new(own_key, nullptr);
+    bool ok = ctx != nullptr && EVP_PKEY_derive_init(ctx) > 0 && EVP_PKEY_derive_set_peer(ctx, peer_key) > 0
+              && EVP_PKEY_derive(ctx, shared, &shared_len) > 0;
+    EVP_PKEY_CTX_free(ctx);
+    EVP_PKEY_free(peer_key);
+
+    if(!ok) {
+        return false;
+    }
+
+    const EVP_CIPHER* cipher = (algo == EncryptionAlgorithm::AES_128_GCM) ? EVP_aes_128_gcm() : EVP_aes_256_gcm();
+    const size_t key_len = (size_t) EVP_CIPHER_key_length(cipher);
+
+    // key | salt for each direction, expanded separately so the directions never share a key
+    string info = "storage-cloud " + EncryptionAlgorithm_Name(algo);
+    string keys = peer_public + own_public;
+    uint8_t client_material[32 + GCM_SALT_SIZE];
+    uint8_t server_material[32 + GCM_SALT_SIZE];
+
+    ok = hkdf(shared, shared_len, info + " client" + keys, client_material, key_len + GCM_SALT_SIZE)
+         && hkdf(shared, shared_len, info + " server" + keys, server_material, key_len + GCM_SALT_SIZE);
+    OPENSSL_cleanse(shared, sizeof(shared));
+
+    if(ok) {
+        memcpy(open_salt, client_material + key_len, GCM_SALT_SIZE);
+        memcpy(seal_salt, server_material + key_len, GCM_SALT_SIZE);
+
+        seal_ctx = EVP_CIPHER_CTX_new();
+        open_ctx = EVP_CIPHER_CTX_new();
+        ok = seal_ctx != nullptr && open_ctx != nullptr
+             && EVP_EncryptInit_ex(seal_ctx, cipher, nullptr, server_material, nullptr) > 0
+             && EVP_DecryptInit_ex(open_ctx, cipher, nullptr, client_material, nullptr) > 0;
+    }
+
+    OPENSSL_cleanse(client_material, sizeof(client_material));
+    OPENSSL_cleanse(server_material, sizeof(server_material));
+
+    // private key is not needed any more
+    EVP_PKEY_free(own_key);
+    own_key = nullptr;
+
+    ready = ok;
+    return ok;
+}
+
+bool SessionCipher::hkdf(const uint8_t secret[], const size_t secret_len, const string& info, uint8_t out[], size_t len) {
+    EVP_PKEY_CTX* ctx = EVP_PKEY_CTX_new_id(EVP_PKEY_HKDF, nullptr);
+    bool ok = ctx != nullptr && EVP_PKEY_derive_init(ctx) > 0 && EVP_PKEY_CTX_set_hkdf_md(ctx, EVP_sha256()) > 0
+              && EVP_PKEY_CTX_set1_hkdf_key(ctx, secret, (int) secret_len) > 0
+              && EVP_PKEY_CTX_add1_hkdf_info(ctx, (const uint8_t*) info.c_str(), (int) info.size()) > 0
+              && EVP_PKEY_derive(ctx, out, &len) > 0;
+    EVP_PKEY_CTX_free(ctx);
+    return ok;
+}
+
+void SessionCipher::makeIv(const uint8_t salt[], uint64_t counter, uint8_t iv[]) {
+    memcpy(iv, salt, GCM_SALT_SIZE);
+
+    for(int i=GCM_IV_SIZE-1; i>=GCM_SALT_SIZE; i--) {
+        iv[i] = (uint8_t) counter;
+        counter >>= 8;
+    }
+}
+
+bool SessionCipher::seal(uint8_t buf[], const size_t len, const uint8_t aad[], const size_t aad_len) {
+    if(!ready) {
+        return false;
+    }
+
+    uint8_t iv[GCM_IV_SIZE];
+    int out_len;
+    makeIv(seal_salt, seal_counter++, iv);
+
+    return EVP_EncryptInit_ex(seal_ctx, nullptr, nullptr, nullptr, iv) > 0
+           && (aad_len == 0 || EVP_EncryptUpdate(seal_ctx, nullptr, &out_len, aad, (int) aad_len) > 0)
+           && EVP_EncryptUpdate(seal_ctx, buf, &out_len, buf, (int) len) > 0
+           && EVP_EncryptFinal_ex(seal_ctx, buf + out_len, &out_len) > 0
+           && EVP_CIPHER_CTX_ctrl(seal_ctx, EVP_CTRL_GCM_GET_TAG, GCM_TAG_SIZE, buf + len) > 0;
+}
+
+bool SessionCipher::open(uint8_t buf[], const size_t len, const uint8_t aad[], const size_t aad_len) {
+    if(!ready) {
+        return false;
+    }
+
+    uint8_t iv[GCM_IV_SIZE];
+    int out_len;
+    makeIv(open_salt, open_counter++, iv);
+
+    return EVP_DecryptInit_ex(open_ctx, nullptr, nullptr, nullptr, iv) > 0
+           && (aad_len == 0 || EVP_DecryptUpdate(open_ctx, nullptr, &out_len, aad, (int) aad_len) > 0)
+           && EVP_DecryptUpdate(open_ctx, buf, &out_len, buf, (int) len) > 0
+           && EVP_CIPHER_CTX_ctrl(open_ctx, EVP_CTRL_GCM_SET_TAG, GCM_TAG_SIZE, buf + len) > 0
+           && EVP_DecryptFinal_ex(open_ctx, buf + out_len, &out_len) > 0;
+}
@@ -0,0 +1,52 @@
+#ifndef SERVER_SESSIONCIPHER_H
+#define SERVER_SESSIONCIPHER_H
+
+#include "main.h"
+
+#define GCM_TAG_SIZE 16
+#define GCM_IV_SIZE 12
+#define GCM_SALT_SIZE 4
+#define X25519_KEY_SIZE 32
+
+// AES-GCM keys of one connection, agreed with X25519 in Handshake
+class SessionCipher {
+private:
+    EVP_CIPHER_CTX* seal_ctx = nullptr;
+    EVP_CIPHER_CTX* open_ctx = nullptr;
+    EVP_PKEY* own_key = nullptr;
+    std::string own_public;
+
+    // iv is salt of the direction followed by message counter
+    uint8_t seal_salt[GCM_SALT_SIZE];
+    uint8_t open_salt[GCM_SALT_SIZE];
+    uint64_t seal_counter = 0;
+    uint64_t open_counter = 0;
+    bool ready = false;
+
+    // HKDF-SHA256 without salt
+    static bool hkdf(const uint8_t*, size_t, const std::string&, uint8_t*, size_t);
+    static void makeIv(const uint8_t*, uint64_t, uint8_t*);
+    void reset();
+
+public:
+    SessionCipher() = default;
+    SessionCipher(const SessionCipher&) = delete;
+    ~SessionCipher();
+
+    static bool isAead(StorageCloud::EncryptionAlgorithm);
+
+    // creates own key pair, own public key is sent back to the peer
+    bool generateKey();
+    const std::string& publicKey() { return own_public; };
+    // derives keys from peer public key, each direction has its own key and salt
+    bool deriveKeys(StorageCloud::EncryptionAlgorithm, const std::string&);
+    bool isReady() { return ready; };
+    // exchanges whole state, keys of a new handshake are derived aside and swapped in once the old ones are no longer needed
+    void swap(SessionCipher&);
+
+    // both transform buf in place, tag is written after / read from behind the len bytes
+    bool seal(uint8_t*, size_t, const uint8_t*, size_t);
+    bool open(uint8_t*, size_t, const uint8_t*, size_t);
+};
+
+#endif //SERVER_SESSIONCIPHER_H
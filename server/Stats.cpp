@@ -0,0 +1,137 @@
+#include "Stats.h"
+
+using namespace std;
+using namespace StorageCloud;
+
+thread_local Stats::Shard Stats::shard;
+
+#define STATS_SUB_BUCKETS (1u << STATS_SUB_BUCKET_BITS)
+
+// only the owning thread writes, so a plain load and store is enough
+static inline void add(atomic<uint64_t>& counter, const uint64_t value) {
+    counter.store(counter.load(memory_order_relaxed) + value, memory_order_relaxed);
+}
+
+uint64_t command_summary::percentile(const double fraction) const {
+    uint64_t target = (uint64_t) (fraction * count + 0.5);
+    uint64_t seen = 0;
+
+    if(target == 0) {
+        target = 1;
+    }
+
+    for(unsigned i=0; i<STATS_BUCKETS; i++) {
+        seen += buckets[i];
+        if(seen >= target) {
+            return min(Stats::bucketMax(i), max_us);
+        }
+    }
+
+    return max_us;
+}
+
+Stats::Shard::Shard() {
+    for(auto& counters: commands) {
+        counters.store(nullptr, memory_order_relaxed);
+    }
+
+    Stats& stats = Stats::getInstance();
+    lock_guard<mutex> l(stats.shards_mutex);
+    stats.shards.push_back(this);
+}
+
+Stats::Shard::~Shard() {
+    Stats& stats = Stats::getInstance();
+    lock_guard<mutex> l(stats.shards_mutex);
+
+    for(int i=0; i<CommandType_ARRAYSIZE; i++) {
+        Counters* counters = commands[i].load(memory_order_relaxed);
+        if(counters != nullptr) {
+            merge(*counters, stats.retired[i]);
+            delete counters;
+        }
+    }
+
+    stats.shards.erase(std::find(stats.shards.begin(), stats.shards.end(), this));
+}
+
+unsigned Stats::bucketOf(const uint64_t us) {
+    if(us < STATS_SUB_BUCKETS) {
+        return (unsigned) us;
+    }
+
+    unsigned exponent = 63 - __builtin_clzll(us);
+    unsigned shift = exponent - STATS_SUB_BUCKET_BITS;
+    unsigned bucket = ((shift + 1) << STATS_SUB_BUCKET_BITS) + (unsigned) ((us >> shift) & (STATS_SUB_BUCKETS - 1));
+
+    return min(bucket, (unsigned) STATS_BUCKETS - 1);
+}
+
+uint64_t Stats::bucketMax(const unsigned bucket) {
+    if(bucket < STATS_SUB_BUCKETS) {
+        return bucket;
+    }
+
+    unsigned shift = (bucket >> STATS_SUB_BUCKET_BITS) - 1;
+    uint64_t lowest = (uint64_t) (STATS_SUB_BUCKETS + (bucket & (STATS_SUB_BUCKETS - 1))) << shift;
+
+    return lowest + (((uint64_t) 1) << shift) - 1;
+}
+
+void Stats::merge(const Counters& counters, command_summary& summary) {
+    summary.count += counters.count.load(memory_order_relaxed);
+    summary.errors += counters.errors.load(memory_order_relaxed);
+    summary.bytes_in += counters.bytes_in.load(memory_order_relaxed);
+    summary.bytes_out += counters.bytes_out.load(memory_order_relaxed);
+    summary.total_us += counters.total_us.load(memory_order_relaxed);
+    summary.max_us = max(summary.max_us, counters.max_us.load(memory_order_relaxed));
+
+    for(unsigned i=0; i<STATS_BUCKETS; i++) {
+        summary.buckets[i] += counters.buckets[i].load(memory_order_relaxed);
+    }
+}
+
+void Stats::record(const CommandType type, const uint64_t us, const bool error, const uint64_t bytes_in, const uint64_t bytes_out) {
+    if(!CommandType_IsValid(type)) {
+        return;
+    }
+
+    Counters* counters = shard.commands[type].load(memory_order_relaxed);
+
+    if(counters == nullptr) {
+        // value-initialized, all counters start at zero
+        counters = new Counters();
+        shard.commands[type].store(counters, memory_order_release);
+    }
+
+    add(counters->count, 1);
+    add(counters->bytes_in, bytes_in);
+    add(counters->bytes_out, bytes_out);
+    add(counters->total_us, us);
+    add(counters->buckets[bucketOf(us)], 1);
+
+    if(error) {
+        add(counters->errors, 1);
+    }
+
+    if(us > counters->max_us.load(memory_order_relaxed)) {
+        counters->max_us.store(us, memory_order_relaxed);
+    }
+}
+
+void Stats::getSummary(command_summary* out) {
+    lock_guard<mutex> l(shards_mutex);
+
+    for(int i=0; i<CommandType_ARRAYSIZE; i++) {
+        out[i] = retired[i];
+    }
+
+    for(auto s: shards) {
+        for(int i=0; i<CommandType_ARRAYSIZE; i++) {
+            Counters* counters = s->commands[i].load(memory_order_acquire);
+            if(counters != nullptr) {
+                merge(*counters, out[i]);
+            }
+        }
+    }
+}
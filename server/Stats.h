@@ -0,0 +1,77 @@
+#ifndef SERVER_STATS_H
+#define SERVER_STATS_H
+
+#include "main.h"
+#include <algorithm>
+#include <vector>
+
+// log-linear latency buckets in microseconds, 8 per power of two (12% precision)
+#define STATS_SUB_BUCKET_BITS 3
+// latencies over 2^30 us (about 18 minutes) fall into the last bucket
+#define STATS_MAX_EXPONENT 30
+#define STATS_BUCKETS ((STATS_MAX_EXPONENT - STATS_SUB_BUCKET_BITS + 2) << STATS_SUB_BUCKET_BITS)
+
+// counters of one command type merged from all threads
+struct command_summary {
+    uint64_t count = 0;
+    uint64_t errors = 0;
+    uint64_t bytes_in = 0;
+    uint64_t bytes_out = 0;
+    uint64_t total_us = 0;
+    uint64_t max_us = 0;
+    uint64_t buckets[STATS_BUCKETS] = {};
+
+    uint64_t mean() const { return count ? total_us / count : 0; };
+    // highest latency in the bucket holding the given fraction of requests
+    uint64_t percentile(double) const;
+};
+
+// per command counters, every thread records into its own shard without locking
+class Stats {
+private:
+    // written only by the owning thread, read by merges
+    struct Counters {
+        std::atomic<uint64_t> count;
+        std::atomic<uint64_t> errors;
+        std::atomic<uint64_t> bytes_in;
+        std::atomic<uint64_t> bytes_out;
+        std::atomic<uint64_t> total_us;
+        std::atomic<uint64_t> max_us;
+        std::atomic<uint64_t> buckets[STATS_BUCKETS];
+    };
+
+    // counters of a command type are allocated when the thread handles it for the first time
+    struct Shard {
+        std::atomic<Counters*> commands[StorageCloud::CommandType_ARRAYSIZE];
+        Shard();
+        ~Shard();
+    };
+
+    std::mutex shards_mutex;
+    std::vector<Shard*> shards;
+    // counters of threads which already ended
+    command_summary retired[StorageCloud::CommandType_ARRAYSIZE];
+
+    static thread_local Shard shard;
+
+    Stats() = default;
+
+    static void merge(const Counters&, command_summary&);
+
+public:
+    Stats(const Stats&) = delete;
+
+    static Stats& getInstance() {
+        static Stats instance;
+        return instance;
+    }
+
+    static unsigned bucketOf(uint64_t);
+    static uint64_t bucketMax(unsigned);
+
+    void record(StorageCloud::CommandType, uint64_t, bool, uint64_t, uint64_t);
+    // out needs CommandType_ARRAYSIZE entries
+    void getSummary(command_summary*);
+};
+
+#endif //SERVER_STATS_H
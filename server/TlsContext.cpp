@@ -0,0 +1,115 @@
+#include "TlsContext.h"
+
+#include <openssl/err.h>
+#include <fcntl.h>
+#include <poll.h>
+
+using namespace std;
+
+TlsContext::TlsContext(const string& cert, const string& key, Logger* logg): logger(logg) {
+#ifndef SSL_OP_ENABLE_KTLS
+    logger->err(l_id, "OpenSSL was built without kernel TLS support");
+    return;
+#else
+    ctx = SSL_CTX_new(TLS_server_method());
+
+    if(ctx == nullptr) {
+        logger->err(l_id, "error while creating TLS context");
+        return;
+    }
+
+    SSL_CTX_set_min_proto_version(ctx, TLS1_2_VERSION);
+#if OPENSSL_VERSION_NUMBER < 0x30200000L
+    // receive offload of TLS 1.3 is supported since OpenSSL 3.2
+    SSL_CTX_set_max_proto_version(ctx, TLS1_2_VERSION);
+#endif
+
+    // only ciphers the kernel can take over
+    SSL_CTX_set_cipher_list(ctx, "ECDHE+AESGCM:ECDHE+CHACHA20");
+    SSL_CTX_set_options(ctx, SSL_OP_ENABLE_KTLS | SSL_OP_NO_RENEGOTIATION | SSL_OP_NO_COMPRESSION);
+
+    if(SSL_CTX_use_certificate_chain_file(ctx, cert.c_str()) != 1
+       || SSL_CTX_use_PrivateKey_file(ctx, key.c_str(), SSL_FILETYPE_PEM) != 1
+       || SSL_CTX_check_private_key(ctx) != 1) {
+        char buf[256];
+        ERR_error_string_n(ERR_get_error(), buf, sizeof(buf));
+        logger->err(l_id, string("error while loading certificate: ") + buf);
+        SSL_CTX_free(ctx);
+        ctx = nullptr;
+    }
+#endif
+}
+
+TlsContext::~TlsContext() {
+    SSL_CTX_free(ctx);
+}
+
+bool TlsContext::handshake(int sock, const string& peer) {
+    if(ctx == nullptr) {
+        return false;
+    }
+
+    SSL* ssl = SSL_new(ctx);
+    int flags = fcntl(sock, F_GETFL, 0);
+
+    if(ssl == nullptr || SSL_set_fd(ssl, sock) != 1 || flags == -1 || fcntl(sock, F_SETFL, flags | O_NONBLOCK) == -1) {
+        SSL_free(ssl);
+        logger->err(l_id, "error while preparing TLS connection with " + peer);
+        return false;
+    }
+
+    // one deadline for the whole handshake, a peer trickling bytes can't hold the thread longer
+    auto deadline = chrono::steady_clock::now() + chrono::seconds(TLS_HANDSHAKE_TIMEOUT);
+    bool timed_out = false;
+    int ret;
+
+    while((ret = SSL_accept(ssl)) != 1) {
+        int err = SSL_get_error(ssl, ret);
+
+        if(err != SSL_ERROR_WANT_READ && err != SSL_ERROR_WANT_WRITE) {
+            break;
+        }
+
+        int left = (int) chrono::duration_cast<chrono::milliseconds>(deadline - chrono::steady_clock::now()).count();
+
+        if(left <= 0) {
+            timed_out = true;
+            break;
+        }
+
+        struct pollfd pfd;
+        pfd.fd = sock;
+        pfd.events = (err == SSL_ERROR_WANT_READ) ? POLLIN : POLLOUT;
+
+        if(poll(&pfd, 1, left) == -1 && errno != EINTR) {
+            break;
+        }
+    }
+
+    bool offloaded = false;
+
+    if(ret != 1) {
+        if(timed_out) {
+            logger->warn(l_id, "TLS handshake with " + peer + " timed out");
+        } else {
+            char buf[256];
+            ERR_error_string_n(ERR_get_error(), buf, sizeof(buf));
+            logger->warn(l_id, "TLS handshake with " + peer + " failed: " + buf);
+        }
+    } else {
+        offloaded = BIO_get_ktls_send(SSL_get_wbio(ssl)) && BIO_get_ktls_recv(SSL_get_rbio(ssl));
+
+        if(offloaded) {
+            LOG_DEBUG(logger, l_id, string("kernel took over ") + SSL_get_cipher_name(ssl) + " with " + peer);
+        } else {
+            logger->warn(l_id, string("kernel TLS not available for ") + SSL_get_cipher_name(ssl) + ", closing connection with " + peer);
+        }
+    }
+
+    ERR_clear_error();
+
+    // socket is not closed and keeps its keys in the kernel
+    SSL_free(ssl);
+
+    return offloaded && fcntl(sock, F_SETFL, flags) != -1;
+}
@@ -0,0 +1,37 @@
+#ifndef SERVER_TLSCONTEXT_H
+#define SERVER_TLSCONTEXT_H
+
+#include "main.h"
+#include "Logger.h"
+
+// seconds for the whole handshake, not per read
+#define TLS_HANDSHAKE_TIMEOUT 10
+// each running handshake has its own thread, connections past this are closed right away
+#define TLS_MAX_HANDSHAKES 16
+
+// record types reported by kTLS in the TLS_GET_RECORD_TYPE cmsg
+#define TLS_RECORD_ALERT 21
+#define TLS_RECORD_HANDSHAKE 22
+#define TLS_RECORD_APPLICATION_DATA 23
+#define TLS_ALERT_CLOSE_NOTIFY 0
+
+// TLS listener setup, after the handshake record encryption is left to the kernel (kTLS)
+class TlsContext {
+private:
+    SSL_CTX* ctx = nullptr;
+    Logger* logger;
+    std::string l_id = "tls";
+
+public:
+    TlsContext(const std::string&, const std::string&, Logger*);
+    TlsContext(const TlsContext&) = delete;
+    ~TlsContext();
+
+    bool isValid() { return ctx != nullptr; };
+
+    // runs the handshake within TLS_HANDSHAKE_TIMEOUT, true when kernel took over both directions
+    // and the socket can be used like a plain one
+    bool handshake(int, const std::string&);
+};
+
+#endif //SERVER_TLSCONTEXT_H
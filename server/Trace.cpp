@@ -0,0 +1,119 @@
+#include "Trace.h"
+
+using namespace std;
+
+thread_local RequestTrace* RequestTrace::current = nullptr;
+
+static const char* CATEGORY_NAME[TRACE_CATEGORIES] = {"db", "disk", "net"};
+
+static string formatMs(const uint64_t us) {
+    char buf[32];
+    snprintf(buf, sizeof(buf), "%.1f", us / 1000.0);
+    return buf;
+}
+
+RequestTrace::RequestTrace(const bool enabled): active(enabled) {
+    if(active) {
+        previous = current;
+        current = this;
+    }
+}
+
+RequestTrace::~RequestTrace() {
+    if(active) {
+        current = previous;
+    }
+}
+
+string RequestTrace::summary(const uint64_t request_us) const {
+    string line = "total_ms=" + formatMs(request_us) + " ";
+    uint64_t traced_us = 0;
+
+    for(int i=0; i<TRACE_CATEGORIES; i++) {
+        line += string(CATEGORY_NAME[i]) + "_ms=" + formatMs(total_us[i]) + " ";
+        line += string(CATEGORY_NAME[i]) + "_calls=" + to_string(calls[i]) + " ";
+        traced_us += total_us[i];
+    }
+
+    line += "other_ms=" + formatMs(request_us > traced_us ? request_us - traced_us : 0);
+    line += " spans=\"";
+
+    for(unsigned i=0; i<span_count; i++) {
+        const trace_span& span = spans[i];
+
+        if(i > 0) {
+            line += ",";
+        }
+
+        line += string(CATEGORY_NAME[span.category]) + ":" + span.name;
+        if(span.detail[0] != 0) {
+            line += "(" + string(span.detail) + ")";
+        }
+        if(span.count > 1) {
+            line += "*" + to_string(span.count);
+        }
+        line += "=" + formatMs(span.us);
+    }
+
+    unsigned total_calls = calls[TRACE_DB] + calls[TRACE_DISK] + calls[TRACE_NET];
+    if(total_calls > span_calls) {
+        line += ",+" + to_string(total_calls - span_calls) + " more";
+    }
+
+    line += "\"";
+    return line;
+}
+
+TraceSpan::TraceSpan(const TraceCategory category, const char* name, const string* detail):
+        trace(RequestTrace::current), category(category), name(name), detail(detail) {
+    if(trace == nullptr) {
+        return;
+    }
+
+    recording = (trace->depth++ == 0);
+
+    if(recording) {
+        start = chrono::steady_clock::now();
+    }
+}
+
+TraceSpan::~TraceSpan() {
+    if(trace == nullptr) {
+        return;
+    }
+
+    trace->depth--;
+
+    if(!recording) {
+        return;
+    }
+
+    uint64_t us = (uint64_t) chrono::duration_cast<chrono::microseconds>(chrono::steady_clock::now() - start).count();
+
+    trace->total_us[category] += us;
+    trace->calls[category]++;
+
+    char text[TRACE_DETAIL_SIZE];
+    text[detail != nullptr ? detail->copy(text, TRACE_DETAIL_SIZE - 1) : 0] = 0;
+
+    if(trace->span_count > 0) {
+        trace_span& last = trace->spans[trace->span_count - 1];
+
+        if(last.category == category && last.name == name && strcmp(last.detail, text) == 0) {
+            last.us += us;
+            last.count++;
+            trace->span_calls++;
+            return;
+        }
+    }
+
+    if(trace->span_count < TRACE_MAX_SPANS) {
+        trace_span& span = trace->spans[trace->span_count++];
+        span.category = category;
+        span.name = name;
+        span.us = us;
+        span.count = 1;
+        memcpy(span.detail, text, sizeof(text));
+        trace->span_calls++;
+    }
+}
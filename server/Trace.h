@@ -0,0 +1,80 @@
+#ifndef SERVER_TRACE_H
+#define SERVER_TRACE_H
+
+#include "main.h"
+
+// spans kept for the slow request log, later ones are only added to the totals
+#define TRACE_MAX_SPANS 32
+#define TRACE_DETAIL_SIZE 24
+
+enum TraceCategory {
+    TRACE_DB,
+    TRACE_DISK,
+    TRACE_NET,
+    TRACE_CATEGORIES,
+};
+
+struct trace_span {
+    TraceCategory category;
+    const char* name;
+    char detail[TRACE_DETAIL_SIZE];
+    uint64_t us;
+    // consecutive calls of the same span are merged
+    unsigned count;
+};
+
+// time spent in database, disk and network calls of the request handled by this thread
+class RequestTrace {
+private:
+    trace_span spans[TRACE_MAX_SPANS];
+    unsigned span_count = 0;
+    unsigned span_calls = 0;
+    uint64_t total_us[TRACE_CATEGORIES] = {};
+    unsigned calls[TRACE_CATEGORIES] = {};
+    // only the outermost span is recorded, calls made inside it are part of its time
+    unsigned depth = 0;
+    bool active;
+    RequestTrace* previous = nullptr;
+
+    static thread_local RequestTrace* current;
+
+    friend class TraceSpan;
+
+public:
+    // inactive trace costs nothing and records nothing
+    explicit RequestTrace(bool = true);
+    RequestTrace(const RequestTrace&) = delete;
+    ~RequestTrace();
+
+    bool isActive() const { return active; };
+
+    // key=value breakdown for the slow request log, time not spent in any span is reported as other
+    std::string summary(uint64_t) const;
+};
+
+class TraceSpan {
+private:
+    RequestTrace* trace;
+    TraceCategory category;
+    const char* name;
+    const std::string* detail;
+    bool recording = false;
+    std::chrono::steady_clock::time_point start;
+
+public:
+    TraceSpan(TraceCategory, const char*, const std::string* = nullptr);
+    TraceSpan(const TraceSpan&) = delete;
+    ~TraceSpan();
+};
+
+// runs a single call inside a span, for calls in the middle of a function
+template<typename F>
+auto traced(TraceCategory category, const char* name, F f) -> decltype(f()) {
+    TraceSpan span(category, name);
+    return f();
+}
+
+#define TRACE_SPAN(category, name) TraceSpan trace_span_(category, name)
+#define TRACE_SPAN_DETAIL(category, name, detail) TraceSpan trace_span_(category, name, &(detail))
+
+#endif //SERVER_TRACE_H
@@ -1,20 +1,34 @@
 #include "User.h"
+#include "utils.h"
 #include <sys/types.h>
 #include <sys/stat.h>
 #include <fstream>
+#include <fcntl.h>
 #include <functional>
+#include <set>
 
 using namespace mongocxx;
 using std::map;
 using std::vector;
 
 using bsoncxx::builder::basic::make_array;
+using bsoncxx::builder::basic::sub_array;
 
-User::User(oid& id1, UserManager& u_m): id(id1), user_manager(u_m), authorized(false), valid(true), currentInFileValid(false) {}
+User::User(oid& id1, UserManager& u_m): id(id1), user_manager(u_m), authorized(false), valid(true) {}
 
-User::User(UserManager& u_m):user_manager(u_m), authorized(false), valid(false), currentInFileValid(false) {}
+User::User(UserManager& u_m):user_manager(u_m), authorized(false), valid(false) {}
 
-User::User(const string& username, UserManager& u_m): user_manager(u_m), authorized(false), valid(false), currentInFileValid(false) {
+User::~User() {
+    for(auto& t: inFiles) {
+        closeTransfer(t.second);
+    }
+
+    for(auto& t: outFiles) {
+        closeTransfer(t.second);
+    }
+}
+
+User::User(const string& username, UserManager& u_m): user_manager(u_m), authorized(false), valid(false) {
     addUsername(username);
 }
 
@@ -69,12 +83,12 @@ bool User::checkPassword(const string& passwd) {
 bool User::loginByPassword(string& password, string& sid) {
     authorized = false;
     if(checkPassword(password)) {
-        uint8_t t_sid_b[48];
-        if(RAND_bytes(t_sid_b, 48) != 1) {
+        uint8_t t_sid_b[SID_SIZE];
+        if(RAND_bytes(t_sid_b, SID_SIZE) != 1) {
             return false;
         }
 
-        string t_sid((char*)t_sid_b, 48);
+        string t_sid((char*)t_sid_b, SID_SIZE);
 
         if(!user_manager.addSid(id, t_sid)) {
             return false;
@@ -103,9 +117,50 @@ bool User::listFilesinPath(const string& path, vector<UFile>& res) {
     return user_manager.listFilesinPath(id, path, res);
 }
 
+void User::closeTransfer(UTransfer& t) {
+    if(t.fd != -1) {
+        if(io != nullptr) {
+            io->forgetFile(t.fd);
+        }
+        close(t.fd);
+        t.fd = -1;
+    }
+}
+
+UTransfer* User::findTransfer(std::map<uint32_t, UTransfer>& transfers, const uint32_t stream) {
+    auto it = transfers.find(stream);
+    return (it == transfers.end()) ? nullptr : &it->second;
+}
+
+UTransfer* User::openTransfer(std::map<uint32_t, UTransfer>& transfers, const uint32_t stream) {
+    UTransfer* t = findTransfer(transfers, stream);
+
+    if(t != nullptr) {
+        t->valid = false;
+        return t;
+    }
+
+    // finished transfers are kept for their metadata until the table fills up
+    if(transfers.size() >= MAX_STREAMS) {
+        for(auto it=transfers.begin(); it != transfers.end();) {
+            if(!it->second.valid) {
+                closeTransfer(it->second);
+                it = transfers.erase(it);
+            } else {
+                it++;
+            }
+        }
+
+        if(transfers.size() >= MAX_STREAMS) {
+            return nullptr;
+        }
+    }
+
+    return &transfers[stream];
+}
+
 // also adds directory
-uint8_t User::addFile(UFile& file) {
-    currentInFileValid = false;
+uint8_t User::addFile(UFile& file, const uint32_t stream) {
     if(file.filename[0] != '/') {
         return ADD_FILE_WRONG_DIR;
     }
@@ -126,6 +181,13 @@ uint8_t User::addFile(UFile& file) {
         return ADD_FILE_WRONG_DIR;
     }
 
+    // a malformed request leaves the stream's previous upload alone
+    UTransfer* in = nullptr;
+
+    if(file.type == FILE_REGULAR && (in = openTransfer(inFiles, stream)) == nullptr) {
+        return ADD_FILE_TOO_MANY_STREAMS;
+    }
+
     if(user_manager.yourFileExists(id, file.filename)) {
         if(file.type == FILE_REGULAR) {
             UFile tmp_file;
@@ -136,9 +198,9 @@ uint8_t User::addFile(UFile& file) {
                     if(!user_manager.getFreeSpace(id, availableSpace) || availableSpace < spaceNeeded) {
                         return ADD_FILE_NO_SPACE;
                     }
-                    currentInFile = tmp_file;
-                    currentInFile.owner = id;
-                    currentInFileValid = true;
+                    in->file = tmp_file;
+                    in->file.owner = id;
+                    in->valid = true;
                     return ADD_FILE_CONTINUE_OK;
                 }
             }
@@ -156,12 +218,12 @@ uint8_t User::addFile(UFile& file) {
                 return ADD_FILE_NO_SPACE;
             }
 
-            currentInFile = file;
-            currentInFile.isValid = false;
-            currentInFile.lastValid = 0;
-            currentInFile.id = fileId;
-            currentInFile.owner = id;
-            currentInFileValid = true;
+            in->file = file;
+            in->file.isValid = false;
+            in->file.lastValid = 0;
+            in->file.id = fileId;
+            in->file.owner = id;
+            in->valid = true;
         }
 
         return ADD_FILE_OK;
@@ -170,37 +232,106 @@ uint8_t User::addFile(UFile& file) {
     return ADD_FILE_INTERNAL_ERROR;
 }
 
-const UFile& User::getCurrentInFileMetadata() {
-    return currentInFile;
+const UFile& User::getCurrentInFileMetadata(const uint32_t stream) {
+    static const UFile empty = UFile();
+    UTransfer* in = findTransfer(inFiles, stream);
+    return (in == nullptr) ? empty : in->file;
 }
 
-bool User::isCurrentInFileValid() {
-    return currentInFileValid;
+bool User::isCurrentInFileValid(const uint32_t stream) {
+    UTransfer* in = findTransfer(inFiles, stream);
+    return in != nullptr && in->valid;
 }
 
-bool User::addFileChunk(const string& chunk) {
-    if(!currentInFileValid) {
+bool User::addFileChunk(const string& chunk, const uint32_t stream) {
+    UTransfer* in = findTransfer(inFiles, stream);
+
+    if(in == nullptr || !in->valid) {
         return false;
     }
 
+    if(io != nullptr) {
+        // written through the descriptor of the stream, like raw chunks
+        int fd;
+        const uint64_t offset = in->file.lastValid;
+
+        return beginFileChunk(offset, chunk.size(), fd, stream)
+               && traced(TRACE_DISK, "writeFileChunk", [&] { return io->writeFile(fd, (const uint8_t*) chunk.c_str(), chunk.size(), offset); })
+               && commitFileChunk(chunk.size(), stream);
+    }
+
     uint64_t freeSpace;
     if(!user_manager.getFreeSpace(id, freeSpace) || freeSpace < chunk.size()) {
         return false;
     }
 
-    if(currentInFile.size < currentInFile.lastValid + chunk.size()) {
+    if(in->file.size < in->file.lastValid + chunk.size()) {
         return false;
     }
 
-    if(!user_manager.addFileChunk(currentInFile, chunk)) {
+    if(!user_manager.addFileChunk(in->file, chunk)) {
         return false;
     }
 
-    if(currentInFile.size != currentInFile.lastValid) {
+    if(in->file.size != in->file.lastValid) {
         return true;
     }
 
-    return user_manager.validateFile(currentInFile);
+    in->valid = false;
+
+    return user_manager.validateFile(in->file);
+}
+
+bool User::beginFileChunk(const uint64_t offset, const uint64_t len, int& fd, const uint32_t stream) {
+    UTransfer* in = findTransfer(inFiles, stream);
+
+    if(in == nullptr || !in->valid || offset != in->file.lastValid) {
+        return false;
+    }
+
+    uint64_t freeSpace;
+    if(!user_manager.getFreeSpace(id, freeSpace) || freeSpace < len) {
+        return false;
+    }
+
+    if(in->file.size < in->file.lastValid + len) {
+        return false;
+    }
+
+    if(in->fd == -1 || in->fdPath != in->file.realPath) {
+        closeTransfer(*in);
+
+        in->fd = traced(TRACE_DISK, "open", [&] { return open(in->file.realPath.c_str(), O_WRONLY | O_CREAT | O_CLOEXEC, S_IRUSR | S_IWUSR); });
+        in->fdPath = in->file.realPath;
+
+        if(in->fd == -1) {
+            return false;
+        }
+    }
+
+    if(offset == 0 && traced(TRACE_DISK, "ftruncate", [&] { return ftruncate(in->fd, 0); }) == -1) {
+        return false;
+    }
+
+    fd = in->fd;
+    return true;
+}
+
+bool User::commitFileChunk(const uint64_t len, const uint32_t stream) {
+    UTransfer* in = findTransfer(inFiles, stream);
+
+    if(in == nullptr || !user_manager.commitFileChunk(in->file, len)) {
+        return false;
+    }
+
+    if(in->file.size != in->file.lastValid) {
+        return true;
+    }
+
+    in->valid = false;
+    closeTransfer(*in);
+
+    return user_manager.validateFile(in->file);
 }
 
 bool User::isAdmin() {
@@ -261,27 +392,33 @@ bool User::changeUserPasswd(const string& username, const string& new_passwd) {
     return user_manager.runAsUser(username, [&new_passwd, this](oid& id) -> bool {return user_manager.setPasswd(id, new_passwd);});
 }
 
-bool User::initFileDownload(const string& filename, const uint64_t pos, string& chunk) {
-    currentOutFileValid = false;
-    if(!user_manager.yourFileExists(id, filename)) {
+bool User::prepareFileDownload(const string& filename, const uint64_t pos, const uint32_t stream) {
+    UTransfer* out = openTransfer(outFiles, stream);
+
+    if(out == nullptr || !user_manager.yourFileExists(id, filename)) {
         return false;
     }
 
-    if(!user_manager.getYourFileMetadata(id, filename, currentOutFile, FILE_REGULAR)) {
+    if(!user_manager.getYourFileMetadata(id, filename, out->file, FILE_REGULAR)) {
         return false;
     }
 
-    if(pos >= currentOutFile.size) {
+    if(pos >= out->file.size) {
         return false;
     }
 
-    currentOutFileValid = true;
-    currentOutFile.lastValid = pos;
+    out->valid = true;
+    out->file.lastValid = pos;
 
-    return getFileChunk(chunk);
+    return true;
 }
 
-bool User::initSharedFileDownload(const string& filename, const string& ownerUsername, const string& hash, const uint64_t pos, string& chunk) {
+bool User::prepareSharedFileDownload(const string& filename, const string& ownerUsername, const string& hash, const uint64_t pos, const uint32_t stream) {
+    UTransfer* out = openTransfer(outFiles, stream);
+    if(out == nullptr) {
+        return false;
+    }
+
     oid ownerId, fileId;
     if(!user_manager.getUserId(ownerUsername, ownerId)) {
         return false;
@@ -303,27 +440,111 @@ bool User::initSharedFileDownload(const string& filename, const string& ownerUse
         return false;
     }
 
-    if(pos >= currentOutFile.size) {
+    if(pos >= file.size) {
+        return false;
+    }
+
+    out->file = file;
+    out->valid = true;
+    out->file.lastValid = pos;
+
+    return true;
+}
+
+bool User::getFileChunk(string& chunk, const uint32_t stream) {
+    UTransfer* out = findTransfer(outFiles, stream);
+
+    if(out == nullptr || !out->valid) {
+        return false;
+    }
+
+    if(io != nullptr) {
+        int fd;
+        uint64_t offset, len;
+
+        if(!getFileChunkRange(fd, offset, len, stream)) {
+            return false;
+        }
+
+        uint64_t left = out->file.size - out->file.lastValid;
+        chunk.resize(len);
+
+        if(!traced(TRACE_DISK, "getFileChunk", [&] { return io->readFile(fd, (uint8_t*) &chunk[0], len, offset, std::min(left, (uint64_t) OUT_FILE_CHUNK_SIZE)); })) {
+            // chunk can be asked for again
+            out->file.lastValid = offset;
+            out->valid = true;
+            return false;
+        }
+
+        return true;
+    }
+
+    if(!user_manager.getFileChunk(out->file, chunk)) {
         return false;
     }
 
-    currentOutFileValid = true;
-    currentOutFile.lastValid = pos;
+    if(out->file.lastValid == out->file.size) {
+        out->valid = false;
+    }
+
+    return true;
+}
+
+bool User::isCurrentOutFileValid(const uint32_t stream) {
+    UTransfer* out = findTransfer(outFiles, stream);
+    return out != nullptr && out->valid;
+}
 
-    return getFileChunk(chunk);
+uint64_t User::getCurrentOutFilePos(const uint32_t stream) {
+    UTransfer* out = findTransfer(outFiles, stream);
+    return (out == nullptr) ? 0 : out->file.lastValid;
 }
 
-bool User::getFileChunk(string& chunk) {
-    if(!currentOutFileValid) {
+bool User::openOutFile(UTransfer& out) {
+    // descriptor stays open between chunks of the same file
+    if(out.fd != -1 && out.fdPath == out.file.realPath) {
+        return true;
+    }
+
+    closeTransfer(out);
+
+    out.fd = traced(TRACE_DISK, "open", [&] { return open(out.file.realPath.c_str(), O_RDONLY | O_CLOEXEC); });
+    out.fdPath = out.file.realPath;
+
+    if(out.fd == -1) {
         return false;
     }
 
-    if(!user_manager.getFileChunk(currentOutFile, chunk)) {
+    posix_fadvise(out.fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+    return true;
+}
+
+void User::readAheadOutFile(const uint64_t end, const uint32_t stream) {
+    UTransfer* out = findTransfer(outFiles, stream);
+
+    if(out == nullptr || !out->valid || end <= out->file.lastValid || !openOutFile(*out)) {
+        return;
+    }
+
+    uint64_t len = std::min(end, out->file.size) - out->file.lastValid;
+    posix_fadvise(out->fd, (off_t) out->file.lastValid, (off_t) len, POSIX_FADV_WILLNEED);
+}
+
+bool User::getFileChunkRange(int& fd, uint64_t& offset, uint64_t& len, const uint32_t stream) {
+    UTransfer* out = findTransfer(outFiles, stream);
+
+    if(out == nullptr || !out->valid || !openOutFile(*out)) {
         return false;
     }
 
-    if(currentOutFile.lastValid == currentOutFile.size) {
-        currentOutFileValid = false;
+    fd = out->fd;
+    offset = out->file.lastValid;
+    len = (out->file.size - offset > OUT_FILE_CHUNK_SIZE) ? OUT_FILE_CHUNK_SIZE : (out->file.size - offset);
+
+    out->file.lastValid += len;
+
+    if(out->file.lastValid == out->file.size) {
+        out->valid = false;
     }
 
     return true;
@@ -416,33 +637,215 @@ void UserManager::garbageCollectorMain(std::condition_variable& g_cond, bool& sh
     while (!should_exit) {
         logger.log("UserManager", "running garbage collector");
         collectOldUnfinished();
+        pruneSessions();
         std::unique_lock<std::mutex> lock(g_mutex);
         g_cond.wait_for(lock, std::chrono::minutes(5));
     }
 }
 
+bool UserManager::loadUser(bsoncxx::document::value&& filter, UCached& user) {
+    bool found = false;
+
+    bool ok = db.forEachDoc("users", std::move(filter), {"username", "name", "surname", "homeDir", "role", "totalSpace", "freeSpace"},
+            [this, &user, &found](const bsoncxx::document::view& doc) {
+        try {
+            user.id = doc["_id"].get_oid().value;
+            user.username = bsoncxx::string::to_string(doc["username"].get_utf8().value);
+            user.name = bsoncxx::string::to_string(doc["name"].get_utf8().value);
+            user.surname = bsoncxx::string::to_string(doc["surname"].get_utf8().value);
+            user.homeDir = bsoncxx::string::to_string(doc["homeDir"].get_utf8().value);
+            user.role = (uint64_t) doc["role"].get_int64().value;
+            user.totalSpace = (uint64_t) doc["totalSpace"].get_int64().value;
+            user.freeSpace = (uint64_t) doc["freeSpace"].get_int64().value;
+            found = true;
+        } catch (const std::exception& ex) {
+            logger.err(l_id, "error while parsing user record: " + string(ex.what()));
+        }
+    });
+
+    return ok && found;
+}
+
+bool UserManager::getCachedUser(oid& id, UCached& user) {
+    uint64_t seq;
+    {
+        std::lock_guard<std::mutex> l(cache_mutex);
+        auto it = user_cache.find(id);
+
+        if(it != user_cache.end() && std::chrono::steady_clock::now() - it->second.loaded < std::chrono::seconds(USER_CACHE_TTL_SECONDS)) {
+            user = it->second;
+            return true;
+        }
+
+        seq = write_seq;
+    }
+
+    if(!loadUser(make_document(kvp("_id", id)), user)) {
+        return false;
+    }
+
+    storeCachedUser(user, seq);
+    return true;
+}
+
+bool UserManager::getCachedUser(const string& username, UCached& user) {
+    uint64_t seq;
+    {
+        std::lock_guard<std::mutex> l(cache_mutex);
+        auto id = user_ids.find(username);
+
+        if(id != user_ids.end()) {
+            auto it = user_cache.find(id->second);
+
+            if(it != user_cache.end() && std::chrono::steady_clock::now() - it->second.loaded < std::chrono::seconds(USER_CACHE_TTL_SECONDS)) {
+                user = it->second;
+                return true;
+            }
+        }
+
+        seq = write_seq;
+    }
+
+    if(!loadUser(make_document(kvp("username", username)), user)) {
+        return false;
+    }
+
+    storeCachedUser(user, seq);
+    return true;
+}
+
+void UserManager::storeCachedUser(const UCached& user, uint64_t seq) {
+    std::lock_guard<std::mutex> l(cache_mutex);
+
+    if(seq < writes_cleared) {
+        return;
+    }
+
+    // writes of other users don't matter, only one of this user could have been missed by the load
+    auto w = user_writes.find(user.id);
+
+    if(w != user_writes.end() && w->second > seq) {
+        return;
+    }
+
+    if(user_cache.size() >= USER_CACHE_MAX_ENTRIES && user_cache.find(user.id) == user_cache.end()) {
+        auto now = std::chrono::steady_clock::now();
+
+        for(auto it = user_cache.begin(); it != user_cache.end();) {
+            if(now - it->second.loaded >= std::chrono::seconds(USER_CACHE_TTL_SECONDS)) {
+                user_ids.erase(it->second.username);
+                it = user_cache.erase(it);
+            } else {
+                it++;
+            }
+        }
+
+        if(user_cache.size() >= USER_CACHE_MAX_ENTRIES) {
+            return;
+        }
+    }
+
+    UCached& entry = user_cache[user.id];
+    entry = user;
+    entry.loaded = std::chrono::steady_clock::now();
+    user_ids[user.username] = user.id;
+}
+
+void UserManager::noteUserWrite(oid& id) {
+    if(user_writes.size() >= USER_CACHE_MAX_ENTRIES && user_writes.find(id) == user_writes.end()) {
+        user_writes.clear();
+        writes_cleared = write_seq + 1;
+    }
+
+    user_writes[id] = ++write_seq;
+}
+
+void UserManager::updateCachedUser(oid& id, const std::function<void(UCached&)>& update) {
+    std::lock_guard<std::mutex> l(cache_mutex);
+    noteUserWrite(id);
+
+    auto it = user_cache.find(id);
+
+    if(it != user_cache.end()) {
+        update(it->second);
+    }
+}
+
+void UserManager::forgetCachedUser(oid& id) {
+    std::lock_guard<std::mutex> l(cache_mutex);
+    noteUserWrite(id);
+
+    auto it = user_cache.find(id);
+
+    if(it != user_cache.end()) {
+        user_ids.erase(it->second.username);
+        user_cache.erase(it);
+    }
+}
+
 bool UserManager::getName(oid& id, string& res) {
-    return db.getField("users", "name", id, res);
+    UCached user;
+
+    if(!getCachedUser(id, user)) {
+        return false;
+    }
+
+    res = user.name;
+    return true;
 }
 
 bool UserManager::getSurname(oid& id, string& res) {
-    return db.getField("users", "surname", id, res);
+    UCached user;
+
+    if(!getCachedUser(id, user)) {
+        return false;
+    }
+
+    res = user.surname;
+    return true;
 }
 
 bool UserManager::getHomeDir(oid& id, string& res) {
-    return db.getField("users", "homeDir", id, res);
+    UCached user;
+
+    if(!getCachedUser(id, user)) {
+        return false;
+    }
+
+    res = user.homeDir;
+    return true;
 }
 
 bool UserManager::setName(oid& id, string& res) {
-    return db.setField("users", "name", id, res);
+    if(!db.setField("users", "name", id, res)) {
+        forgetCachedUser(id);
+        return false;
+    }
+
+    updateCachedUser(id, [&res](UCached& user) { user.name = res; });
+    return true;
 }
 
 bool UserManager::getUserRole(oid& id, uint64_t& role) {
-    return db.getField("users", "role", id, (int64_t&)role);
+    UCached user;
+
+    if(!getCachedUser(id, user)) {
+        return false;
+    }
+
+    role = user.role;
+    return true;
 }
 
 bool UserManager::getUserId(const string& username, oid& id) {
-    return db.getId("users", "username", username, id);
+    UCached user;
+
+    if(!getCachedUser(username, user)) {
+        return false;
+    }
+
+    id = user.id;
+    return true;
 }
 
 bool UserManager::getPasswdHash(oid& id, string& res) {
@@ -457,7 +860,7 @@ bool UserManager::getPasswdHash(oid& id, string& res) {
 }
 
 bool UserManager::checkPasswd(oid& id, const string& passwd) {
-    auto digest = new uint8_t[SHA512_DIGEST_LENGTH];
+    uint8_t digest[SHA512_DIGEST_LENGTH];
 
     SHA512((const uint8_t*) passwd.c_str(), passwd.size(), digest);
 
@@ -465,18 +868,16 @@ bool UserManager::checkPasswd(oid& id, const string& passwd) {
     string current_hash;
 
     if(!getPasswdHash(id, current_hash)) {
-        delete digest;
         return false;
     }
 
     bool wyn = (current_hash == hash_to_check);
-    delete digest;
 
     return wyn;
 }
 
 bool UserManager::setPasswd(oid& id, const string& passwd) {
-    auto digest = new uint8_t[SHA512_DIGEST_LENGTH];
+    uint8_t digest[SHA512_DIGEST_LENGTH];
 
     SHA512((const uint8_t*) passwd.c_str(), passwd.size(), digest);
 
@@ -485,20 +886,226 @@ bool UserManager::setPasswd(oid& id, const string& passwd) {
     return db.setField("users", "password", id, (const uint8_t*) hash.c_str(), (uint32_t) hash.size());
 }
 
+string UserManager::hashSid(const string& sid) {
+    uint8_t digest[SHA256_DIGEST_LENGTH];
+    SHA256((const uint8_t*) sid.c_str(), sid.size(), digest);
+    return string((const char*) digest, SHA256_DIGEST_LENGTH);
+}
+
+void UserManager::setSessionTtl(std::chrono::seconds ttl) {
+    session_ttl = ttl;
+}
+
+void UserManager::cacheSession(const string& hash, const USession& session) {
+    std::lock_guard<std::mutex> l(session_mutex);
+
+    if(session_cache.size() >= SESSION_CACHE_MAX_ENTRIES && session_cache.find(hash) == session_cache.end()) {
+        return;
+    }
+
+    session_cache[hash] = session;
+}
+
+void UserManager::forgetSessions(oid& id) {
+    std::lock_guard<std::mutex> l(session_mutex);
+
+    for(auto it = session_cache.begin(); it != session_cache.end();) {
+        if(it->second.userId == id) {
+            it = session_cache.erase(it);
+        } else {
+            it++;
+        }
+    }
+}
+
+void UserManager::pruneSessions() {
+    auto now = std::chrono::system_clock::now();
+    size_t pruned = 0;
+    {
+        std::lock_guard<std::mutex> l(session_mutex);
+
+        for(auto it = session_cache.begin(); it != session_cache.end();) {
+            if(it->second.expires <= now) {
+                it = session_cache.erase(it);
+                pruned++;
+            } else {
+                it++;
+            }
+        }
+    }
+
+    // the collection itself is cleaned by the expires TTL index
+    if(pruned > 0) {
+        logger.log(l_id, "pruned " + std::to_string(pruned) + " expired sessions");
+    }
+}
+
+bool UserManager::storeSession(oid& id, const string& hash, std::chrono::system_clock::time_point expires) {
+    USession session;
+    session.userId = id;
+    session.expires = expires;
+
+    auto doc = bsoncxx::builder::basic::document{};
+    doc.append(kvp("sid", Database::stringToBinary(hash)));
+    doc.append(kvp("userId", toOID(id)));
+    doc.append(kvp("expires", bsoncxx::types::b_date(session.expires)));
+
+    if(!db.insertDoc("sessions", session.id, doc)) {
+        return false;
+    }
+
+    cacheSession(hash, session);
+    return true;
+}
+
 bool UserManager::addSid(oid& id, string& sid) {
-    return db.pushValToArr("users", "sids", id, make_document(
-            kvp("sid", Database::stringToBinary(sid)),
-            kvp("time", bsoncxx::types::b_date(std::chrono::system_clock::now()))
-    ));
+    return storeSession(id, hashSid(sid), std::chrono::system_clock::now() + session_ttl);
 }
 
 bool UserManager::checkSid(oid& id, string& sid) {
-    uint64_t tmp_l = 0;
-    return (db.countField("users", "sids.sid", id, (const uint8_t*) sid.c_str(), sid.size(), tmp_l) && tmp_l == 1);
+    string hash = hashSid(sid);
+    auto now = std::chrono::system_clock::now();
+    USession session;
+    bool found = false;
+    {
+        std::lock_guard<std::mutex> l(session_mutex);
+        auto it = session_cache.find(hash);
+
+        if(it != session_cache.end()) {
+            if(it->second.expires <= now) {
+                session_cache.erase(it);
+                return false;
+            }
+
+            session = it->second;
+            found = true;
+        }
+    }
+
+    if(!found) {
+        // TTL monitor of the server runs only once a minute, so expired documents are filtered out here too
+        db.forEachDoc("sessions", make_document(
+                kvp("sid", Database::stringToBinary(hash)),
+                kvp("expires", make_document(kvp("$gt", bsoncxx::types::b_date(now))))
+        ), {"userId", "expires"}, [&session, &found](const bsoncxx::document::view& doc) {
+            session.id = doc["_id"].get_oid().value;
+            session.userId = doc["userId"].get_oid().value;
+            session.expires = doc["expires"].get_date();
+            found = true;
+        });
+
+        if(!found) {
+            return false;
+        }
+
+        cacheSession(hash, session);
+    }
+
+    if(session.userId != id) {
+        return false;
+    }
+
+    // sessions in use are extended, at most one write per half of the expiry time
+    if(session.expires - now < session_ttl / 2) {
+        session.expires = now + session_ttl;
+
+        if(db.setField("sessions", "expires", session.id, bsoncxx::types::value{bsoncxx::types::b_date(session.expires)})) {
+            cacheSession(hash, session);
+        }
+    }
+
+    return true;
 }
 
 bool UserManager::removeSid(oid& id, string &sid) {
-    return db.removeFieldFromArray("users", "sids", id, make_document(kvp("sid", Database::stringToBinary(sid))));
+    string hash = hashSid(sid);
+    {
+        std::lock_guard<std::mutex> l(session_mutex);
+        session_cache.erase(hash);
+    }
+
+    return db.deleteDocs("sessions", make_document(kvp("sid", Database::stringToBinary(hash)), kvp("userId", id)));
+}
+
+bool UserManager::migrateSids() {
+    auto now = std::chrono::system_clock::now();
+    vector<std::pair<string, USession> > sids;
+    uint64_t skipped = 0;
+
+    bool ok = db.forEachDoc("users", make_document(kvp("sids", make_document(kvp("$exists", true)))), {"sids"},
+            [this, now, &sids, &skipped](const bsoncxx::document::view& doc) {
+        oid userId = doc["_id"].get_oid().value;
+
+        for(auto&& el: doc["sids"].get_array().value) {
+            bsoncxx::document::view s = el.get_document().value;
+            std::chrono::system_clock::time_point created = s["time"].get_date();
+
+            if(created + session_ttl <= now) {
+                skipped++;
+                continue;
+            }
+
+            // old documents kept plain sids, expiry counts from the original login
+            bsoncxx::types::b_binary b_sid = s["sid"].get_binary();
+            USession session;
+            session.userId = userId;
+            session.expires = created + session_ttl;
+            sids.emplace_back(hashSid(string((const char*) b_sid.bytes, b_sid.size)), session);
+        }
+    });
+
+    if(!ok) {
+        return false;
+    }
+
+    if(sids.empty() && skipped == 0) {
+        return true;
+    }
+
+    uint64_t moved = 0;
+    std::set<oid> failed;
+
+    for(auto& entry: sids) {
+        if(storeSession(entry.second.userId, entry.first, entry.second.expires)) {
+            moved++;
+            continue;
+        }
+
+        // sids moved by an interrupted earlier run fail on the unique index, any other error keeps the old sids
+        bool stored = false;
+
+        db.forEachDoc("sessions", make_document(
+                kvp("sid", Database::stringToBinary(entry.first)),
+                kvp("userId", toOID(entry.second.userId))
+        ), {"_id"}, [&stored](const bsoncxx::document::view&) {
+            stored = true;
+        });
+
+        if(stored) {
+            moved++;
+        } else {
+            failed.insert(entry.second.userId);
+        }
+    }
+
+    logger.info(l_id, "moved " + std::to_string(moved) + " sids to sessions, dropped " + std::to_string(skipped) + " expired");
+
+    auto filter = bsoncxx::builder::basic::document{};
+    filter.append(kvp("sids", make_document(kvp("$exists", true))));
+
+    if(!failed.empty()) {
+        // users are left as they are and moved again on the next start
+        logger.warn(l_id, "couldn't move sids of " + std::to_string(failed.size()) + " users, keeping them");
+
+        auto ids = bsoncxx::builder::basic::array{};
+        for(auto& id: failed) {
+            ids.append(toOID(id));
+        }
+
+        filter.append(kvp("_id", make_document(kvp("$nin", ids))));
+    }
+
+    return db.unsetField("users", filter.extract(), "sids") && failed.empty();
 }
 
 bool UserManager::parseUserDetails(map<string, bsoncxx::types::value>& usr, UDetails& tmp_u) {
@@ -521,17 +1128,19 @@ bool UserManager::parseUserDetails(map<string, bsoncxx::types::value>& usr, UDet
 }
 
 bool UserManager::getUserDetails(oid id, UDetails& userDetails) {
-    map<string, bsoncxx::types::value> mmap;
-    vector<string> fields{"username", "surname", "name", "role", "totalSpace", "freeSpace"};
-    for(string field: fields) {
-        mmap.emplace(field, bsoncxx::types::value(bsoncxx::types::b_null{}));
-    }
+    UCached user;
 
-    if(!db.getFields("users", id, mmap)) {
+    if(!getCachedUser(id, user)) {
         return false;
     }
 
-    return parseUserDetails(mmap, userDetails);
+    userDetails.username = user.username;
+    userDetails.name = user.name;
+    userDetails.surname = user.surname;
+    userDetails.role = (uint8_t) user.role;
+    userDetails.totalSpace = user.totalSpace;
+    userDetails.usedSpace = user.totalSpace - user.freeSpace;
+    return true;
 }
 
 bool UserManager::registerUser(UDetails& user, const string& password, bool& userTaken) {
@@ -558,7 +1167,7 @@ bool UserManager::registerUser(UDetails& user, const string& password, bool& use
 
         string fullPath = root_path + homeDir;
 
-        int mkdir_res = mkdir(fullPath.c_str(), S_IRWXU);
+        int mkdir_res = traced(TRACE_DISK, "mkdir", [&] { return mkdir(fullPath.c_str(), S_IRWXU); });
 
         if(mkdir_res != 0) {
             logger.err(l_id, "error while trying to mkdir " + fullPath + " for new user");
@@ -612,13 +1221,14 @@ bool UserManager::listFilesinPath(oid& id, const string& path, vector<UFile>& fi
 
     string parsedPath = path;
 
-    if(parsedPath[parsedPath.size()-1] != '/') {
-        parsedPath.push_back('/');
+    // children keep the parent without the trailing slash, except for the root
+    if(parsedPath.size() > 1 && parsedPath[parsedPath.size()-1] == '/') {
+        parsedPath.pop_back();
     }
 
     mongocxx::pipeline stages;
 
-    stages.match(make_document(kvp("owner", id), kvp("isValid", true), kvp("filename", bsoncxx::types::b_regex("^"+parsedPath+"[^/]*[^/]$"))));
+    stages.match(make_document(kvp("owner", id), kvp("isValid", true), kvp("parent", parsedPath)));
     stages.lookup(make_document(kvp("from", "users"), kvp("localField", "owner"), kvp("foreignField", "_id"), kvp("as", "ownerTMP")));
     stages.unwind("$ownerTMP");
     stages.add_fields(make_document(kvp("ownerName", make_document(kvp("$concat", make_array("$ownerTMP.name", " ", "$ownerTMP.surname"))))));
@@ -694,8 +1304,13 @@ bsoncxx::types::b_binary UserManager::toBinary(string& str) {
 bool UserManager::addNewFile(oid& id, UFile& file, string& dir, oid& newId) {
     auto doc = bsoncxx::builder::basic::document{};
 
+    string parent, name;
+    Database::splitPath(file.filename, parent, name);
+
     if(file.type == FILE_REGULAR) {
         doc.append(kvp("filename", toUTF8(file.filename)));
+        doc.append(kvp("parent", toUTF8(parent)));
+        doc.append(kvp("name", toUTF8(name)));
         doc.append(kvp("size", toINT64(file.size)));
         doc.append(kvp("creationDate", currDate()));
         doc.append(kvp("type", toINT64(FILE_REGULAR)));
@@ -713,7 +1328,7 @@ bool UserManager::addNewFile(oid& id, UFile& file, string& dir, oid& newId) {
         string fullPath = root_path + homeDir + file.filename;
 
         std::fstream fs;
-        fs.open(fullPath, std::ios::out);
+        traced(TRACE_DISK, "create", [&] { fs.open(fullPath, std::ios::out); });
 
         if(!fs.is_open()) {
             return false;
@@ -730,6 +1345,8 @@ bool UserManager::addNewFile(oid& id, UFile& file, string& dir, oid& newId) {
     } else if(file.type == FILE_DIR) {
         string tmp = "";
         doc.append(kvp("filename", toUTF8(file.filename)));
+        doc.append(kvp("parent", toUTF8(parent)));
+        doc.append(kvp("name", toUTF8(name)));
         doc.append(kvp("size", toINT64(0)));
         doc.append(kvp("creationDate", currDate()));
         doc.append(kvp("type", toINT64(FILE_DIR)));
@@ -745,7 +1362,7 @@ bool UserManager::addNewFile(oid& id, UFile& file, string& dir, oid& newId) {
         }
 
         string fullPath = root_path + homeDir + file.filename;
-        int mkdir_res = mkdir(fullPath.c_str(), S_IRWXU);
+        int mkdir_res = traced(TRACE_DISK, "mkdir", [&] { return mkdir(fullPath.c_str(), S_IRWXU); });
 
         if(mkdir_res != 0) {
             logger.err(l_id, "mkdir error while trying to create directory: " + fullPath);
@@ -857,7 +1474,9 @@ bool UserManager::getYourFileMetadata(oid& id, const string& filename, UFile& fi
     return true;
 }
 
-bool UserManager::addFileChunk(UFile& file, const string& chunk) {
+bool UserManager::writeFileChunk(UFile& file, const string& chunk) {
+    TRACE_SPAN(TRACE_DISK, "writeFileChunk");
+
     std::fstream fs;
     if(file.lastValid == 0) {
         fs.open(file.realPath, std::ios::out | std::ios::binary | std::ios::trunc);
@@ -876,21 +1495,32 @@ bool UserManager::addFileChunk(UFile& file, const string& chunk) {
 
     fs.close();
 
-    file.lastValid += chunk.size();
+    return true;
+}
 
-    if(db.incField("files", file.id, "lastValid", chunk.size())) {
-        return updateLastChunkTime(file) && changeFreeSpace(file.owner, -chunk.size());
+bool UserManager::addFileChunk(UFile& file, const string& chunk) {
+    return writeFileChunk(file, chunk) && commitFileChunk(file, chunk.size());
+}
+
+bool UserManager::commitFileChunk(UFile& file, uint64_t len) {
+    file.lastValid += len;
+
+    if(db.incField("files", file.id, "lastValid", len)) {
+        return updateLastChunkTime(file) && changeFreeSpace(file.owner, -((int64_t) len));
     }
 
     return false;
 }
 
 bool UserManager::validateFile(UFile& file) {
+    TRACE_SPAN(TRACE_DISK, "validateFile");
     uint8_t hash[FILE_HASH_SIZE];
-    SHA_CTX sha1;
-    SHA1_Init(&sha1);
+    HashContext sha1;
+    if(!sha1.init(StorageCloud::HashAlgorithm::H_SHA1)) {
+        return false;
+    }
     const int bufSize = 32768;
-    uint8_t* buffer = new uint8_t[bufSize];
+    PooledBuffer buffer(bufSize);
 
     std::ifstream is (file.realPath, std::ios::binary | std::ios::in);
     if(!is.is_open()) {
@@ -908,21 +1538,19 @@ bool UserManager::validateFile(UFile& file) {
     }
 
     do {
-        is.read((char*) buffer, bufSize);
+        is.read((char*) buffer.data(), bufSize);
         if(is.bad()) {
             break;
         }
-        SHA1_Update(&sha1, buffer, is.gcount());
+        sha1.update({buffer.data(), (size_t) is.gcount()});
     } while(!is.eof());
 
-    delete buffer;
-
     if(!is.eof()) {
         deleteFile(file.owner, file.filename);
         return false;
     }
 
-    SHA1_Final(hash, &sha1);
+    sha1.final({hash, sizeof(hash)});
 
     is.close();
 
@@ -976,13 +1604,16 @@ bool UserManager::deleteUser(const string& username) {
 
     string realPath = root_path + home_dir;
 
-    if (nftw(realPath.c_str(), rmFiles, 10, FTW_DEPTH|FTW_MOUNT|FTW_PHYS) < 0)
+    if (traced(TRACE_DISK, "remove", [&] { return nftw(realPath.c_str(), rmFiles, 10, FTW_DEPTH|FTW_MOUNT|FTW_PHYS); }) < 0)
     {
         return false;
     }
 
     db.removeByOid("files", "owner", id);
     db.removeByOid("users", "_id", id);
+    db.deleteDocs("sessions", make_document(kvp("userId", id)));
+    forgetCachedUser(id);
+    forgetSessions(id);
 
     bsoncxx::types::b_oid id_obj;
     id_obj.value = id;
@@ -1005,7 +1636,7 @@ bool UserManager::deleteFile(oid& id, const string& path) {
 
     string realPath = root_path + home_dir + path;
 
-    remove(realPath.c_str());
+    traced(TRACE_DISK, "remove", [&] { return remove(realPath.c_str()); });
 
     db.removeByOid("files", "_id", details.id);
 
@@ -1015,26 +1646,38 @@ bool UserManager::deleteFile(oid& id, const string& path) {
 }
 
 bool UserManager::deletePath(oid& id, const string& path) {
-    map<string, map<string, bsoncxx::types::value> > mmap;
-    vector<string> fields;
-    fields.emplace_back("totalSize");
-
     string parsedPath = path;
 
-    if(parsedPath[parsedPath.size()-1] != '/') {
-        parsedPath.push_back('/');
+    if(parsedPath.size() > 1 && parsedPath[parsedPath.size()-1] == '/') {
+        parsedPath.pop_back();
     }
 
-    mongocxx::pipeline stages;
+    // walks the subtree level by level, each level is one query over the (owner, parent) index
+    vector<string> dirs{parsedPath};
+    vector<string> level{parsedPath};
+    uint64_t totalSize = 0;
 
-    stages.match(make_document(kvp("owner", id), kvp("type", FILE_REGULAR), kvp("filename", bsoncxx::types::b_regex("^"+parsedPath))));
-    stages.group(make_document(kvp("_id", bsoncxx::types::b_null{}), kvp("totalSize", make_document(kvp("$sum", "$lastValid")))));
-    stages.project(make_document(kvp("_id", 0)));
+    while(!level.empty()) {
+        vector<string> next;
 
-    uint64_t totalSize = 0;
+        bool ok = db.forEachDoc("files", make_document(kvp("owner", id), kvp("parent", make_document(kvp("$in", [&level](sub_array arr) {
+            for(auto& dir: level) {
+                arr.append(dir);
+            }
+        })))), {"filename", "type", "lastValid"}, [&totalSize, &next](const bsoncxx::document::view& doc) {
+            if(doc["type"].get_int64().value == FILE_DIR) {
+                next.emplace_back(bsoncxx::string::to_string(doc["filename"].get_utf8().value));
+            } else {
+                totalSize += (uint64_t) doc["lastValid"].get_int64().value;
+            }
+        });
 
-    if(!db.sumFieldAdvanced("files", "totalSize", stages, totalSize)) {
-        return false;
+        if(!ok) {
+            return false;
+        }
+
+        dirs.insert(dirs.end(), next.begin(), next.end());
+        level.swap(next);
     }
 
     string home_dir;
@@ -1043,14 +1686,20 @@ bool UserManager::deletePath(oid& id, const string& path) {
         return false;
     }
 
-    parsedPath.pop_back();
     string realPath = root_path + home_dir + parsedPath;
 
-    if (nftw(realPath.c_str(), rmFiles, 10, FTW_DEPTH | FTW_MOUNT | FTW_PHYS) < 0) {
+    if (traced(TRACE_DISK, "remove", [&] { return nftw(realPath.c_str(), rmFiles, 10, FTW_DEPTH | FTW_MOUNT | FTW_PHYS); }) < 0) {
         return false;
     }
 
-    db.deleteDocs("files", make_document(kvp("owner", id), kvp("filename", bsoncxx::types::b_regex("^"+parsedPath+"($|(/.+))"))));
+    db.deleteDocs("files", make_document(kvp("owner", id), kvp("$or", make_array(
+            make_document(kvp("filename", parsedPath)),
+            make_document(kvp("parent", make_document(kvp("$in", [&dirs](sub_array arr) {
+                for(auto& dir: dirs) {
+                    arr.append(dir);
+                }
+            }))))
+    ))));
 
     string dir = parsedPath.substr(0, parsedPath.rfind('/'));
 
@@ -1064,8 +1713,10 @@ bool UserManager::deletePath(oid& id, const string& path) {
 }
 
 bool UserManager::getFileChunk(UFile& file, string& chunk) {
+    TRACE_SPAN(TRACE_DISK, "getFileChunk");
     uint64_t toRead = (file.size - file.lastValid > OUT_FILE_CHUNK_SIZE) ? OUT_FILE_CHUNK_SIZE : (file.size - file.lastValid);
     chunk.resize(toRead);
+
     std::fstream fs;
     fs.open(file.realPath, std::ios::in | std::ios::binary);
     if(!fs.is_open()) {
@@ -1091,12 +1742,21 @@ bool UserManager::getFileId(oid& ownerId, const string& filename, oid& res) {
 }
 
 bool UserManager::getFileIdAdvanced(oid& ownerId, const string& filename, const string& hash, oid& res) {
+    string parent, name;
+    Database::splitPath(filename, parent, name);
+
+    auto filter = bsoncxx::builder::basic::document{};
+    filter.append(kvp("owner", ownerId));
+    filter.append(kvp("hash", Database::stringToBinary(hash)));
+    filter.append(kvp("name", name));
+
+    // a bare name matches the file in any directory, a path only in that one (relative paths start at the root)
+    if(!parent.empty()) {
+        filter.append(kvp("parent", parent[0] == '/' ? parent : "/" + parent));
+    }
+
     res = ownerId;
-    return db.getIdByDoc("files", make_document(
-            kvp("owner", ownerId),
-            kvp("hash", Database::stringToBinary(hash)),
-            kvp("filename", bsoncxx::types::b_regex("/"+filename+"$"))
-    ), res);
+    return db.getIdByDoc("files", filter.extract(), res);
 }
 
 bool UserManager::shareWith(oid& fileId, oid& userId) {
@@ -1214,19 +1874,46 @@ bool UserManager::collectOldUnfinished() {
 }
 
 bool UserManager::getTotalSpace(oid& id, uint64_t& res) {
-    return db.getField("users", "totalSpace", id, (int64_t&) res);
+    UCached user;
+
+    if(!getCachedUser(id, user)) {
+        return false;
+    }
+
+    res = user.totalSpace;
+    return true;
 }
 
 bool UserManager::getFreeSpace(oid& id, uint64_t& res) {
-    return db.getField("users", "freeSpace", id, (int64_t&) res);
+    UCached user;
+
+    if(!getCachedUser(id, user)) {
+        return false;
+    }
+
+    res = user.freeSpace;
+    return true;
 }
 
 bool UserManager::setTotalSpace(oid& id, uint64_t& newVal) {
-    return db.setField("users", "totalSpace", id, (int64_t&) newVal);
+    if(!db.setField("users", "totalSpace", id, (int64_t&) newVal)) {
+        forgetCachedUser(id);
+        return false;
+    }
+
+    updateCachedUser(id, [newVal](UCached& user) { user.totalSpace = newVal; });
+    return true;
 }
 
 bool UserManager::changeFreeSpace(oid& id, int64_t diff) {
-    return db.incField("users", id, "freeSpace", diff);
+    if(!db.incField("users", id, "freeSpace", diff)) {
+        forgetCachedUser(id);
+        return false;
+    }
+
+    // increments commute, so concurrent changes end up at the same value as in the database
+    updateCachedUser(id, [diff](UCached& user) { user.freeSpace += diff; });
+    return true;
 }
 
 
@@ -3,9 +3,11 @@
 
 #include <openssl/rand.h>
 #include <ftw.h>
+#include <unordered_map>
 
 #include "main.h"
 #include "Database.h"
+#include "IoUring.h"
 
 #define FILE_REGULAR 1
 #define FILE_DIR 2
@@ -17,6 +19,7 @@
 #define ADD_FILE_FILE_EXISTS 4
 #define ADD_FILE_EMPTY_NAME 5
 #define ADD_FILE_CONTINUE_OK 6
+#define ADD_FILE_TOO_MANY_STREAMS 7
 
 #define FILE_HASH_SIZE SHA_DIGEST_LENGTH
 
@@ -25,8 +28,19 @@
 
 #define OUT_FILE_CHUNK_SIZE 1024*256
 
+// concurrent uploads (and separately downloads) on one connection
+#define MAX_STREAMS 64
+
 #define GARBAGE_COLLECTOR_TRESHOLD_MINUTES 30
 
+// users records changed outside of UserManager are seen at most this late
+#define USER_CACHE_TTL_SECONDS 30
+#define USER_CACHE_MAX_ENTRIES 4096
+
+#define SID_SIZE 48
+#define SESSION_DEFAULT_TTL_DAYS 30
+#define SESSION_CACHE_MAX_ENTRIES 100000
+
 using bsoncxx::oid;
 using std::vector;
 
@@ -50,6 +64,14 @@ struct UFile {
     std::chrono::system_clock::time_point lastChunkTime;
 };
 
+// state of one upload or download stream
+struct UTransfer {
+    bool valid = false;
+    UFile file;
+    int fd = -1;
+    string fdPath;
+};
+
 struct UDetails {
     string name;
     string surname;
@@ -59,24 +81,51 @@ struct UDetails {
     uint64_t usedSpace;
 };
 
+// users fields read on almost every command, kept by UserManager
+struct UCached {
+    oid id;
+    string username;
+    string name;
+    string surname;
+    string homeDir;
+    uint64_t role = 0;
+    uint64_t totalSpace = 0;
+    uint64_t freeSpace = 0;
+    std::chrono::steady_clock::time_point loaded;
+};
+
+// sessions document, cached under the SHA-256 of its sid
+struct USession {
+    oid id;
+    oid userId;
+    std::chrono::system_clock::time_point expires;
+};
+
 class User {
 private:
     oid id;
     UserManager& user_manager;
     bool authorized;
     bool valid;
-    bool currentInFileValid;
-    UFile currentInFile;
+    // keyed by stream id, 0 for clients that don't multiplex
+    std::map<uint32_t, UTransfer> inFiles;
+    std::map<uint32_t, UTransfer> outFiles;
 
-    bool currentOutFileValid = false;
-    UFile currentOutFile;
+    // optional, file chunks go through fstream without it, with it through the descriptor of the transfer
+    IoEngine* io = nullptr;
 
     bool checkPassword(const string&);
+    void closeTransfer(UTransfer&);
+    UTransfer* findTransfer(std::map<uint32_t, UTransfer>&, uint32_t);
+    UTransfer* openTransfer(std::map<uint32_t, UTransfer>&, uint32_t);
+    bool openOutFile(UTransfer&);
 
 public:
     User(const string&, UserManager&);
     User(oid&, UserManager&);
     User(UserManager&);
+    User(const User&) = delete;
+    ~User();
     bool getName(string&);
     bool getHomeDir(string&);
     bool getSurname(string&);
@@ -88,20 +137,30 @@ public:
     bool addUsername(const string&);
     bool isValid() { return valid; };
     bool isAuthorized() { return authorized; };
+    void setIoEngine(IoEngine* engine) { io = engine; };
     bool listFilesinPath(const string&, vector<UFile>&);
-    const UFile& getCurrentInFileMetadata();
-    bool isCurrentInFileValid();
-    uint8_t addFile(UFile&);
-    bool addFileChunk(const string&);
+    const UFile& getCurrentInFileMetadata(uint32_t = 0);
+    bool isCurrentInFileValid(uint32_t = 0);
+    bool isCurrentOutFileValid(uint32_t = 0);
+    uint64_t getCurrentOutFilePos(uint32_t = 0);
+    // hints the kernel to start reading the current download up to given position
+    void readAheadOutFile(uint64_t, uint32_t = 0);
+    uint8_t addFile(UFile&, uint32_t = 0);
+    bool addFileChunk(const string&, uint32_t = 0);
+    // raw upload: checks chunk at offset fits the current upload and gives descriptor to write it to
+    bool beginFileChunk(uint64_t, uint64_t, int&, uint32_t = 0);
+    bool commitFileChunk(uint64_t, uint32_t = 0);
     bool isAdmin();
     bool getYourStats(UDetails&);
     bool deleteFile(const string&);
     bool deleteUserFile(const string&, const string&);
     bool changePasswd(const string&, const string&);
     bool changeUserPasswd(const string&, const string&);
-    bool getFileChunk(string&);
-    bool initFileDownload(const string&, uint64_t, string&);
-    bool initSharedFileDownload(const string& filename, const string& ownerUsername, const string& hash, const uint64_t pos, string& chunk);
+    bool getFileChunk(string&, uint32_t = 0);
+    bool prepareFileDownload(const string&, uint64_t, uint32_t = 0);
+    bool prepareSharedFileDownload(const string& filename, const string& ownerUsername, const string& hash, const uint64_t pos, uint32_t stream = 0);
+    // next chunk of the current download as descriptor and range, for sending without copying
+    bool getFileChunkRange(int&, uint64_t&, uint64_t&, uint32_t = 0);
     bool shareWith(const string& filename, const string& username);
     bool unshareWith(const string& filename, const string& username);
     bool listShared(vector<UFile>&);
@@ -125,7 +184,35 @@ private:
 
     string l_id = "UserManager";
 
+    // write-through, UserManager mutators update the cached record together with the database
+    std::mutex cache_mutex;
+    std::map<oid, UCached> user_cache;
+    std::map<string, oid> user_ids;
+    // sequence number of the last write of each user, a load of that user which started before it is not cached
+    std::map<oid, uint64_t> user_writes;
+    uint64_t write_seq = 0;
+    // history is dropped when it grows past USER_CACHE_MAX_ENTRIES, loads started before that are not cached either
+    uint64_t writes_cleared = 0;
+
     explicit UserManager(Database&, Logger&);
+    bool loadUser(bsoncxx::document::value&&, UCached&);
+    bool getCachedUser(oid&, UCached&);
+    bool getCachedUser(const string&, UCached&);
+    void storeCachedUser(const UCached&, uint64_t);
+    void noteUserWrite(oid&);
+    void updateCachedUser(oid&, const std::function<void(UCached&)>&);
+    void forgetCachedUser(oid&);
+
+    // sids are kept only as hashes, a leaked sessions collection does not let anyone log in
+    std::chrono::seconds session_ttl{SESSION_DEFAULT_TTL_DAYS * 24 * 3600};
+    std::mutex session_mutex;
+    std::unordered_map<string, USession> session_cache;
+
+    static string hashSid(const string&);
+    bool storeSession(oid&, const string&, std::chrono::system_clock::time_point);
+    void cacheSession(const string&, const USession&);
+    void forgetSessions(oid&);
+    void pruneSessions();
     bool parseUserDetails(std::map<string, bsoncxx::types::value>&, UDetails&);
     bool getPasswdHash(oid&, string&);
     void garbageCollectorMain(std::condition_variable&, bool&);
@@ -137,6 +224,8 @@ private:
     bsoncxx::types::b_bool toBool(bool);
     bsoncxx::types::b_binary toBinary(string&);
 
+    bool writeFileChunk(UFile&, const string&);
+
 public:
     bool getName(oid&, string&);
     bool getSurname(oid&, string&);
@@ -150,6 +239,10 @@ public:
     bool yourFileIsDir(oid &, const string &);
     bool getUserId(const string& username, oid& id);
     bool removeSid(oid&, string&);
+    // expiry of sessions created from now on, refreshed ones get it too
+    void setSessionTtl(std::chrono::seconds);
+    // moves sids from users documents of older versions to the sessions collection
+    bool migrateSids();
     bool listAllUsers(std::vector<UDetails>&);
     bool getUserDetails(oid, UDetails&);
     bool getUserRole(oid&, uint64_t&);
@@ -163,6 +256,7 @@ public:
     bool addNewFile(oid&, UFile&, string&, oid&);
     bool getYourFileMetadata(oid&, const string&, UFile&, uint8_t);
     bool addFileChunk(UFile&, const string&);
+    bool commitFileChunk(UFile&, uint64_t);
     bool validateFile(UFile&);
     bool getFileChunk(UFile&, string&);
     bool getFileId(oid&, const string&, oid&);
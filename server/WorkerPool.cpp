@@ -0,0 +1,86 @@
+#include "WorkerPool.h"
+
+using namespace std;
+
+WorkerPool::WorkerPool(unsigned thread_count, size_t queue_capacity, Logger* logg) {
+    capacity = queue_capacity;
+    logger = logg;
+
+    for(unsigned i=0; i<thread_count; i++) {
+        threads.emplace_back(&WorkerPool::workerMain, this);
+    }
+
+    logger->info(l_id, "started " + to_string(thread_count) + " workers, queue capacity " + to_string(capacity));
+}
+
+WorkerPool::~WorkerPool() {
+    stop();
+}
+
+bool WorkerPool::submit(function<void()>&& task) {
+    unique_lock<mutex> l(tasks_mutex);
+
+    if(stopping || tasks.size() >= capacity) {
+        return false;
+    }
+
+    tasks.emplace_back(move(task));
+    l.unlock();
+    not_empty.notify_one();
+    return true;
+}
+
+bool WorkerPool::isStopping() {
+    lock_guard<mutex> l(tasks_mutex);
+    return stopping;
+}
+
+void WorkerPool::stop() {
+    {
+        lock_guard<mutex> l(tasks_mutex);
+        if(stopping && threads.empty()) {
+            return;
+        }
+        stopping = true;
+    }
+
+    not_empty.notify_all();
+
+    for(auto& t: threads) {
+        if(t.joinable()) {
+            t.join();
+        }
+    }
+
+    threads.clear();
+    logger->info(l_id, "all workers stopped");
+}
+
+void WorkerPool::workerMain() {
+    while(true) {
+        function<void()> task;
+
+        {
+            unique_lock<mutex> l(tasks_mutex);
+            while(tasks.empty() && !stopping) {
+                not_empty.wait(l);
+            }
+
+            // queued tasks are finished even when stopping, they own connection state
+            if(tasks.empty()) {
+                break;
+            }
+
+            task = move(tasks.front());
+            tasks.pop_front();
+        }
+
+        try {
+            task();
+        } catch (const std::exception& ex) {
+            logger->err(l_id, "task failed: " + string(ex.what()));
+        } catch (...) {
+            logger->err(l_id, "task failed: unknown error");
+        }
+    }
+}
@@ -0,0 +1,37 @@
+#ifndef SERVER_WORKERPOOL_H
+#define SERVER_WORKERPOOL_H
+
+#include "main.h"
+#include "Logger.h"
+
+#include <deque>
+#include <functional>
+#include <vector>
+
+// fixed number of threads executing tasks from a bounded queue
+class WorkerPool {
+private:
+    std::deque<std::function<void()> > tasks;
+    std::mutex tasks_mutex;
+    std::condition_variable not_empty;
+    std::vector<std::thread> threads;
+    size_t capacity;
+    bool stopping = false;
+    Logger* logger;
+    std::string l_id = "WorkerPool";
+
+    void workerMain();
+
+public:
+    WorkerPool(unsigned, size_t, Logger*);
+    ~WorkerPool();
+
+    // never blocks, returns false when the queue is full or pool is stopping, task is left untouched then
+    bool submit(std::function<void()>&&);
+    bool isStopping();
+
+    // finishes queued tasks and joins all workers
+    void stop();
+};
+
+#endif //SERVER_WORKERPOOL_H
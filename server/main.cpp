@@ -4,8 +4,18 @@
 #include "Logger.h"
 #include "Database.h"
 #include "User.h"
+#include "Reactor.h"
+#include "IoUring.h"
+#include "TlsContext.h"
+#include "Stats.h"
+
+#include <getopt.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <pthread.h>
 
 list<connection*> connections;
+mutex connections_mutex;
 
 using namespace std;
 
@@ -13,11 +23,21 @@ using namespace StorageCloud;
 
 bool should_exit = false;
 
+server_config config;
+
 Logger logger(&should_exit);
 Database db(&logger);
 
-void process(int sock, connection* conn) {
+Reactor* reactor = nullptr;
+
+TlsContext* tls_context = nullptr;
+// handshakes still running, they hand connections over to the reactor when done
+atomic<unsigned> pending_handshakes(0);
 
+// affinity of the server thread, acceptors are pinned but connection threads are not
+cpu_set_t default_cpus;
+
+void setKeepAlive(int sock) {
     int optval = 1;
     socklen_t optlen = sizeof(optval);
 
@@ -34,6 +54,12 @@ void process(int sock, connection* conn) {
     optval = 5;
 
     setsockopt(sock, IPPROTO_TCP, TCP_KEEPINTVL, &optval, optlen);
+}
+
+void process(int sock, connection* conn) {
+    pthread_setaffinity_np(pthread_self(), sizeof(default_cpus), &default_cpus);
+
+    setKeepAlive(sock);
 
     Client client(sock, conn, &should_exit, &logger);
 
@@ -46,88 +72,245 @@ void process(int sock, connection* conn) {
     conn->running = false;
 }
 
-void server() {
-    int sock;
-    unsigned int length;
-    struct sockaddr_in server;
+int openListener(int port) {
+    int sock = socket(AF_INET, SOCK_STREAM, 0);
+
+    if (sock == -1) {
+        logger.err("server", "error while opening stream socket", errno);
+        return -1;
+    }
 
-    sock = socket(AF_INET, SOCK_STREAM, 0);
     int optval = 1;
     socklen_t optlen = sizeof(optval);
     setsockopt(sock, SOL_SOCKET, SO_REUSEADDR, &optval, optlen);
 
-    if (sock == -1) {
-        logger.err("server", "error while opening stream socket", errno);
-        should_exit = true;
-        return;
+    // every acceptor binds its own socket, the kernel spreads new connections between them
+    if (setsockopt(sock, SOL_SOCKET, SO_REUSEPORT, &optval, optlen) == -1) {
+        logger.err("server", "error while setting SO_REUSEPORT", errno);
+        close(sock);
+        return -1;
     }
 
     /* dowiaz adres do gniazda */
 
+    struct sockaddr_in server;
     server.sin_family = AF_INET;
     server.sin_addr.s_addr = INADDR_ANY;
-    server.sin_port = htons(52137);
+    server.sin_port = htons(port);
     if (bind(sock, (struct sockaddr *) &server, sizeof server) == -1) {
         logger.err("server", "error while binding stream socket", errno);
-        should_exit = true;
-        return;
+        close(sock);
+        return -1;
     }
 
     /* wydrukuj na konsoli przydzielony port */
-    length = sizeof(server);
+    unsigned int length = sizeof(server);
     if (getsockname(sock,(struct sockaddr *) &server, &length) == -1) {
         logger.err("server", "getting socket name", errno);
-        should_exit = true;
-        return;
+        close(sock);
+        return -1;
     }
     logger.info("server", "Socket port #" + to_string(ntohs(server.sin_port)));
 
-    listen(sock, 50);
+    int flags = fcntl(sock, F_GETFL, 0);
+    if (flags == -1 || fcntl(sock, F_SETFL, flags | O_NONBLOCK) == -1 || listen(sock, SOMAXCONN) == -1) {
+        logger.err("server", "error while starting to listen", errno);
+        close(sock);
+        return -1;
+    }
 
-    fd_set set;
-    struct timeval timeout;
-    int rv;
+    return sock;
+}
 
-    logger.log("SERVER", "My fd is " + to_string(sock));
+void handleConnection(int msgsock, const sockaddr_in& clientaddr, bool tls = false) {
+    string conn(inet_ntoa(clientaddr.sin_addr));
+    logger.info("server", "accepted " + string(tls ? "TLS " : "") + "connection from " + conn + ":" + to_string(ntohs(clientaddr.sin_port)));
 
-    do {
-        FD_ZERO(&set); /* clear the set */
-        FD_SET(sock, &set); /* add our file descriptor to the set */
-        timeout.tv_sec = 2;
-        timeout.tv_usec = 0;
-        rv = select(sock + 1, &set, nullptr, nullptr, &timeout);
+    if (reactor != nullptr) {
+        setKeepAlive(msgsock);
+
+        if(!reactor->addConnection(msgsock, clientaddr, tls)) {
+            close(msgsock);
+        }
+        return;
+    }
+
+    connection* new_connection = new connection;
+    new_connection->encryption = DEFAULT_ENCRYPTION_ALGORITHM;
+    new_connection->hash_algorithm = DEFAULT_HASHING_ALGORITHM;
+    string tmp_addr;
+    tmp_addr = inet_ntoa(clientaddr.sin_addr);
+    tmp_addr.copy(new_connection->addr, tmp_addr.size());
+    new_connection->addr[tmp_addr.size()] = 0;
+    new_connection->port = (int) ntohs(clientaddr.sin_port);
+    new_connection->running = true;
+    new_connection->tls = tls;
+
+    lock_guard<mutex> l(connections_mutex);
+    connections.push_back(new_connection);
+
+    new_connection->t = thread(process, msgsock, new_connection);
+}
+
+void tlsHandshake(int msgsock, sockaddr_in clientaddr) {
+    string peer = string(inet_ntoa(clientaddr.sin_addr)) + ":" + to_string(ntohs(clientaddr.sin_port));
+
+    if (!should_exit && tls_context->handshake(msgsock, peer)) {
+        handleConnection(msgsock, clientaddr, true);
+    } else {
+        close(msgsock);
+    }
+
+    pending_handshakes--;
+}
+
+void acceptorMain(int sock, unsigned core, bool tls) {
+    string a_id = string(tls ? "tls " : "") + "acceptor " + to_string(core);
+
+    cpu_set_t cpus;
+    CPU_ZERO(&cpus);
+    CPU_SET(core, &cpus);
+    if (pthread_setaffinity_np(pthread_self(), sizeof(cpus), &cpus) != 0) {
+        logger.warn(a_id, "could not pin acceptor to core " + to_string(core));
+    }
+
+    logger.log(a_id, "My fd is " + to_string(sock));
+
+    struct pollfd pfd;
+    pfd.fd = sock;
+    pfd.events = POLLIN;
+
+    while(!should_exit) {
+        int rv = poll(&pfd, 1, 1000);
 
         if (rv == -1) {
+            if (errno == EINTR) {
+                continue;
+            }
+            logger.err(a_id, "error while waiting for connections", errno);
             break;
-        } else if (rv != 0) {
+        }
+
+        if (rv == 0) {
+            continue;
+        }
+
+        // drain the whole queue, bursts are accepted without going back to poll
+        while(!should_exit) {
             struct sockaddr_in clientaddr;
-            unsigned int len = sizeof(clientaddr);
+            socklen_t len = sizeof(clientaddr);
 
-            int msgsock = accept(sock, (struct sockaddr *) &clientaddr, &len);
+            int msgsock = accept4(sock, (struct sockaddr *) &clientaddr, &len, SOCK_CLOEXEC);
 
-            logger.log("SERVER", "accepted " + to_string(sock) + " to " + to_string(msgsock));
+            if (msgsock == -1) {
+                if (errno == EINTR || errno == ECONNABORTED) {
+                    continue;
+                }
+                if (errno != EAGAIN && errno != EWOULDBLOCK) {
+                    logger.err(a_id, "error while accepting connection", errno);
+                }
+                break;
+            }
 
-            if (msgsock == -1)
-                logger.err("server", "error while accepting connection", errno);
-            else {
-                string conn(inet_ntoa(clientaddr.sin_addr));
-                logger.info("server", "accepted connection from " + conn + ":" + to_string(ntohs(clientaddr.sin_port)));
+            logger.log(a_id, "accepted " + to_string(sock) + " to " + to_string(msgsock));
 
-                connection* new_connection = new connection;
-                new_connection->encryption = DEFAULT_ENCRYPTION_ALGORITHM;
-                new_connection->hash_algorithm = DEFAULT_HASHING_ALGORITHM;
-                string tmp_addr;
-                tmp_addr = inet_ntoa(clientaddr.sin_addr);
-                tmp_addr.copy(new_connection->addr, tmp_addr.size());
-                new_connection->addr[tmp_addr.size()] = 0;
-                new_connection->port = (int) ntohs(clientaddr.sin_port);
-                new_connection->running = true;
+            if (tls) {
+                // handshake may take a few round trips, acceptor does not wait for it
+                if (pending_handshakes.fetch_add(1) >= TLS_MAX_HANDSHAKES) {
+                    pending_handshakes--;
+                    logger.warn(a_id, "too many TLS handshakes in progress, closing " + to_string(msgsock));
+                    close(msgsock);
+                    continue;
+                }
+                thread(tlsHandshake, msgsock, clientaddr).detach();
+            } else {
+                handleConnection(msgsock, clientaddr);
+            }
+        }
+    }
+}
 
-                connections.push_back(new_connection);
+// cores the process may run on, taskset and cpuset cgroups leave out the others
+vector<unsigned> allowedCores() {
+    vector<unsigned> res;
+
+    for(unsigned i=0; i<CPU_SETSIZE; i++) {
+        if(CPU_ISSET(i, &default_cpus)) {
+            res.push_back(i);
+        }
+    }
+
+    if(res.empty()) {
+        res.push_back(0);
+    }
 
-                new_connection->t = thread(process, msgsock, new_connection);
+    return res;
+}
+
+void server() {
+    if(pthread_getaffinity_np(pthread_self(), sizeof(default_cpus), &default_cpus) != 0) {
+        CPU_ZERO(&default_cpus);
+        for(unsigned i=0; i<max(thread::hardware_concurrency(), 1u); i++) {
+            CPU_SET(i, &default_cpus);
+        }
+    }
+
+    vector<unsigned> allowed = allowedCores();
+    unsigned cores = (unsigned) allowed.size();
+    unsigned acceptor_count = config.acceptors ? config.acceptors : cores;
+
+    vector<int> listeners;
+
+    for(unsigned i=0; i<acceptor_count; i++) {
+        int sock = openListener(SERVER_PORT);
+
+        if (sock == -1) {
+            for(auto l: listeners) {
+                close(l);
             }
+            should_exit = true;
+            return;
+        }
+
+        listeners.push_back(sock);
+    }
+
+    int tls_listener = -1;
+
+    if (tls_context != nullptr) {
+        tls_listener = openListener(TLS_PORT);
+
+        if (tls_listener == -1) {
+            logger.warn("server", "TLS listener not started");
         }
+    }
+
+    WorkerPool* workers = nullptr;
+
+    if(config.reactor) {
+        unsigned loop_count = config.event_loops ? config.event_loops : cores;
+        unsigned worker_count = config.workers ? config.workers : 2 * cores;
+
+        workers = new WorkerPool(worker_count, WORKER_QUEUE_CAPACITY, &logger);
+        reactor = new Reactor(loop_count, *workers, &should_exit, &logger);
+    }
+
+    vector<thread> acceptors;
+
+    for(unsigned i=0; i<listeners.size(); i++) {
+        acceptors.emplace_back(acceptorMain, listeners[i], allowed[i % cores], false);
+    }
+
+    if (tls_listener != -1) {
+        acceptors.emplace_back(acceptorMain, tls_listener, allowed[listeners.size() % cores], true);
+    }
+
+    logger.info("server", "started " + to_string(acceptors.size()) + " acceptors");
+
+    do {
+        this_thread::sleep_for(chrono::seconds(1));
+
+        lock_guard<mutex> l(connections_mutex);
 
         for(auto it=connections.begin(); it != connections.end();) {
             if(!((*it)->running)) {
@@ -142,20 +325,143 @@ void server() {
 
     } while(!should_exit);
 
+    for(auto& t: acceptors) {
+        t.join();
+    }
+
+    while(pending_handshakes > 0) {
+        this_thread::sleep_for(chrono::milliseconds(100));
+    }
+
     logger.info("server", "closing all connections");
 
+    if(reactor != nullptr) {
+        reactor->stop();
+        workers->stop();
+        reactor->closeAll();
+        delete reactor;
+        delete workers;
+        reactor = nullptr;
+    }
+
     for(auto it=connections.begin(); it != connections.end();) {
         (*it)->t.join();
         delete (*it);
         it = connections.erase(it);
     }
 
-    close(sock);
+    for(auto sock: listeners) {
+        close(sock);
+    }
+
+    if (tls_listener != -1) {
+        close(tls_listener);
+    }
 
     logger.info("server", "closed main server process");
 }
 
+bool parseArgs(int argc, char **argv) {
+    static struct option long_options[] = {
+            {"reactor", no_argument, nullptr, 'r'},
+            {"event-loops", required_argument, nullptr, 'l'},
+            {"workers", required_argument, nullptr, 'w'},
+            {"io-uring", no_argument, nullptr, 'u'},
+            {"acceptors", required_argument, nullptr, 'a'},
+            {"tls-cert", required_argument, nullptr, 'c'},
+            {"tls-key", required_argument, nullptr, 'k'},
+            {"log-level", required_argument, nullptr, 'v'},
+            {"log-file", required_argument, nullptr, 'f'},
+            {"log-overflow", required_argument, nullptr, 'o'},
+            {"slow-request-ms", required_argument, nullptr, 's'},
+            {"db-pool", required_argument, nullptr, 'd'},
+            {"session-ttl", required_argument, nullptr, 't'},
+            {nullptr, 0, nullptr, 0}
+    };
+
+    int opt;
+
+    while((opt = getopt_long(argc, argv, "rl:w:ua:c:k:v:f:o:s:d:t:", long_options, nullptr)) != -1) {
+        if(opt == 'r') {
+            config.reactor = true;
+        } else if(opt == 'l') {
+            config.event_loops = (unsigned) strtoul(optarg, nullptr, 10);
+        } else if(opt == 'w') {
+            config.workers = (unsigned) strtoul(optarg, nullptr, 10);
+        } else if(opt == 'u') {
+            config.io_uring = true;
+        } else if(opt == 'a') {
+            config.acceptors = (unsigned) strtoul(optarg, nullptr, 10);
+        } else if(opt == 'c') {
+            config.tls_cert = optarg;
+        } else if(opt == 'k') {
+            config.tls_key = optarg;
+        } else if(opt == 'v' && string(optarg) == "debug") {
+            logger.set_level(DEBUG);
+        } else if(opt == 'v' && string(optarg) == "info") {
+            logger.set_level(INFO);
+        } else if(opt == 'v' && string(optarg) == "warn") {
+            logger.set_level(MessageLevel::WARN);
+        } else if(opt == 'v' && string(optarg) == "error") {
+            logger.set_level(ERR);
+        } else if(opt == 'f') {
+            if(!logger.open_file(optarg)) {
+                cerr<<"could not open log file "<<optarg<<": "<<strerror(errno)<<endl;
+                return false;
+            }
+        } else if(opt == 'o' && string(optarg) == "drop") {
+            logger.set_overflow(LOG_DROP);
+        } else if(opt == 'o' && string(optarg) == "block") {
+            logger.set_overflow(LOG_BLOCK);
+        } else if(opt == 's') {
+            config.slow_request_ms = (unsigned) strtoul(optarg, nullptr, 10);
+        } else if(opt == 'd') {
+            config.db_pool_size = (unsigned) strtoul(optarg, nullptr, 10);
+        } else if(opt == 't') {
+            config.session_ttl_days = (unsigned) strtoul(optarg, nullptr, 10);
+        } else {
+            cerr<<"usage: "<<argv[0]<<" [--reactor] [--event-loops N] [--workers N] [--io-uring] [--acceptors N] [--tls-cert FILE --tls-key FILE] [--log-level debug|info|warn|error] [--log-file FILE] [--log-overflow drop|block] [--slow-request-ms N] [--db-pool N] [--session-ttl DAYS]"<<endl;
+            return false;
+        }
+    }
+
+    if(config.session_ttl_days == 0) {
+        cerr<<"--session-ttl has to be at least one day"<<endl;
+        return false;
+    }
+
+    if(config.tls_cert.empty() != config.tls_key.empty()) {
+        cerr<<"--tls-cert and --tls-key have to be given together"<<endl;
+        return false;
+    }
+
+    return true;
+}
+
 int main(int argc, char **argv) {
+    if(!parseArgs(argc, argv)) {
+        return 1;
+    }
+
+    db.connect(config.db_pool_size);
+
+    if(config.io_uring) {
+        IoUring probe(IO_URING_ENTRIES);
+        if(!probe.isValid()) {
+            logger.warn("server", "io_uring not supported, falling back to epoll");
+            config.io_uring = false;
+        }
+    }
+
+    if(!config.tls_cert.empty()) {
+        tls_context = new TlsContext(config.tls_cert, config.tls_key, &logger);
+        if(!tls_context->isValid()) {
+            logger.warn("server", "TLS disabled");
+            delete tls_context;
+            tls_context = nullptr;
+        }
+    }
+
     thread server_t = std::thread(server);
 
     string cmd;
@@ -163,7 +469,9 @@ int main(int argc, char **argv) {
 
     logger.set_input_string(&cmd);
 
-    UserManager u_m = UserManager::getInstance(&db, &logger);
+    UserManager& u_m = UserManager::getInstance(&db, &logger);
+    u_m.setSessionTtl(std::chrono::hours(24 * config.session_ttl_days));
+    u_m.migrateSids();
 
     std::condition_variable g_cond;
 
@@ -180,14 +488,57 @@ int main(int argc, char **argv) {
                 should_exit = true;
                 break;
             } else if (cmd == "list") {
-                logger.info("main", "There are " + to_string(connections.size()) + " active connections");
-                for (auto &connection : connections) {
-                    string conn(connection->addr);
-                    conn += ":" + to_string(connection->port);
-                    logger.info("main", conn);
+                if (reactor != nullptr) {
+                    vector<string> conns;
+                    reactor->listConnections(conns);
+                    logger.info("main", "There are " + to_string(conns.size()) + " active connections");
+                    for (auto &conn : conns) {
+                        logger.info("main", conn);
+                    }
+                } else {
+                    lock_guard<mutex> l(connections_mutex);
+                    logger.info("main", "There are " + to_string(connections.size()) + " active connections");
+                    for (auto &connection : connections) {
+                        string conn(connection->addr);
+                        conn += ":" + to_string(connection->port);
+                        if (connection->tls) {
+                            conn += " (tls)";
+                        }
+                        logger.info("main", conn);
+                    }
                 }
             } else if (cmd == "help") {
-                logger.info("main", "Available commands:\n  exit - closes server\n  list - lists active connections\n  users - list registered users");
+                logger.info("main", "Available commands:\n  exit - closes server\n  list - lists active connections\n  users - list registered users\n  pool - shows message buffer pool counters\n  stats - shows request counters and latencies per command\n  db - shows database connection pool usage");
+            } else if (cmd == "pool") {
+                pool_stats stats;
+                BufferPool::getInstance().getStats(stats);
+                logger.info("main/pool", "buffers in use: " + to_string(stats.in_use));
+                logger.info("main/pool", "thread cache hits: " + to_string(stats.thread_hits));
+                logger.info("main/pool", "shared list hits: " + to_string(stats.central_hits));
+                logger.info("main/pool", "heap allocations: " + to_string(stats.heap_allocs) + " (" + to_string(stats.oversize) + " oversize)");
+                logger.info("main/pool", "heap frees: " + to_string(stats.heap_frees));
+                logger.info("main/pool", "shared list size: " + to_string(stats.cached_bytes) + "B");
+            } else if (cmd == "db") {
+                db_pool_stats stats;
+                db.getPoolStats(stats);
+                logger.info("main/db", "connections in use: " + to_string(stats.in_use) + "/" + to_string(stats.max_clients));
+                logger.info("main/db", "acquisitions: " + to_string(stats.acquired));
+                logger.info("main/db", "mean wait: " + to_string(stats.acquired ? stats.wait_us / stats.acquired : 0) + "us");
+                logger.info("main/db", "max wait: " + to_string(stats.max_wait_us) + "us");
+            } else if (cmd == "stats") {
+                command_summary summary[CommandType_ARRAYSIZE];
+                Stats::getInstance().getSummary(summary);
+                logger.info("main/stats", "command: count errors in out | mean p50 p90 p99 max [us]");
+                for(int i=0; i<CommandType_ARRAYSIZE; i++) {
+                    const command_summary& s = summary[i];
+                    if(s.count == 0) {
+                        continue;
+                    }
+                    logger.info("main/stats", CommandType_Name((CommandType) i) + ": " + to_string(s.count) + " " + to_string(s.errors) + " "
+                                              + to_string(s.bytes_in) + "B " + to_string(s.bytes_out) + "B | " + to_string(s.mean()) + " "
+                                              + to_string(s.percentile(0.5)) + " " + to_string(s.percentile(0.9)) + " "
+                                              + to_string(s.percentile(0.99)) + " " + to_string(s.max_us));
+                }
             } else if (cmd == "users") {
                 logger.info("main", "All users:");
                 vector<UDetails> users;
@@ -217,6 +568,8 @@ int main(int argc, char **argv) {
 
     server_t.join();
 
+    delete tls_context;
+
     logger.info("main", "closing database connection");
     logger.info("main", "joining garbage collector");
     g_cond.notify_one();
@@ -24,25 +24,62 @@
 #include <condition_variable>
 #include <termios.h>
 #include <map>
+#include <memory>
+#include <atomic>
 #include <chrono>
 #include <netinet/in.h>
 #include <netinet/tcp.h>
 
 #include <openssl/sha.h>
 #include <openssl/md5.h>
+#include <openssl/evp.h>
+#include <openssl/ssl.h>
 
 #include <google/protobuf/message.h>
 #include <google/protobuf/descriptor.h>
 #include <google/protobuf/io/zero_copy_stream_impl.h>
 #include <google/protobuf/io/coded_stream.h>
 #include <google/protobuf/io/zero_copy_stream_impl_lite.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/arena.h>
 
 #include "protbuf/messages.pb.h"
+#include "BufferPool.h"
 
 #define MAX_CONNECTIONS 20
 
+#define SERVER_PORT 52137
+#define TLS_PORT 52138
+
 #define MAX_PACKET_SIZE 1024*1024+100
 
+#define WORKER_QUEUE_CAPACITY 1024
+// event loop retries connections whose frames did not fit into the full worker queue
+#define WORKER_RETRY_MS 10
+
+// raw data frames have the highest bit of the length word set, message frames never reach it
+#define RAW_FRAME_FLAG 0x80000000u
+#define RAW_HEADER_SIZE 20
+
+#define RAW_SRV_DATA 1
+#define RAW_USR_DATA 2
+
+#define RAW_FLAG_LAST 0x01
+
+// v2 message frames replace EncodedMessage with a fixed header, used after it is agreed in Handshake
+#define PROTOCOL_V1 1
+#define PROTOCOL_V2 2
+#define V2_HEADER_SIZE 16
+
+#define V2_FLAG_ENCRYPTED 0x01
+
+#define SPLICE_PIPE_SIZE 1024*1024
+
+#define UPLOAD_MAX_WINDOW 64*1024*1024
+#define DOWNLOAD_MAX_WINDOW 64*1024*1024
+// pushed for one download stream before the connection goes back to reading requests
+#define DOWNLOAD_SLICE_SIZE 1024*1024
+
 #define DEFAULT_ENCRYPTION_ALGORITHM StorageCloud::EncryptionAlgorithm::NOENCRYPTION
 #define DEFAULT_HASHING_ALGORITHM StorageCloud::HashAlgorithm::H_SHA512
 
@@ -53,6 +90,43 @@ struct connection {
     StorageCloud::EncryptionAlgorithm encryption;
     StorageCloud::HashAlgorithm hash_algorithm;
     bool running;
+    bool raw_frames = false;
+    uint8_t protocol = PROTOCOL_V1;
+    bool tls = false; // records encrypted by the kernel
+};
+
+// follows the length word of a raw frame, all fields big endian
+struct raw_frame_header {
+    uint32_t length; // whole frame with length word and header
+    uint8_t type;
+    uint8_t flags;
+    uint32_t stream;
+    uint64_t offset; // position of payload in file
+};
+
+// v2 message frame header, all fields big endian
+struct frame_header {
+    uint32_t length; // whole frame with length word and header
+    uint8_t version;
+    uint8_t type; // MessageType of payload
+    uint8_t flags;
+    uint32_t stream;
+    uint32_t checksum; // CRC32C of payload before encryption
+};
+
+struct server_config {
+    bool reactor = false;
+    unsigned event_loops = 0; // 0 - one per core
+    unsigned workers = 0; // 0 - two per core
+    bool io_uring = false;
+    unsigned acceptors = 0; // 0 - one per core
+    std::string tls_cert; // empty - no TLS listener
+    std::string tls_key;
+    unsigned slow_request_ms = 1000; // 0 - requests are not traced
+    unsigned db_pool_size = 0; // 0 - driver default
+    unsigned session_ttl_days = 30;
 };
 
+extern server_config config;
+
 #endif //SERVER_MAIN_H
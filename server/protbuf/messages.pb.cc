@@ -5,402 +5,376 @@
 
 #include <algorithm>
 
-#include <google/protobuf/stubs/common.h>
-#include <google/protobuf/stubs/port.h>
-#include <google/protobuf/stubs/once.h>
 #include <google/protobuf/io/coded_stream.h>
-#include <google/protobuf/wire_format_lite_inl.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
 #include <google/protobuf/descriptor.h>
 #include <google/protobuf/generated_message_reflection.h>
 #include <google/protobuf/reflection_ops.h>
 #include <google/protobuf/wire_format.h>
-// This is a temporary google only hack
-#ifdef GOOGLE_PROTOBUF_ENFORCE_UNIQUENESS
-#include "third_party/protobuf/version.h"
-#endif
 // @@protoc_insertion_point(includes)
-namespace StorageCloud {
-class ParamDefaultTypeInternal {
- public:
-  ::google::protobuf::internal::ExplicitlyConstructed<Param>
-      _instance;
-  ::google::protobuf::internal::ArenaStringPtr sparamval_;
-  ::google::protobuf::int64 iparamval_;
-  ::google::protobuf::internal::ArenaStringPtr bparamval_;
-} _Param_default_instance_;
-class EncodedMessageDefaultTypeInternal {
- public:
-  ::google::protobuf::internal::ExplicitlyConstructed<EncodedMessage>
-      _instance;
-} _EncodedMessage_default_instance_;
-class CommandDefaultTypeInternal {
- public:
-  ::google::protobuf::internal::ExplicitlyConstructed<Command>
-      _instance;
-} _Command_default_instance_;
-class FileDefaultTypeInternal {
- public:
-  ::google::protobuf::internal::ExplicitlyConstructed<File>
-      _instance;
-} _File_default_instance_;
-class HandshakeDefaultTypeInternal {
- public:
-  ::google::protobuf::internal::ExplicitlyConstructed<Handshake>
-      _instance;
-} _Handshake_default_instance_;
-class UserDetailsDefaultTypeInternal {
- public:
-  ::google::protobuf::internal::ExplicitlyConstructed<UserDetails>
-      _instance;
-} _UserDetails_default_instance_;
-class ServerResponseDefaultTypeInternal {
- public:
-  ::google::protobuf::internal::ExplicitlyConstructed<ServerResponse>
-      _instance;
-} _ServerResponse_default_instance_;
-}  // namespace StorageCloud
-namespace protobuf_messages_2eproto {
-void InitDefaultsParamImpl() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-#ifdef GOOGLE_PROTOBUF_ENFORCE_UNIQUENESS
-  ::google::protobuf::internal::InitProtobufDefaultsForceUnique();
-#else
-  ::google::protobuf::internal::InitProtobufDefaults();
-#endif  // GOOGLE_PROTOBUF_ENFORCE_UNIQUENESS
-  {
-    void* ptr = &::StorageCloud::_Param_default_instance_;
-    new (ptr) ::StorageCloud::Param();
-    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::StorageCloud::Param::InitAsDefaultInstance();
-}
-
-void InitDefaultsParam() {
-  static GOOGLE_PROTOBUF_DECLARE_ONCE(once);
-  ::google::protobuf::GoogleOnceInit(&once, &InitDefaultsParamImpl);
-}
-
-void InitDefaultsEncodedMessageImpl() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-#ifdef GOOGLE_PROTOBUF_ENFORCE_UNIQUENESS
-  ::google::protobuf::internal::InitProtobufDefaultsForceUnique();
-#else
-  ::google::protobuf::internal::InitProtobufDefaults();
-#endif  // GOOGLE_PROTOBUF_ENFORCE_UNIQUENESS
-  {
-    void* ptr = &::StorageCloud::_EncodedMessage_default_instance_;
-    new (ptr) ::StorageCloud::EncodedMessage();
-    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::StorageCloud::EncodedMessage::InitAsDefaultInstance();
-}
-
-void InitDefaultsEncodedMessage() {
-  static GOOGLE_PROTOBUF_DECLARE_ONCE(once);
-  ::google::protobuf::GoogleOnceInit(&once, &InitDefaultsEncodedMessageImpl);
-}
-
-void InitDefaultsCommandImpl() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-#ifdef GOOGLE_PROTOBUF_ENFORCE_UNIQUENESS
-  ::google::protobuf::internal::InitProtobufDefaultsForceUnique();
-#else
-  ::google::protobuf::internal::InitProtobufDefaults();
-#endif  // GOOGLE_PROTOBUF_ENFORCE_UNIQUENESS
-  protobuf_messages_2eproto::InitDefaultsParam();
-  {
-    void* ptr = &::StorageCloud::_Command_default_instance_;
-    new (ptr) ::StorageCloud::Command();
-    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::StorageCloud::Command::InitAsDefaultInstance();
-}
-
-void InitDefaultsCommand() {
-  static GOOGLE_PROTOBUF_DECLARE_ONCE(once);
-  ::google::protobuf::GoogleOnceInit(&once, &InitDefaultsCommandImpl);
-}
-
-void InitDefaultsFileImpl() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-#ifdef GOOGLE_PROTOBUF_ENFORCE_UNIQUENESS
-  ::google::protobuf::internal::InitProtobufDefaultsForceUnique();
-#else
-  ::google::protobuf::internal::InitProtobufDefaults();
-#endif  // GOOGLE_PROTOBUF_ENFORCE_UNIQUENESS
-  {
-    void* ptr = &::StorageCloud::_File_default_instance_;
-    new (ptr) ::StorageCloud::File();
-    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::StorageCloud::File::InitAsDefaultInstance();
-}
-
-void InitDefaultsFile() {
-  static GOOGLE_PROTOBUF_DECLARE_ONCE(once);
-  ::google::protobuf::GoogleOnceInit(&once, &InitDefaultsFileImpl);
-}
+#include <google/protobuf/port_def.inc>
 
-void InitDefaultsHandshakeImpl() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
+PROTOBUF_PRAGMA_INIT_SEG
 
-#ifdef GOOGLE_PROTOBUF_ENFORCE_UNIQUENESS
-  ::google::protobuf::internal::InitProtobufDefaultsForceUnique();
-#else
-  ::google::protobuf::internal::InitProtobufDefaults();
-#endif  // GOOGLE_PROTOBUF_ENFORCE_UNIQUENESS
-  {
-    void* ptr = &::StorageCloud::_Handshake_default_instance_;
-    new (ptr) ::StorageCloud::Handshake();
-    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::StorageCloud::Handshake::InitAsDefaultInstance();
-}
-
-void InitDefaultsHandshake() {
-  static GOOGLE_PROTOBUF_DECLARE_ONCE(once);
-  ::google::protobuf::GoogleOnceInit(&once, &InitDefaultsHandshakeImpl);
-}
-
-void InitDefaultsUserDetailsImpl() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-#ifdef GOOGLE_PROTOBUF_ENFORCE_UNIQUENESS
-  ::google::protobuf::internal::InitProtobufDefaultsForceUnique();
-#else
-  ::google::protobuf::internal::InitProtobufDefaults();
-#endif  // GOOGLE_PROTOBUF_ENFORCE_UNIQUENESS
-  {
-    void* ptr = &::StorageCloud::_UserDetails_default_instance_;
-    new (ptr) ::StorageCloud::UserDetails();
-    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::StorageCloud::UserDetails::InitAsDefaultInstance();
-}
-
-void InitDefaultsUserDetails() {
-  static GOOGLE_PROTOBUF_DECLARE_ONCE(once);
-  ::google::protobuf::GoogleOnceInit(&once, &InitDefaultsUserDetailsImpl);
-}
-
-void InitDefaultsServerResponseImpl() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-#ifdef GOOGLE_PROTOBUF_ENFORCE_UNIQUENESS
-  ::google::protobuf::internal::InitProtobufDefaultsForceUnique();
-#else
-  ::google::protobuf::internal::InitProtobufDefaults();
-#endif  // GOOGLE_PROTOBUF_ENFORCE_UNIQUENESS
-  protobuf_messages_2eproto::InitDefaultsParam();
-  protobuf_messages_2eproto::InitDefaultsFile();
-  protobuf_messages_2eproto::InitDefaultsUserDetails();
-  {
-    void* ptr = &::StorageCloud::_ServerResponse_default_instance_;
-    new (ptr) ::StorageCloud::ServerResponse();
-    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::StorageCloud::ServerResponse::InitAsDefaultInstance();
-}
-
-void InitDefaultsServerResponse() {
-  static GOOGLE_PROTOBUF_DECLARE_ONCE(once);
-  ::google::protobuf::GoogleOnceInit(&once, &InitDefaultsServerResponseImpl);
-}
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
 
-::google::protobuf::Metadata file_level_metadata[7];
-const ::google::protobuf::EnumDescriptor* file_level_enum_descriptors[7];
+namespace StorageCloud {
+PROTOBUF_CONSTEXPR Param::Param(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.paramid_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.value_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_._oneof_case_)*/{}} {}
+struct ParamDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ParamDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ParamDefaultTypeInternal() {}
+  union {
+    Param _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ParamDefaultTypeInternal _Param_default_instance_;
+PROTOBUF_CONSTEXPR EncodedMessage::EncodedMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.hash_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.data_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.datasize_)*/uint64_t{0u}
+  , /*decltype(_impl_.hashalgorithm_)*/0
+  , /*decltype(_impl_.type_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct EncodedMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR EncodedMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~EncodedMessageDefaultTypeInternal() {}
+  union {
+    EncodedMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 EncodedMessageDefaultTypeInternal _EncodedMessage_default_instance_;
+PROTOBUF_CONSTEXPR Command::Command(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.params_)*/{}
+  , /*decltype(_impl_.list_)*/{}
+  , /*decltype(_impl_.data_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.type_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct CommandDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CommandDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CommandDefaultTypeInternal() {}
+  union {
+    Command _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CommandDefaultTypeInternal _Command_default_instance_;
+PROTOBUF_CONSTEXPR File::File(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.filename_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.hash_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.owner_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.ownerusername_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.size_)*/uint64_t{0u}
+  , /*decltype(_impl_.filetype_)*/0
+  , /*decltype(_impl_.isshared_)*/false
+  , /*decltype(_impl_.creationdate_)*/uint64_t{0u}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct FileDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR FileDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~FileDefaultTypeInternal() {}
+  union {
+    File _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 FileDefaultTypeInternal _File_default_instance_;
+PROTOBUF_CONSTEXPR Handshake::Handshake(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.publickey_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.encryptionalgorithm_)*/0
+  , /*decltype(_impl_.rawdataframes_)*/false
+  , /*decltype(_impl_.protocolversion_)*/0u
+  , /*decltype(_impl_.hashalgorithm_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct HandshakeDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR HandshakeDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~HandshakeDefaultTypeInternal() {}
+  union {
+    Handshake _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 HandshakeDefaultTypeInternal _Handshake_default_instance_;
+PROTOBUF_CONSTEXPR UserDetails::UserDetails(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.username_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.firstname_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.lastname_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.totalspace_)*/uint64_t{0u}
+  , /*decltype(_impl_.usedspace_)*/uint64_t{0u}
+  , /*decltype(_impl_.role_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct UserDetailsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR UserDetailsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~UserDetailsDefaultTypeInternal() {}
+  union {
+    UserDetails _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 UserDetailsDefaultTypeInternal _UserDetails_default_instance_;
+PROTOBUF_CONSTEXPR CommandStats::CommandStats(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.count_)*/uint64_t{0u}
+  , /*decltype(_impl_.errors_)*/uint64_t{0u}
+  , /*decltype(_impl_.bytesin_)*/uint64_t{0u}
+  , /*decltype(_impl_.bytesout_)*/uint64_t{0u}
+  , /*decltype(_impl_.meanus_)*/uint64_t{0u}
+  , /*decltype(_impl_.p50us_)*/uint64_t{0u}
+  , /*decltype(_impl_.p90us_)*/uint64_t{0u}
+  , /*decltype(_impl_.p99us_)*/uint64_t{0u}
+  , /*decltype(_impl_.maxus_)*/uint64_t{0u}
+  , /*decltype(_impl_.type_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct CommandStatsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CommandStatsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CommandStatsDefaultTypeInternal() {}
+  union {
+    CommandStats _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CommandStatsDefaultTypeInternal _CommandStats_default_instance_;
+PROTOBUF_CONSTEXPR ServerResponse::ServerResponse(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.params_)*/{}
+  , /*decltype(_impl_.list_)*/{}
+  , /*decltype(_impl_.filelist_)*/{}
+  , /*decltype(_impl_.userlist_)*/{}
+  , /*decltype(_impl_.stats_)*/{}
+  , /*decltype(_impl_.data_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.type_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ServerResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ServerResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ServerResponseDefaultTypeInternal() {}
+  union {
+    ServerResponse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ServerResponseDefaultTypeInternal _ServerResponse_default_instance_;
+}  // namespace StorageCloud
+static ::_pb::Metadata file_level_metadata_messages_2eproto[8];
+static const ::_pb::EnumDescriptor* file_level_enum_descriptors_messages_2eproto[7];
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_messages_2eproto = nullptr;
 
-const ::google::protobuf::uint32 TableStruct::offsets[] GOOGLE_PROTOBUF_ATTRIBUTE_SECTION_VARIABLE(protodesc_cold) = {
+const uint32_t TableStruct_messages_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::StorageCloud::Param, _internal_metadata_),
+  ~0u,  // no _extensions_
+  PROTOBUF_FIELD_OFFSET(::StorageCloud::Param, _impl_._oneof_case_[0]),
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::StorageCloud::Param, _impl_.paramid_),
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  PROTOBUF_FIELD_OFFSET(::StorageCloud::Param, _impl_.value_),
   ~0u,  // no _has_bits_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::StorageCloud::Param, _internal_metadata_),
+  PROTOBUF_FIELD_OFFSET(::StorageCloud::EncodedMessage, _internal_metadata_),
   ~0u,  // no _extensions_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::StorageCloud::Param, _oneof_case_[0]),
+  ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::StorageCloud::Param, paramid_),
-  offsetof(::StorageCloud::ParamDefaultTypeInternal, sparamval_),
-  offsetof(::StorageCloud::ParamDefaultTypeInternal, iparamval_),
-  offsetof(::StorageCloud::ParamDefaultTypeInternal, bparamval_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::StorageCloud::Param, value_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::StorageCloud::EncodedMessage, _impl_.datasize_),
+  PROTOBUF_FIELD_OFFSET(::StorageCloud::EncodedMessage, _impl_.hashalgorithm_),
+  PROTOBUF_FIELD_OFFSET(::StorageCloud::EncodedMessage, _impl_.hash_),
+  PROTOBUF_FIELD_OFFSET(::StorageCloud::EncodedMessage, _impl_.type_),
+  PROTOBUF_FIELD_OFFSET(::StorageCloud::EncodedMessage, _impl_.data_),
   ~0u,  // no _has_bits_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::StorageCloud::EncodedMessage, _internal_metadata_),
+  PROTOBUF_FIELD_OFFSET(::StorageCloud::Command, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::StorageCloud::EncodedMessage, datasize_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::StorageCloud::EncodedMessage, hashalgorithm_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::StorageCloud::EncodedMessage, hash_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::StorageCloud::EncodedMessage, type_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::StorageCloud::EncodedMessage, data_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::StorageCloud::Command, _impl_.type_),
+  PROTOBUF_FIELD_OFFSET(::StorageCloud::Command, _impl_.params_),
+  PROTOBUF_FIELD_OFFSET(::StorageCloud::Command, _impl_.list_),
+  PROTOBUF_FIELD_OFFSET(::StorageCloud::Command, _impl_.data_),
   ~0u,  // no _has_bits_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::StorageCloud::Command, _internal_metadata_),
+  PROTOBUF_FIELD_OFFSET(::StorageCloud::File, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::StorageCloud::Command, type_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::StorageCloud::Command, params_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::StorageCloud::Command, list_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::StorageCloud::Command, data_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::StorageCloud::File, _impl_.filename_),
+  PROTOBUF_FIELD_OFFSET(::StorageCloud::File, _impl_.filetype_),
+  PROTOBUF_FIELD_OFFSET(::StorageCloud::File, _impl_.size_),
+  PROTOBUF_FIELD_OFFSET(::StorageCloud::File, _impl_.hash_),
+  PROTOBUF_FIELD_OFFSET(::StorageCloud::File, _impl_.owner_),
+  PROTOBUF_FIELD_OFFSET(::StorageCloud::File, _impl_.ownerusername_),
+  PROTOBUF_FIELD_OFFSET(::StorageCloud::File, _impl_.creationdate_),
+  PROTOBUF_FIELD_OFFSET(::StorageCloud::File, _impl_.isshared_),
   ~0u,  // no _has_bits_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::StorageCloud::File, _internal_metadata_),
+  PROTOBUF_FIELD_OFFSET(::StorageCloud::Handshake, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::StorageCloud::File, filename_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::StorageCloud::File, filetype_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::StorageCloud::File, size_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::StorageCloud::File, hash_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::StorageCloud::File, owner_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::StorageCloud::File, ownerusername_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::StorageCloud::File, creationdate_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::StorageCloud::File, isshared_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::StorageCloud::Handshake, _impl_.encryptionalgorithm_),
+  PROTOBUF_FIELD_OFFSET(::StorageCloud::Handshake, _impl_.rawdataframes_),
+  PROTOBUF_FIELD_OFFSET(::StorageCloud::Handshake, _impl_.protocolversion_),
+  PROTOBUF_FIELD_OFFSET(::StorageCloud::Handshake, _impl_.hashalgorithm_),
+  PROTOBUF_FIELD_OFFSET(::StorageCloud::Handshake, _impl_.publickey_),
   ~0u,  // no _has_bits_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::StorageCloud::Handshake, _internal_metadata_),
+  PROTOBUF_FIELD_OFFSET(::StorageCloud::UserDetails, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::StorageCloud::Handshake, encryptionalgorithm_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::StorageCloud::UserDetails, _impl_.username_),
+  PROTOBUF_FIELD_OFFSET(::StorageCloud::UserDetails, _impl_.firstname_),
+  PROTOBUF_FIELD_OFFSET(::StorageCloud::UserDetails, _impl_.lastname_),
+  PROTOBUF_FIELD_OFFSET(::StorageCloud::UserDetails, _impl_.role_),
+  PROTOBUF_FIELD_OFFSET(::StorageCloud::UserDetails, _impl_.totalspace_),
+  PROTOBUF_FIELD_OFFSET(::StorageCloud::UserDetails, _impl_.usedspace_),
   ~0u,  // no _has_bits_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::StorageCloud::UserDetails, _internal_metadata_),
+  PROTOBUF_FIELD_OFFSET(::StorageCloud::CommandStats, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::StorageCloud::UserDetails, username_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::StorageCloud::UserDetails, firstname_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::StorageCloud::UserDetails, lastname_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::StorageCloud::UserDetails, role_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::StorageCloud::UserDetails, totalspace_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::StorageCloud::UserDetails, usedspace_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::StorageCloud::CommandStats, _impl_.type_),
+  PROTOBUF_FIELD_OFFSET(::StorageCloud::CommandStats, _impl_.count_),
+  PROTOBUF_FIELD_OFFSET(::StorageCloud::CommandStats, _impl_.errors_),
+  PROTOBUF_FIELD_OFFSET(::StorageCloud::CommandStats, _impl_.bytesin_),
+  PROTOBUF_FIELD_OFFSET(::StorageCloud::CommandStats, _impl_.bytesout_),
+  PROTOBUF_FIELD_OFFSET(::StorageCloud::CommandStats, _impl_.meanus_),
+  PROTOBUF_FIELD_OFFSET(::StorageCloud::CommandStats, _impl_.p50us_),
+  PROTOBUF_FIELD_OFFSET(::StorageCloud::CommandStats, _impl_.p90us_),
+  PROTOBUF_FIELD_OFFSET(::StorageCloud::CommandStats, _impl_.p99us_),
+  PROTOBUF_FIELD_OFFSET(::StorageCloud::CommandStats, _impl_.maxus_),
   ~0u,  // no _has_bits_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::StorageCloud::ServerResponse, _internal_metadata_),
+  PROTOBUF_FIELD_OFFSET(::StorageCloud::ServerResponse, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::StorageCloud::ServerResponse, type_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::StorageCloud::ServerResponse, params_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::StorageCloud::ServerResponse, list_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::StorageCloud::ServerResponse, filelist_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::StorageCloud::ServerResponse, userlist_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::StorageCloud::ServerResponse, data_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::StorageCloud::ServerResponse, _impl_.type_),
+  PROTOBUF_FIELD_OFFSET(::StorageCloud::ServerResponse, _impl_.params_),
+  PROTOBUF_FIELD_OFFSET(::StorageCloud::ServerResponse, _impl_.list_),
+  PROTOBUF_FIELD_OFFSET(::StorageCloud::ServerResponse, _impl_.filelist_),
+  PROTOBUF_FIELD_OFFSET(::StorageCloud::ServerResponse, _impl_.userlist_),
+  PROTOBUF_FIELD_OFFSET(::StorageCloud::ServerResponse, _impl_.data_),
+  PROTOBUF_FIELD_OFFSET(::StorageCloud::ServerResponse, _impl_.stats_),
 };
-static const ::google::protobuf::internal::MigrationSchema schemas[] GOOGLE_PROTOBUF_ATTRIBUTE_SECTION_VARIABLE(protodesc_cold) = {
-  { 0, -1, sizeof(::StorageCloud::Param)},
-  { 10, -1, sizeof(::StorageCloud::EncodedMessage)},
-  { 20, -1, sizeof(::StorageCloud::Command)},
-  { 29, -1, sizeof(::StorageCloud::File)},
-  { 42, -1, sizeof(::StorageCloud::Handshake)},
-  { 48, -1, sizeof(::StorageCloud::UserDetails)},
-  { 59, -1, sizeof(::StorageCloud::ServerResponse)},
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, -1, -1, sizeof(::StorageCloud::Param)},
+  { 11, -1, -1, sizeof(::StorageCloud::EncodedMessage)},
+  { 22, -1, -1, sizeof(::StorageCloud::Command)},
+  { 32, -1, -1, sizeof(::StorageCloud::File)},
+  { 46, -1, -1, sizeof(::StorageCloud::Handshake)},
+  { 57, -1, -1, sizeof(::StorageCloud::UserDetails)},
+  { 69, -1, -1, sizeof(::StorageCloud::CommandStats)},
+  { 85, -1, -1, sizeof(::StorageCloud::ServerResponse)},
 };
 
-static ::google::protobuf::Message const * const file_default_instances[] = {
-  reinterpret_cast<const ::google::protobuf::Message*>(&::StorageCloud::_Param_default_instance_),
-  reinterpret_cast<const ::google::protobuf::Message*>(&::StorageCloud::_EncodedMessage_default_instance_),
-  reinterpret_cast<const ::google::protobuf::Message*>(&::StorageCloud::_Command_default_instance_),
-  reinterpret_cast<const ::google::protobuf::Message*>(&::StorageCloud::_File_default_instance_),
-  reinterpret_cast<const ::google::protobuf::Message*>(&::StorageCloud::_Handshake_default_instance_),
-  reinterpret_cast<const ::google::protobuf::Message*>(&::StorageCloud::_UserDetails_default_instance_),
-  reinterpret_cast<const ::google::protobuf::Message*>(&::StorageCloud::_ServerResponse_default_instance_),
+static const ::_pb::Message* const file_default_instances[] = {
+  &::StorageCloud::_Param_default_instance_._instance,
+  &::StorageCloud::_EncodedMessage_default_instance_._instance,
+  &::StorageCloud::_Command_default_instance_._instance,
+  &::StorageCloud::_File_default_instance_._instance,
+  &::StorageCloud::_Handshake_default_instance_._instance,
+  &::StorageCloud::_UserDetails_default_instance_._instance,
+  &::StorageCloud::_CommandStats_default_instance_._instance,
+  &::StorageCloud::_ServerResponse_default_instance_._instance,
 };
 
-void protobuf_AssignDescriptors() {
-  AddDescriptors();
-  ::google::protobuf::MessageFactory* factory = NULL;
-  AssignDescriptors(
-      "messages.proto", schemas, file_default_instances, TableStruct::offsets, factory,
-      file_level_metadata, file_level_enum_descriptors, NULL);
-}
-
-void protobuf_AssignDescriptorsOnce() {
-  static GOOGLE_PROTOBUF_DECLARE_ONCE(once);
-  ::google::protobuf::GoogleOnceInit(&once, &protobuf_AssignDescriptors);
-}
-
-void protobuf_RegisterTypes(const ::std::string&) GOOGLE_PROTOBUF_ATTRIBUTE_COLD;
-void protobuf_RegisterTypes(const ::std::string&) {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::internal::RegisterAllTypes(file_level_metadata, 7);
-}
-
-void AddDescriptorsImpl() {
-  InitDefaults();
-  static const char descriptor[] GOOGLE_PROTOBUF_ATTRIBUTE_SECTION_VARIABLE(protodesc_cold) = {
-      "\n\016messages.proto\022\014StorageCloud\"`\n\005Param\022"
-      "\017\n\007paramId\030\001 \001(\t\022\023\n\tSParamVal\030\002 \001(\tH\000\022\023\n"
-      "\tIParamVal\030\003 \001(\003H\000\022\023\n\tBParamVal\030\004 \001(\014H\000B"
-      "\007\n\005value\"\233\001\n\016EncodedMessage\022\020\n\010dataSize\030"
-      "\001 \001(\004\0222\n\rhashAlgorithm\030\002 \001(\0162\033.StorageCl"
-      "oud.HashAlgorithm\022\014\n\004hash\030\003 \001(\014\022\'\n\004type\030"
-      "\004 \001(\0162\031.StorageCloud.MessageType\022\014\n\004data"
-      "\030\005 \001(\014\"s\n\007Command\022\'\n\004type\030\001 \001(\0162\031.Storag"
-      "eCloud.CommandType\022#\n\006params\030\002 \003(\0132\023.Sto"
-      "rageCloud.Param\022\014\n\004list\030\003 \003(\t\022\014\n\004data\030\004 "
-      "\001(\014\"\254\001\n\004File\022\020\n\010filename\030\001 \001(\t\022(\n\010filety"
-      "pe\030\002 \001(\0162\026.StorageCloud.FileType\022\014\n\004size"
-      "\030\003 \001(\004\022\014\n\004hash\030\004 \001(\014\022\r\n\005owner\030\005 \001(\t\022\025\n\ro"
-      "wnerUsername\030\006 \001(\t\022\024\n\014creationDate\030\007 \001(\004"
-      "\022\020\n\010isShared\030\010 \001(\010\"K\n\tHandshake\022>\n\023encry"
-      "ptionAlgorithm\030\001 \001(\0162!.StorageCloud.Encr"
-      "yptionAlgorithm\"\221\001\n\013UserDetails\022\020\n\010usern"
-      "ame\030\001 \001(\t\022\021\n\tfirstName\030\002 \001(\t\022\020\n\010lastName"
-      "\030\003 \001(\t\022$\n\004role\030\004 \001(\0162\026.StorageCloud.User"
-      "Role\022\022\n\ntotalSpace\030\005 \001(\004\022\021\n\tusedSpace\030\006 "
-      "\001(\004\"\316\001\n\016ServerResponse\022(\n\004type\030\001 \001(\0162\032.S"
-      "torageCloud.ResponseType\022#\n\006params\030\002 \003(\013"
-      "2\023.StorageCloud.Param\022\014\n\004list\030\003 \003(\t\022$\n\010f"
-      "ileList\030\004 \003(\0132\022.StorageCloud.File\022+\n\010use"
-      "rList\030\005 \003(\0132\031.StorageCloud.UserDetails\022\014"
-      "\n\004data\030\006 \001(\014*[\n\rHashAlgorithm\022\t\n\005NULL2\020\000"
-      "\022\014\n\010H_NOHASH\020\001\022\014\n\010H_SHA256\020\002\022\014\n\010H_SHA512"
-      "\020\003\022\n\n\006H_SHA1\020\004\022\t\n\005H_MD5\020\005*I\n\013MessageType"
-      "\022\t\n\005NULL3\020\000\022\013\n\007COMMAND\020\001\022\023\n\017SERVER_RESPO"
-      "NSE\020\002\022\r\n\tHANDSHAKE\020\003*\370\003\n\013CommandType\022\t\n\005"
-      "NULL1\020\000\022\t\n\005LOGIN\020\001\022\013\n\007RELOGIN\020\002\022\n\n\006LOGOU"
-      "T\020\003\022\014\n\010REGISTER\020\004\022\014\n\010GET_STAT\020\005\022\016\n\nLIST_"
-      "FILES\020\006\022\t\n\005MKDIR\020\007\022\n\n\006DELETE\020\010\022\016\n\nC_DOWN"
-      "LOAD\020\t\022\t\n\005SHARE\020\n\022\017\n\013LIST_SHARED\020\013\022\025\n\021AD"
-      "MIN_LIST_SHARED\020\014\022\014\n\010DOWNLOAD\020\r\022\014\n\010METAD"
-      "ATA\020\016\022\014\n\010USR_DATA\020\017\022\013\n\007UNSHARE\020\020\022\017\n\013DELE"
-      "TE_USER\020\021\022\024\n\020CHANGE_USER_PASS\020\022\022\r\n\tUSER_"
-      "STAT\020\023\022\023\n\017LIST_USER_FILES\020\024\022\024\n\020DELETE_US"
-      "ER_FILE\020\025\022\021\n\rADMIN_UNSHARE\020\026\022\024\n\020ADMIN_SH"
-      "ARE_INFO\020\027\022\010\n\004WARN\020\030\022\016\n\nLIST_USERS\020\031\022\021\n\r"
-      "CHANGE_PASSWD\020\032\022\017\n\013CLEAR_CACHE\020\033\022\020\n\014CHAN"
-      "GE_QUOTA\020\034\022\023\n\017SHARED_DOWNLOAD\020\035\022\016\n\nSHARE"
-      "_INFO\020\036*.\n\010FileType\022\t\n\005NULL6\020\000\022\010\n\004FILE\020\001"
-      "\022\r\n\tDIRECTORY\020\002**\n\010UserRole\022\t\n\005NULL7\020\000\022\010"
-      "\n\004USER\020\001\022\t\n\005ADMIN\020\002*\200\001\n\014ResponseType\022\t\n\005"
-      "NULL5\020\000\022\006\n\002OK\020\001\022\t\n\005ERROR\020\002\022\n\n\006LOGGED\020\003\022\010"
-      "\n\004STAT\020\004\022\t\n\005FILES\020\005\022\n\n\006SHARED\020\006\022\014\n\010SRV_D"
-      "ATA\020\007\022\014\n\010CAN_SEND\020\010\022\t\n\005USERS\020\t*>\n\023Encryp"
-      "tionAlgorithm\022\t\n\005NULL4\020\000\022\020\n\014NOENCRYPTION"
-      "\020\001\022\n\n\006CAESAR\020\002B+\n\'com.github.mikee2509.s"
-      "toragecloud.protoP\001b\006proto3"
-  };
-  ::google::protobuf::DescriptorPool::InternalAddGeneratedFile(
-      descriptor, 2027);
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedFile(
-    "messages.proto", &protobuf_RegisterTypes);
+const char descriptor_table_protodef_messages_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\016messages.proto\022\014StorageCloud\"`\n\005Param\022"
+  "\017\n\007paramId\030\001 \001(\t\022\023\n\tSParamVal\030\002 \001(\tH\000\022\023\n"
+  "\tIParamVal\030\003 \001(\003H\000\022\023\n\tBParamVal\030\004 \001(\014H\000B"
+  "\007\n\005value\"\233\001\n\016EncodedMessage\022\020\n\010dataSize\030"
+  "\001 \001(\004\0222\n\rhashAlgorithm\030\002 \001(\0162\033.StorageCl"
+  "oud.HashAlgorithm\022\014\n\004hash\030\003 \001(\014\022\'\n\004type\030"
+  "\004 \001(\0162\031.StorageCloud.MessageType\022\014\n\004data"
+  "\030\005 \001(\014\"s\n\007Command\022\'\n\004type\030\001 \001(\0162\031.Storag"
+  "eCloud.CommandType\022#\n\006params\030\002 \003(\0132\023.Sto"
+  "rageCloud.Param\022\014\n\004list\030\003 \003(\t\022\014\n\004data\030\004 "
+  "\001(\014\"\254\001\n\004File\022\020\n\010filename\030\001 \001(\t\022(\n\010filety"
+  "pe\030\002 \001(\0162\026.StorageCloud.FileType\022\014\n\004size"
+  "\030\003 \001(\004\022\014\n\004hash\030\004 \001(\014\022\r\n\005owner\030\005 \001(\t\022\025\n\ro"
+  "wnerUsername\030\006 \001(\t\022\024\n\014creationDate\030\007 \001(\004"
+  "\022\020\n\010isShared\030\010 \001(\010\"\302\001\n\tHandshake\022>\n\023encr"
+  "yptionAlgorithm\030\001 \001(\0162!.StorageCloud.Enc"
+  "ryptionAlgorithm\022\025\n\rrawDataFrames\030\002 \001(\010\022"
+  "\027\n\017protocolVersion\030\003 \001(\r\0222\n\rhashAlgorith"
+  "m\030\004 \001(\0162\033.StorageCloud.HashAlgorithm\022\021\n\t"
+  "publicKey\030\005 \001(\014\"\221\001\n\013UserDetails\022\020\n\010usern"
+  "ame\030\001 \001(\t\022\021\n\tfirstName\030\002 \001(\t\022\020\n\010lastName"
+  "\030\003 \001(\t\022$\n\004role\030\004 \001(\0162\026.StorageCloud.User"
+  "Role\022\022\n\ntotalSpace\030\005 \001(\004\022\021\n\tusedSpace\030\006 "
+  "\001(\004\"\305\001\n\014CommandStats\022\'\n\004type\030\001 \001(\0162\031.Sto"
+  "rageCloud.CommandType\022\r\n\005count\030\002 \001(\004\022\016\n\006"
+  "errors\030\003 \001(\004\022\017\n\007bytesIn\030\004 \001(\004\022\020\n\010bytesOu"
+  "t\030\005 \001(\004\022\016\n\006meanUs\030\006 \001(\004\022\r\n\005p50Us\030\007 \001(\004\022\r"
+  "\n\005p90Us\030\010 \001(\004\022\r\n\005p99Us\030\t \001(\004\022\r\n\005maxUs\030\n "
+  "\001(\004\"\371\001\n\016ServerResponse\022(\n\004type\030\001 \001(\0162\032.S"
+  "torageCloud.ResponseType\022#\n\006params\030\002 \003(\013"
+  "2\023.StorageCloud.Param\022\014\n\004list\030\003 \003(\t\022$\n\010f"
+  "ileList\030\004 \003(\0132\022.StorageCloud.File\022+\n\010use"
+  "rList\030\005 \003(\0132\031.StorageCloud.UserDetails\022\014"
+  "\n\004data\030\006 \001(\014\022)\n\005stats\030\007 \003(\0132\032.StorageClo"
+  "ud.CommandStats*u\n\rHashAlgorithm\022\t\n\005NULL"
+  "2\020\000\022\014\n\010H_NOHASH\020\001\022\014\n\010H_SHA256\020\002\022\014\n\010H_SHA"
+  "512\020\003\022\n\n\006H_SHA1\020\004\022\t\n\005H_MD5\020\005\022\014\n\010H_CRC32C"
+  "\020\006\022\n\n\006H_XXH3\020\007*I\n\013MessageType\022\t\n\005NULL3\020\000"
+  "\022\013\n\007COMMAND\020\001\022\023\n\017SERVER_RESPONSE\020\002\022\r\n\tHA"
+  "NDSHAKE\020\003*\203\004\n\013CommandType\022\t\n\005NULL1\020\000\022\t\n\005"
+  "LOGIN\020\001\022\013\n\007RELOGIN\020\002\022\n\n\006LOGOUT\020\003\022\014\n\010REGI"
+  "STER\020\004\022\014\n\010GET_STAT\020\005\022\016\n\nLIST_FILES\020\006\022\t\n\005"
+  "MKDIR\020\007\022\n\n\006DELETE\020\010\022\016\n\nC_DOWNLOAD\020\t\022\t\n\005S"
+  "HARE\020\n\022\017\n\013LIST_SHARED\020\013\022\025\n\021ADMIN_LIST_SH"
+  "ARED\020\014\022\014\n\010DOWNLOAD\020\r\022\014\n\010METADATA\020\016\022\014\n\010US"
+  "R_DATA\020\017\022\013\n\007UNSHARE\020\020\022\017\n\013DELETE_USER\020\021\022\024"
+  "\n\020CHANGE_USER_PASS\020\022\022\r\n\tUSER_STAT\020\023\022\023\n\017L"
+  "IST_USER_FILES\020\024\022\024\n\020DELETE_USER_FILE\020\025\022\021"
+  "\n\rADMIN_UNSHARE\020\026\022\024\n\020ADMIN_SHARE_INFO\020\027\022"
+  "\010\n\004WARN\020\030\022\016\n\nLIST_USERS\020\031\022\021\n\rCHANGE_PASS"
+  "WD\020\032\022\017\n\013CLEAR_CACHE\020\033\022\020\n\014CHANGE_QUOTA\020\034\022"
+  "\023\n\017SHARED_DOWNLOAD\020\035\022\016\n\nSHARE_INFO\020\036\022\t\n\005"
+  "STATS\020\037*.\n\010FileType\022\t\n\005NULL6\020\000\022\010\n\004FILE\020\001"
+  "\022\r\n\tDIRECTORY\020\002**\n\010UserRole\022\t\n\005NULL7\020\000\022\010"
+  "\n\004USER\020\001\022\t\n\005ADMIN\020\002*\217\001\n\014ResponseType\022\t\n\005"
+  "NULL5\020\000\022\006\n\002OK\020\001\022\t\n\005ERROR\020\002\022\n\n\006LOGGED\020\003\022\010"
+  "\n\004STAT\020\004\022\t\n\005FILES\020\005\022\n\n\006SHARED\020\006\022\014\n\010SRV_D"
+  "ATA\020\007\022\014\n\010CAN_SEND\020\010\022\t\n\005USERS\020\t\022\r\n\tCMD_ST"
+  "ATS\020\n*`\n\023EncryptionAlgorithm\022\t\n\005NULL4\020\000\022"
+  "\020\n\014NOENCRYPTION\020\001\022\n\n\006CAESAR\020\002\022\017\n\013AES_128"
+  "_GCM\020\003\022\017\n\013AES_256_GCM\020\004B+\n\'com.github.mi"
+  "kee2509.storagecloud.protoP\001b\006proto3"
+  ;
+static ::_pbi::once_flag descriptor_table_messages_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_messages_2eproto = {
+    false, false, 2476, descriptor_table_protodef_messages_2eproto,
+    "messages.proto",
+    &descriptor_table_messages_2eproto_once, nullptr, 0, 8,
+    schemas, file_default_instances, TableStruct_messages_2eproto::offsets,
+    file_level_metadata_messages_2eproto, file_level_enum_descriptors_messages_2eproto,
+    file_level_service_descriptors_messages_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_messages_2eproto_getter() {
+  return &descriptor_table_messages_2eproto;
 }
 
-void AddDescriptors() {
-  static GOOGLE_PROTOBUF_DECLARE_ONCE(once);
-  ::google::protobuf::GoogleOnceInit(&once, &AddDescriptorsImpl);
-}
-// Force AddDescriptors() to be called at dynamic initialization time.
-struct StaticDescriptorInitializer {
-  StaticDescriptorInitializer() {
-    AddDescriptors();
-  }
-} static_descriptor_initializer;
-}  // namespace protobuf_messages_2eproto
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_messages_2eproto(&descriptor_table_messages_2eproto);
 namespace StorageCloud {
-const ::google::protobuf::EnumDescriptor* HashAlgorithm_descriptor() {
-  protobuf_messages_2eproto::protobuf_AssignDescriptorsOnce();
-  return protobuf_messages_2eproto::file_level_enum_descriptors[0];
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* HashAlgorithm_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_messages_2eproto);
+  return file_level_enum_descriptors_messages_2eproto[0];
 }
 bool HashAlgorithm_IsValid(int value) {
   switch (value) {
@@ -410,15 +384,17 @@ bool HashAlgorithm_IsValid(int value) {
     case 3:
     case 4:
     case 5:
+    case 6:
+    case 7:
       return true;
     default:
       return false;
   }
 }
 
-const ::google::protobuf::EnumDescriptor* MessageType_descriptor() {
-  protobuf_messages_2eproto::protobuf_AssignDescriptorsOnce();
-  return protobuf_messages_2eproto::file_level_enum_descriptors[1];
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* MessageType_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_messages_2eproto);
+  return file_level_enum_descriptors_messages_2eproto[1];
 }
 bool MessageType_IsValid(int value) {
   switch (value) {
@@ -432,9 +408,9 @@ bool MessageType_IsValid(int value) {
   }
 }
 
-const ::google::protobuf::EnumDescriptor* CommandType_descriptor() {
-  protobuf_messages_2eproto::protobuf_AssignDescriptorsOnce();
-  return protobuf_messages_2eproto::file_level_enum_descriptors[2];
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* CommandType_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_messages_2eproto);
+  return file_level_enum_descriptors_messages_2eproto[2];
 }
 bool CommandType_IsValid(int value) {
   switch (value) {
@@ -469,15 +445,16 @@ bool CommandType_IsValid(int value) {
     case 28:
     case 29:
     case 30:
+    case 31:
       return true;
     default:
       return false;
   }
 }
 
-const ::google::protobuf::EnumDescriptor* FileType_descriptor() {
-  protobuf_messages_2eproto::protobuf_AssignDescriptorsOnce();
-  return protobuf_messages_2eproto::file_level_enum_descriptors[3];
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* FileType_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_messages_2eproto);
+  return file_level_enum_descriptors_messages_2eproto[3];
 }
 bool FileType_IsValid(int value) {
   switch (value) {
@@ -490,9 +467,9 @@ bool FileType_IsValid(int value) {
   }
 }
 
-const ::google::protobuf::EnumDescriptor* UserRole_descriptor() {
-  protobuf_messages_2eproto::protobuf_AssignDescriptorsOnce();
-  return protobuf_messages_2eproto::file_level_enum_descriptors[4];
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* UserRole_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_messages_2eproto);
+  return file_level_enum_descriptors_messages_2eproto[4];
 }
 bool UserRole_IsValid(int value) {
   switch (value) {
@@ -505,9 +482,9 @@ bool UserRole_IsValid(int value) {
   }
 }
 
-const ::google::protobuf::EnumDescriptor* ResponseType_descriptor() {
-  protobuf_messages_2eproto::protobuf_AssignDescriptorsOnce();
-  return protobuf_messages_2eproto::file_level_enum_descriptors[5];
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* ResponseType_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_messages_2eproto);
+  return file_level_enum_descriptors_messages_2eproto[5];
 }
 bool ResponseType_IsValid(int value) {
   switch (value) {
@@ -521,21 +498,24 @@ bool ResponseType_IsValid(int value) {
     case 7:
     case 8:
     case 9:
+    case 10:
       return true;
     default:
       return false;
   }
 }
 
-const ::google::protobuf::EnumDescriptor* EncryptionAlgorithm_descriptor() {
-  protobuf_messages_2eproto::protobuf_AssignDescriptorsOnce();
-  return protobuf_messages_2eproto::file_level_enum_descriptors[6];
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* EncryptionAlgorithm_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_messages_2eproto);
+  return file_level_enum_descriptors_messages_2eproto[6];
 }
 bool EncryptionAlgorithm_IsValid(int value) {
   switch (value) {
     case 0:
     case 1:
     case 2:
+    case 3:
+    case 4:
       return true;
     default:
       return false;
@@ -545,49 +525,46 @@ bool EncryptionAlgorithm_IsValid(int value) {
 
 // ===================================================================
 
-void Param::InitAsDefaultInstance() {
-  ::StorageCloud::_Param_default_instance_.sparamval_.UnsafeSetDefault(
-      &::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  ::StorageCloud::_Param_default_instance_.iparamval_ = GOOGLE_LONGLONG(0);
-  ::StorageCloud::_Param_default_instance_.bparamval_.UnsafeSetDefault(
-      &::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int Param::kParamIdFieldNumber;
-const int Param::kSParamValFieldNumber;
-const int Param::kIParamValFieldNumber;
-const int Param::kBParamValFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+class Param::_Internal {
+ public:
+};
 
-Param::Param()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
-    ::protobuf_messages_2eproto::InitDefaultsParam();
-  }
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:StorageCloud.Param)
+Param::Param(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:StorageCloud.Param)
 }
 Param::Param(const Param& from)
-  : ::google::protobuf::Message(),
-      _internal_metadata_(NULL),
-      _cached_size_(0) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  paramid_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.paramid().size() > 0) {
-    paramid_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.paramid_);
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Param* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.paramid_){}
+    , decltype(_impl_.value_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.paramid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.paramid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_paramid().empty()) {
+    _this->_impl_.paramid_.Set(from._internal_paramid(), 
+      _this->GetArenaForAllocation());
   }
   clear_has_value();
   switch (from.value_case()) {
     case kSParamVal: {
-      set_sparamval(from.sparamval());
+      _this->_internal_set_sparamval(from._internal_sparamval());
       break;
     }
     case kIParamVal: {
-      set_iparamval(from.iparamval());
+      _this->_internal_set_iparamval(from._internal_iparamval());
       break;
     }
     case kBParamVal: {
-      set_bparamval(from.bparamval());
+      _this->_internal_set_bparamval(from._internal_bparamval());
       break;
     }
     case VALUE_NOT_SET: {
@@ -597,52 +574,49 @@ Param::Param(const Param& from)
   // @@protoc_insertion_point(copy_constructor:StorageCloud.Param)
 }
 
-void Param::SharedCtor() {
-  paramid_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline void Param::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.paramid_){}
+    , decltype(_impl_.value_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}
+  };
+  _impl_.paramid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.paramid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   clear_has_value();
-  _cached_size_ = 0;
 }
 
 Param::~Param() {
   // @@protoc_insertion_point(destructor:StorageCloud.Param)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void Param::SharedDtor() {
-  paramid_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline void Param::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.paramid_.Destroy();
   if (has_value()) {
     clear_value();
   }
 }
 
 void Param::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* Param::descriptor() {
-  ::protobuf_messages_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_messages_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
-}
-
-const Param& Param::default_instance() {
-  ::protobuf_messages_2eproto::InitDefaultsParam();
-  return *internal_default_instance();
-}
-
-Param* Param::New(::google::protobuf::Arena* arena) const {
-  Param* n = new Param;
-  if (arena != NULL) {
-    arena->Own(n);
-  }
-  return n;
+  _impl_._cached_size_.Set(size);
 }
 
 void Param::clear_value() {
 // @@protoc_insertion_point(one_of_clear_start:StorageCloud.Param)
   switch (value_case()) {
     case kSParamVal: {
-      value_.sparamval_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+      _impl_.value_.sparamval_.Destroy();
       break;
     }
     case kIParamVal: {
@@ -650,205 +624,135 @@ void Param::clear_value() {
       break;
     }
     case kBParamVal: {
-      value_.bparamval_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+      _impl_.value_.bparamval_.Destroy();
       break;
     }
     case VALUE_NOT_SET: {
       break;
     }
   }
-  _oneof_case_[0] = VALUE_NOT_SET;
+  _impl_._oneof_case_[0] = VALUE_NOT_SET;
 }
 
 
 void Param::Clear() {
 // @@protoc_insertion_point(message_clear_start:StorageCloud.Param)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  paramid_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.paramid_.ClearToEmpty();
   clear_value();
-  _internal_metadata_.Clear();
-}
-
-bool Param::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:StorageCloud.Param)
-  for (;;) {
-    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Param::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // string paramId = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(10u /* 10 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_paramid()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->paramid().data(), static_cast<int>(this->paramid().length()),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "StorageCloud.Param.paramId"));
-        } else {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_paramid();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "StorageCloud.Param.paramId"));
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // string SParamVal = 2;
-      case 2: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(18u /* 18 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_sparamval()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->sparamval().data(), static_cast<int>(this->sparamval().length()),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "StorageCloud.Param.SParamVal"));
-        } else {
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_sparamval();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "StorageCloud.Param.SParamVal"));
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // int64 IParamVal = 3;
-      case 3: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(24u /* 24 & 0xFF */)) {
-          clear_value();
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int64, ::google::protobuf::internal::WireFormatLite::TYPE_INT64>(
-                 input, &value_.iparamval_)));
-          set_has_iparamval();
-        } else {
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _internal_set_iparamval(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr));
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // bytes BParamVal = 4;
-      case 4: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(34u /* 34 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadBytes(
-                input, this->mutable_bparamval()));
-        } else {
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_bparamval();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, _internal_metadata_.mutable_unknown_fields()));
-        break;
-      }
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:StorageCloud.Param)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:StorageCloud.Param)
-  return false;
-#undef DO_
-}
-
-void Param::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:StorageCloud.Param)
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  // string paramId = 1;
-  if (this->paramid().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->paramid().data(), static_cast<int>(this->paramid().length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "StorageCloud.Param.paramId");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      1, this->paramid(), output);
-  }
-
-  // string SParamVal = 2;
-  if (has_sparamval()) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->sparamval().data(), static_cast<int>(this->sparamval().length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "StorageCloud.Param.SParamVal");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      2, this->sparamval(), output);
-  }
-
-  // int64 IParamVal = 3;
-  if (has_iparamval()) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt64(3, this->iparamval(), output);
-  }
-
-  // bytes BParamVal = 4;
-  if (has_bparamval()) {
-    ::google::protobuf::internal::WireFormatLite::WriteBytesMaybeAliased(
-      4, this->bparamval(), output);
-  }
-
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
-  }
-  // @@protoc_insertion_point(serialize_end:StorageCloud.Param)
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-::google::protobuf::uint8* Param::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
-  (void)deterministic; // Unused
+uint8_t* Param::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:StorageCloud.Param)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // string paramId = 1;
-  if (this->paramid().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->paramid().data(), static_cast<int>(this->paramid().length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+  if (!this->_internal_paramid().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_paramid().data(), static_cast<int>(this->_internal_paramid().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
       "StorageCloud.Param.paramId");
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        1, this->paramid(), target);
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_paramid(), target);
   }
 
   // string SParamVal = 2;
-  if (has_sparamval()) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->sparamval().data(), static_cast<int>(this->sparamval().length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+  if (_internal_has_sparamval()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_sparamval().data(), static_cast<int>(this->_internal_sparamval().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
       "StorageCloud.Param.SParamVal");
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        2, this->sparamval(), target);
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_sparamval(), target);
   }
 
   // int64 IParamVal = 3;
-  if (has_iparamval()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt64ToArray(3, this->iparamval(), target);
+  if (_internal_has_iparamval()) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(3, this->_internal_iparamval(), target);
   }
 
   // bytes BParamVal = 4;
-  if (has_bparamval()) {
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteBytesToArray(
-        4, this->bparamval(), target);
+  if (_internal_has_bparamval()) {
+    target = stream->WriteBytesMaybeAliased(
+        4, this->_internal_bparamval(), target);
   }
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:StorageCloud.Param)
   return target;
@@ -858,101 +762,80 @@ size_t Param::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:StorageCloud.Param)
   size_t total_size = 0;
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
-  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
   // string paramId = 1;
-  if (this->paramid().size() > 0) {
+  if (!this->_internal_paramid().empty()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->paramid());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_paramid());
   }
 
   switch (value_case()) {
     // string SParamVal = 2;
     case kSParamVal: {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::StringSize(
-          this->sparamval());
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_sparamval());
       break;
     }
     // int64 IParamVal = 3;
     case kIParamVal: {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::Int64Size(
-          this->iparamval());
+      total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_iparamval());
       break;
     }
     // bytes BParamVal = 4;
     case kBParamVal: {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::BytesSize(
-          this->bparamval());
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+          this->_internal_bparamval());
       break;
     }
     case VALUE_NOT_SET: {
       break;
     }
   }
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = cached_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
-}
-
-void Param::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:StorageCloud.Param)
-  GOOGLE_DCHECK_NE(&from, this);
-  const Param* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const Param>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:StorageCloud.Param)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:StorageCloud.Param)
-    MergeFrom(*source);
-  }
-}
-
-void Param::MergeFrom(const Param& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:StorageCloud.Param)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Param::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Param::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Param::GetClassData() const { return &_class_data_; }
+
 
-  if (from.paramid().size() > 0) {
+void Param::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Param*>(&to_msg);
+  auto& from = static_cast<const Param&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:StorageCloud.Param)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-    paramid_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.paramid_);
+  if (!from._internal_paramid().empty()) {
+    _this->_internal_set_paramid(from._internal_paramid());
   }
   switch (from.value_case()) {
     case kSParamVal: {
-      set_sparamval(from.sparamval());
+      _this->_internal_set_sparamval(from._internal_sparamval());
       break;
     }
     case kIParamVal: {
-      set_iparamval(from.iparamval());
+      _this->_internal_set_iparamval(from._internal_iparamval());
       break;
     }
     case kBParamVal: {
-      set_bparamval(from.bparamval());
+      _this->_internal_set_bparamval(from._internal_bparamval());
       break;
     }
     case VALUE_NOT_SET: {
       break;
     }
   }
-}
-
-void Param::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:StorageCloud.Param)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void Param::CopyFrom(const Param& from) {
@@ -966,301 +849,240 @@ bool Param::IsInitialized() const {
   return true;
 }
 
-void Param::Swap(Param* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void Param::InternalSwap(Param* other) {
   using std::swap;
-  paramid_.Swap(&other->paramid_);
-  swap(value_, other->value_);
-  swap(_oneof_case_[0], other->_oneof_case_[0]);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  swap(_cached_size_, other->_cached_size_);
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.paramid_, lhs_arena,
+      &other->_impl_.paramid_, rhs_arena
+  );
+  swap(_impl_.value_, other->_impl_.value_);
+  swap(_impl_._oneof_case_[0], other->_impl_._oneof_case_[0]);
 }
 
-::google::protobuf::Metadata Param::GetMetadata() const {
-  protobuf_messages_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_messages_2eproto::file_level_metadata[kIndexInFileMessages];
+::PROTOBUF_NAMESPACE_ID::Metadata Param::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_messages_2eproto_getter, &descriptor_table_messages_2eproto_once,
+      file_level_metadata_messages_2eproto[0]);
 }
 
-
 // ===================================================================
 
-void EncodedMessage::InitAsDefaultInstance() {
-}
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int EncodedMessage::kDataSizeFieldNumber;
-const int EncodedMessage::kHashAlgorithmFieldNumber;
-const int EncodedMessage::kHashFieldNumber;
-const int EncodedMessage::kTypeFieldNumber;
-const int EncodedMessage::kDataFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+class EncodedMessage::_Internal {
+ public:
+};
 
-EncodedMessage::EncodedMessage()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
-    ::protobuf_messages_2eproto::InitDefaultsEncodedMessage();
-  }
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:StorageCloud.EncodedMessage)
+EncodedMessage::EncodedMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:StorageCloud.EncodedMessage)
 }
 EncodedMessage::EncodedMessage(const EncodedMessage& from)
-  : ::google::protobuf::Message(),
-      _internal_metadata_(NULL),
-      _cached_size_(0) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  hash_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.hash().size() > 0) {
-    hash_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.hash_);
-  }
-  data_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.data().size() > 0) {
-    data_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.data_);
-  }
-  ::memcpy(&datasize_, &from.datasize_,
-    static_cast<size_t>(reinterpret_cast<char*>(&type_) -
-    reinterpret_cast<char*>(&datasize_)) + sizeof(type_));
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  EncodedMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.hash_){}
+    , decltype(_impl_.data_){}
+    , decltype(_impl_.datasize_){}
+    , decltype(_impl_.hashalgorithm_){}
+    , decltype(_impl_.type_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.hash_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.hash_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_hash().empty()) {
+    _this->_impl_.hash_.Set(from._internal_hash(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.data_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.data_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_data().empty()) {
+    _this->_impl_.data_.Set(from._internal_data(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.datasize_, &from._impl_.datasize_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.type_) -
+    reinterpret_cast<char*>(&_impl_.datasize_)) + sizeof(_impl_.type_));
   // @@protoc_insertion_point(copy_constructor:StorageCloud.EncodedMessage)
 }
 
-void EncodedMessage::SharedCtor() {
-  hash_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  data_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  ::memset(&datasize_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&type_) -
-      reinterpret_cast<char*>(&datasize_)) + sizeof(type_));
-  _cached_size_ = 0;
+inline void EncodedMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.hash_){}
+    , decltype(_impl_.data_){}
+    , decltype(_impl_.datasize_){uint64_t{0u}}
+    , decltype(_impl_.hashalgorithm_){0}
+    , decltype(_impl_.type_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.hash_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.hash_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.data_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.data_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 EncodedMessage::~EncodedMessage() {
   // @@protoc_insertion_point(destructor:StorageCloud.EncodedMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void EncodedMessage::SharedDtor() {
-  hash_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  data_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline void EncodedMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.hash_.Destroy();
+  _impl_.data_.Destroy();
 }
 
 void EncodedMessage::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* EncodedMessage::descriptor() {
-  ::protobuf_messages_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_messages_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
-}
-
-const EncodedMessage& EncodedMessage::default_instance() {
-  ::protobuf_messages_2eproto::InitDefaultsEncodedMessage();
-  return *internal_default_instance();
-}
-
-EncodedMessage* EncodedMessage::New(::google::protobuf::Arena* arena) const {
-  EncodedMessage* n = new EncodedMessage;
-  if (arena != NULL) {
-    arena->Own(n);
-  }
-  return n;
+  _impl_._cached_size_.Set(size);
 }
 
 void EncodedMessage::Clear() {
 // @@protoc_insertion_point(message_clear_start:StorageCloud.EncodedMessage)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  hash_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  data_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  ::memset(&datasize_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&type_) -
-      reinterpret_cast<char*>(&datasize_)) + sizeof(type_));
-  _internal_metadata_.Clear();
-}
-
-bool EncodedMessage::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:StorageCloud.EncodedMessage)
-  for (;;) {
-    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+  _impl_.hash_.ClearToEmpty();
+  _impl_.data_.ClearToEmpty();
+  ::memset(&_impl_.datasize_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.type_) -
+      reinterpret_cast<char*>(&_impl_.datasize_)) + sizeof(_impl_.type_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* EncodedMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // uint64 dataSize = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(8u /* 8 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
-                 input, &datasize_)));
-        } else {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.datasize_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // .StorageCloud.HashAlgorithm hashAlgorithm = 2;
-      case 2: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(16u /* 16 & 0xFF */)) {
-          int value;
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   int, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>(
-                 input, &value)));
-          set_hashalgorithm(static_cast< ::StorageCloud::HashAlgorithm >(value));
-        } else {
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_hashalgorithm(static_cast<::StorageCloud::HashAlgorithm>(val));
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // bytes hash = 3;
-      case 3: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(26u /* 26 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadBytes(
-                input, this->mutable_hash()));
-        } else {
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_hash();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // .StorageCloud.MessageType type = 4;
-      case 4: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(32u /* 32 & 0xFF */)) {
-          int value;
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   int, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>(
-                 input, &value)));
-          set_type(static_cast< ::StorageCloud::MessageType >(value));
-        } else {
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_type(static_cast<::StorageCloud::MessageType>(val));
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // bytes data = 5;
-      case 5: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(42u /* 42 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadBytes(
-                input, this->mutable_data()));
-        } else {
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          auto str = _internal_mutable_data();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, _internal_metadata_.mutable_unknown_fields()));
-        break;
-      }
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:StorageCloud.EncodedMessage)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:StorageCloud.EncodedMessage)
-  return false;
-#undef DO_
-}
-
-void EncodedMessage::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:StorageCloud.EncodedMessage)
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  // uint64 dataSize = 1;
-  if (this->datasize() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt64(1, this->datasize(), output);
-  }
-
-  // .StorageCloud.HashAlgorithm hashAlgorithm = 2;
-  if (this->hashalgorithm() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteEnum(
-      2, this->hashalgorithm(), output);
-  }
-
-  // bytes hash = 3;
-  if (this->hash().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteBytesMaybeAliased(
-      3, this->hash(), output);
-  }
-
-  // .StorageCloud.MessageType type = 4;
-  if (this->type() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteEnum(
-      4, this->type(), output);
-  }
-
-  // bytes data = 5;
-  if (this->data().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteBytesMaybeAliased(
-      5, this->data(), output);
-  }
-
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
-  }
-  // @@protoc_insertion_point(serialize_end:StorageCloud.EncodedMessage)
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-::google::protobuf::uint8* EncodedMessage::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
-  (void)deterministic; // Unused
+uint8_t* EncodedMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:StorageCloud.EncodedMessage)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // uint64 dataSize = 1;
-  if (this->datasize() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(1, this->datasize(), target);
+  if (this->_internal_datasize() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_datasize(), target);
   }
 
   // .StorageCloud.HashAlgorithm hashAlgorithm = 2;
-  if (this->hashalgorithm() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteEnumToArray(
-      2, this->hashalgorithm(), target);
+  if (this->_internal_hashalgorithm() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      2, this->_internal_hashalgorithm(), target);
   }
 
   // bytes hash = 3;
-  if (this->hash().size() > 0) {
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteBytesToArray(
-        3, this->hash(), target);
+  if (!this->_internal_hash().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        3, this->_internal_hash(), target);
   }
 
   // .StorageCloud.MessageType type = 4;
-  if (this->type() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteEnumToArray(
-      4, this->type(), target);
+  if (this->_internal_type() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      4, this->_internal_type(), target);
   }
 
   // bytes data = 5;
-  if (this->data().size() > 0) {
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteBytesToArray(
-        5, this->data(), target);
+  if (!this->_internal_data().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        5, this->_internal_data(), target);
   }
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:StorageCloud.EncodedMessage)
   return target;
@@ -1270,97 +1092,75 @@ size_t EncodedMessage::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:StorageCloud.EncodedMessage)
   size_t total_size = 0;
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
-  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
   // bytes hash = 3;
-  if (this->hash().size() > 0) {
+  if (!this->_internal_hash().empty()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::BytesSize(
-        this->hash());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_hash());
   }
 
   // bytes data = 5;
-  if (this->data().size() > 0) {
+  if (!this->_internal_data().empty()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::BytesSize(
-        this->data());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_data());
   }
 
   // uint64 dataSize = 1;
-  if (this->datasize() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::UInt64Size(
-        this->datasize());
+  if (this->_internal_datasize() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_datasize());
   }
 
   // .StorageCloud.HashAlgorithm hashAlgorithm = 2;
-  if (this->hashalgorithm() != 0) {
+  if (this->_internal_hashalgorithm() != 0) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::EnumSize(this->hashalgorithm());
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_hashalgorithm());
   }
 
   // .StorageCloud.MessageType type = 4;
-  if (this->type() != 0) {
+  if (this->_internal_type() != 0) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::EnumSize(this->type());
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_type());
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = cached_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void EncodedMessage::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:StorageCloud.EncodedMessage)
-  GOOGLE_DCHECK_NE(&from, this);
-  const EncodedMessage* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const EncodedMessage>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:StorageCloud.EncodedMessage)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:StorageCloud.EncodedMessage)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData EncodedMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    EncodedMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*EncodedMessage::GetClassData() const { return &_class_data_; }
 
-void EncodedMessage::MergeFrom(const EncodedMessage& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:StorageCloud.EncodedMessage)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
 
-  if (from.hash().size() > 0) {
+void EncodedMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<EncodedMessage*>(&to_msg);
+  auto& from = static_cast<const EncodedMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:StorageCloud.EncodedMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-    hash_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.hash_);
+  if (!from._internal_hash().empty()) {
+    _this->_internal_set_hash(from._internal_hash());
   }
-  if (from.data().size() > 0) {
-
-    data_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.data_);
+  if (!from._internal_data().empty()) {
+    _this->_internal_set_data(from._internal_data());
   }
-  if (from.datasize() != 0) {
-    set_datasize(from.datasize());
+  if (from._internal_datasize() != 0) {
+    _this->_internal_set_datasize(from._internal_datasize());
   }
-  if (from.hashalgorithm() != 0) {
-    set_hashalgorithm(from.hashalgorithm());
+  if (from._internal_hashalgorithm() != 0) {
+    _this->_internal_set_hashalgorithm(from._internal_hashalgorithm());
   }
-  if (from.type() != 0) {
-    set_type(from.type());
+  if (from._internal_type() != 0) {
+    _this->_internal_set_type(from._internal_type());
   }
-}
-
-void EncodedMessage::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:StorageCloud.EncodedMessage)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void EncodedMessage::CopyFrom(const EncodedMessage& from) {
@@ -1374,280 +1174,233 @@ bool EncodedMessage::IsInitialized() const {
   return true;
 }
 
-void EncodedMessage::Swap(EncodedMessage* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void EncodedMessage::InternalSwap(EncodedMessage* other) {
   using std::swap;
-  hash_.Swap(&other->hash_);
-  data_.Swap(&other->data_);
-  swap(datasize_, other->datasize_);
-  swap(hashalgorithm_, other->hashalgorithm_);
-  swap(type_, other->type_);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  swap(_cached_size_, other->_cached_size_);
-}
-
-::google::protobuf::Metadata EncodedMessage::GetMetadata() const {
-  protobuf_messages_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_messages_2eproto::file_level_metadata[kIndexInFileMessages];
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.hash_, lhs_arena,
+      &other->_impl_.hash_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.data_, lhs_arena,
+      &other->_impl_.data_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(EncodedMessage, _impl_.type_)
+      + sizeof(EncodedMessage::_impl_.type_)
+      - PROTOBUF_FIELD_OFFSET(EncodedMessage, _impl_.datasize_)>(
+          reinterpret_cast<char*>(&_impl_.datasize_),
+          reinterpret_cast<char*>(&other->_impl_.datasize_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata EncodedMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_messages_2eproto_getter, &descriptor_table_messages_2eproto_once,
+      file_level_metadata_messages_2eproto[1]);
 }
 
-
 // ===================================================================
 
-void Command::InitAsDefaultInstance() {
-}
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int Command::kTypeFieldNumber;
-const int Command::kParamsFieldNumber;
-const int Command::kListFieldNumber;
-const int Command::kDataFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+class Command::_Internal {
+ public:
+};
 
-Command::Command()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
-    ::protobuf_messages_2eproto::InitDefaultsCommand();
-  }
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:StorageCloud.Command)
+Command::Command(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:StorageCloud.Command)
 }
 Command::Command(const Command& from)
-  : ::google::protobuf::Message(),
-      _internal_metadata_(NULL),
-      params_(from.params_),
-      list_(from.list_),
-      _cached_size_(0) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  data_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.data().size() > 0) {
-    data_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.data_);
-  }
-  type_ = from.type_;
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Command* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.params_){from._impl_.params_}
+    , decltype(_impl_.list_){from._impl_.list_}
+    , decltype(_impl_.data_){}
+    , decltype(_impl_.type_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.data_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.data_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_data().empty()) {
+    _this->_impl_.data_.Set(from._internal_data(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.type_ = from._impl_.type_;
   // @@protoc_insertion_point(copy_constructor:StorageCloud.Command)
 }
 
-void Command::SharedCtor() {
-  data_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  type_ = 0;
-  _cached_size_ = 0;
+inline void Command::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.params_){arena}
+    , decltype(_impl_.list_){arena}
+    , decltype(_impl_.data_){}
+    , decltype(_impl_.type_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.data_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.data_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 Command::~Command() {
   // @@protoc_insertion_point(destructor:StorageCloud.Command)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void Command::SharedDtor() {
-  data_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline void Command::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.params_.~RepeatedPtrField();
+  _impl_.list_.~RepeatedPtrField();
+  _impl_.data_.Destroy();
 }
 
 void Command::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* Command::descriptor() {
-  ::protobuf_messages_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_messages_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
-}
-
-const Command& Command::default_instance() {
-  ::protobuf_messages_2eproto::InitDefaultsCommand();
-  return *internal_default_instance();
-}
-
-Command* Command::New(::google::protobuf::Arena* arena) const {
-  Command* n = new Command;
-  if (arena != NULL) {
-    arena->Own(n);
-  }
-  return n;
+  _impl_._cached_size_.Set(size);
 }
 
 void Command::Clear() {
 // @@protoc_insertion_point(message_clear_start:StorageCloud.Command)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  params_.Clear();
-  list_.Clear();
-  data_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  type_ = 0;
-  _internal_metadata_.Clear();
-}
-
-bool Command::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:StorageCloud.Command)
-  for (;;) {
-    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+  _impl_.params_.Clear();
+  _impl_.list_.Clear();
+  _impl_.data_.ClearToEmpty();
+  _impl_.type_ = 0;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Command::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // .StorageCloud.CommandType type = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(8u /* 8 & 0xFF */)) {
-          int value;
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   int, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>(
-                 input, &value)));
-          set_type(static_cast< ::StorageCloud::CommandType >(value));
-        } else {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_type(static_cast<::StorageCloud::CommandType>(val));
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // repeated .StorageCloud.Param params = 2;
-      case 2: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(18u /* 18 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(input, add_params()));
-        } else {
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_params(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // repeated string list = 3;
-      case 3: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(26u /* 26 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->add_list()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->list(this->list_size() - 1).data(),
-            static_cast<int>(this->list(this->list_size() - 1).length()),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "StorageCloud.Command.list"));
-        } else {
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_list();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            CHK_(::_pbi::VerifyUTF8(str, "StorageCloud.Command.list"));
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // bytes data = 4;
-      case 4: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(34u /* 34 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadBytes(
-                input, this->mutable_data()));
-        } else {
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_data();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, _internal_metadata_.mutable_unknown_fields()));
-        break;
-      }
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:StorageCloud.Command)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:StorageCloud.Command)
-  return false;
-#undef DO_
-}
-
-void Command::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:StorageCloud.Command)
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  // .StorageCloud.CommandType type = 1;
-  if (this->type() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteEnum(
-      1, this->type(), output);
-  }
-
-  // repeated .StorageCloud.Param params = 2;
-  for (unsigned int i = 0,
-      n = static_cast<unsigned int>(this->params_size()); i < n; i++) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      2, this->params(static_cast<int>(i)), output);
-  }
-
-  // repeated string list = 3;
-  for (int i = 0, n = this->list_size(); i < n; i++) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->list(i).data(), static_cast<int>(this->list(i).length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "StorageCloud.Command.list");
-    ::google::protobuf::internal::WireFormatLite::WriteString(
-      3, this->list(i), output);
-  }
-
-  // bytes data = 4;
-  if (this->data().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteBytesMaybeAliased(
-      4, this->data(), output);
-  }
-
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
-  }
-  // @@protoc_insertion_point(serialize_end:StorageCloud.Command)
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-::google::protobuf::uint8* Command::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
-  (void)deterministic; // Unused
+uint8_t* Command::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:StorageCloud.Command)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // .StorageCloud.CommandType type = 1;
-  if (this->type() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteEnumToArray(
-      1, this->type(), target);
+  if (this->_internal_type() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      1, this->_internal_type(), target);
   }
 
   // repeated .StorageCloud.Param params = 2;
-  for (unsigned int i = 0,
-      n = static_cast<unsigned int>(this->params_size()); i < n; i++) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      InternalWriteMessageToArray(
-        2, this->params(static_cast<int>(i)), deterministic, target);
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_params_size()); i < n; i++) {
+    const auto& repfield = this->_internal_params(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
   }
 
   // repeated string list = 3;
-  for (int i = 0, n = this->list_size(); i < n; i++) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->list(i).data(), static_cast<int>(this->list(i).length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+  for (int i = 0, n = this->_internal_list_size(); i < n; i++) {
+    const auto& s = this->_internal_list(i);
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      s.data(), static_cast<int>(s.length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
       "StorageCloud.Command.list");
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteStringToArray(3, this->list(i), target);
+    target = stream->WriteString(3, s, target);
   }
 
   // bytes data = 4;
-  if (this->data().size() > 0) {
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteBytesToArray(
-        4, this->data(), target);
+  if (!this->_internal_data().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        4, this->_internal_data(), target);
   }
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:StorageCloud.Command)
   return target;
@@ -1657,88 +1410,65 @@ size_t Command::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:StorageCloud.Command)
   size_t total_size = 0;
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
-  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
   // repeated .StorageCloud.Param params = 2;
-  {
-    unsigned int count = static_cast<unsigned int>(this->params_size());
-    total_size += 1UL * count;
-    for (unsigned int i = 0; i < count; i++) {
-      total_size +=
-        ::google::protobuf::internal::WireFormatLite::MessageSize(
-          this->params(static_cast<int>(i)));
-    }
+  total_size += 1UL * this->_internal_params_size();
+  for (const auto& msg : this->_impl_.params_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
   // repeated string list = 3;
   total_size += 1 *
-      ::google::protobuf::internal::FromIntSize(this->list_size());
-  for (int i = 0, n = this->list_size(); i < n; i++) {
-    total_size += ::google::protobuf::internal::WireFormatLite::StringSize(
-      this->list(i));
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.list_.size());
+  for (int i = 0, n = _impl_.list_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      _impl_.list_.Get(i));
   }
 
   // bytes data = 4;
-  if (this->data().size() > 0) {
+  if (!this->_internal_data().empty()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::BytesSize(
-        this->data());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_data());
   }
 
   // .StorageCloud.CommandType type = 1;
-  if (this->type() != 0) {
+  if (this->_internal_type() != 0) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::EnumSize(this->type());
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_type());
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = cached_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void Command::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:StorageCloud.Command)
-  GOOGLE_DCHECK_NE(&from, this);
-  const Command* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const Command>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:StorageCloud.Command)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:StorageCloud.Command)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Command::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Command::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Command::GetClassData() const { return &_class_data_; }
 
-void Command::MergeFrom(const Command& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:StorageCloud.Command)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
 
-  params_.MergeFrom(from.params_);
-  list_.MergeFrom(from.list_);
-  if (from.data().size() > 0) {
+void Command::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Command*>(&to_msg);
+  auto& from = static_cast<const Command&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:StorageCloud.Command)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-    data_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.data_);
+  _this->_impl_.params_.MergeFrom(from._impl_.params_);
+  _this->_impl_.list_.MergeFrom(from._impl_.list_);
+  if (!from._internal_data().empty()) {
+    _this->_internal_set_data(from._internal_data());
   }
-  if (from.type() != 0) {
-    set_type(from.type());
+  if (from._internal_type() != 0) {
+    _this->_internal_set_type(from._internal_type());
   }
-}
-
-void Command::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:StorageCloud.Command)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void Command::CopyFrom(const Command& from) {
@@ -1752,426 +1482,332 @@ bool Command::IsInitialized() const {
   return true;
 }
 
-void Command::Swap(Command* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void Command::InternalSwap(Command* other) {
   using std::swap;
-  params_.InternalSwap(&other->params_);
-  list_.InternalSwap(&other->list_);
-  data_.Swap(&other->data_);
-  swap(type_, other->type_);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  swap(_cached_size_, other->_cached_size_);
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.params_.InternalSwap(&other->_impl_.params_);
+  _impl_.list_.InternalSwap(&other->_impl_.list_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.data_, lhs_arena,
+      &other->_impl_.data_, rhs_arena
+  );
+  swap(_impl_.type_, other->_impl_.type_);
 }
 
-::google::protobuf::Metadata Command::GetMetadata() const {
-  protobuf_messages_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_messages_2eproto::file_level_metadata[kIndexInFileMessages];
+::PROTOBUF_NAMESPACE_ID::Metadata Command::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_messages_2eproto_getter, &descriptor_table_messages_2eproto_once,
+      file_level_metadata_messages_2eproto[2]);
 }
 
-
 // ===================================================================
 
-void File::InitAsDefaultInstance() {
-}
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int File::kFilenameFieldNumber;
-const int File::kFiletypeFieldNumber;
-const int File::kSizeFieldNumber;
-const int File::kHashFieldNumber;
-const int File::kOwnerFieldNumber;
-const int File::kOwnerUsernameFieldNumber;
-const int File::kCreationDateFieldNumber;
-const int File::kIsSharedFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+class File::_Internal {
+ public:
+};
 
-File::File()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
-    ::protobuf_messages_2eproto::InitDefaultsFile();
-  }
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:StorageCloud.File)
+File::File(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:StorageCloud.File)
 }
 File::File(const File& from)
-  : ::google::protobuf::Message(),
-      _internal_metadata_(NULL),
-      _cached_size_(0) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  filename_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.filename().size() > 0) {
-    filename_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.filename_);
-  }
-  hash_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.hash().size() > 0) {
-    hash_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.hash_);
-  }
-  owner_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.owner().size() > 0) {
-    owner_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.owner_);
-  }
-  ownerusername_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.ownerusername().size() > 0) {
-    ownerusername_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.ownerusername_);
-  }
-  ::memcpy(&size_, &from.size_,
-    static_cast<size_t>(reinterpret_cast<char*>(&creationdate_) -
-    reinterpret_cast<char*>(&size_)) + sizeof(creationdate_));
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  File* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.filename_){}
+    , decltype(_impl_.hash_){}
+    , decltype(_impl_.owner_){}
+    , decltype(_impl_.ownerusername_){}
+    , decltype(_impl_.size_){}
+    , decltype(_impl_.filetype_){}
+    , decltype(_impl_.isshared_){}
+    , decltype(_impl_.creationdate_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.filename_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.filename_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_filename().empty()) {
+    _this->_impl_.filename_.Set(from._internal_filename(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.hash_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.hash_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_hash().empty()) {
+    _this->_impl_.hash_.Set(from._internal_hash(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.owner_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.owner_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_owner().empty()) {
+    _this->_impl_.owner_.Set(from._internal_owner(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.ownerusername_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.ownerusername_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_ownerusername().empty()) {
+    _this->_impl_.ownerusername_.Set(from._internal_ownerusername(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.size_, &from._impl_.size_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.creationdate_) -
+    reinterpret_cast<char*>(&_impl_.size_)) + sizeof(_impl_.creationdate_));
   // @@protoc_insertion_point(copy_constructor:StorageCloud.File)
 }
 
-void File::SharedCtor() {
-  filename_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  hash_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  owner_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  ownerusername_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  ::memset(&size_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&creationdate_) -
-      reinterpret_cast<char*>(&size_)) + sizeof(creationdate_));
-  _cached_size_ = 0;
+inline void File::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.filename_){}
+    , decltype(_impl_.hash_){}
+    , decltype(_impl_.owner_){}
+    , decltype(_impl_.ownerusername_){}
+    , decltype(_impl_.size_){uint64_t{0u}}
+    , decltype(_impl_.filetype_){0}
+    , decltype(_impl_.isshared_){false}
+    , decltype(_impl_.creationdate_){uint64_t{0u}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.filename_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.filename_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.hash_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.hash_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.owner_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.owner_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.ownerusername_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.ownerusername_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 File::~File() {
   // @@protoc_insertion_point(destructor:StorageCloud.File)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void File::SharedDtor() {
-  filename_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  hash_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  owner_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  ownerusername_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline void File::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.filename_.Destroy();
+  _impl_.hash_.Destroy();
+  _impl_.owner_.Destroy();
+  _impl_.ownerusername_.Destroy();
 }
 
 void File::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* File::descriptor() {
-  ::protobuf_messages_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_messages_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
-}
-
-const File& File::default_instance() {
-  ::protobuf_messages_2eproto::InitDefaultsFile();
-  return *internal_default_instance();
-}
-
-File* File::New(::google::protobuf::Arena* arena) const {
-  File* n = new File;
-  if (arena != NULL) {
-    arena->Own(n);
-  }
-  return n;
+  _impl_._cached_size_.Set(size);
 }
 
 void File::Clear() {
 // @@protoc_insertion_point(message_clear_start:StorageCloud.File)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  filename_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  hash_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  owner_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  ownerusername_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  ::memset(&size_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&creationdate_) -
-      reinterpret_cast<char*>(&size_)) + sizeof(creationdate_));
-  _internal_metadata_.Clear();
-}
-
-bool File::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:StorageCloud.File)
-  for (;;) {
-    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+  _impl_.filename_.ClearToEmpty();
+  _impl_.hash_.ClearToEmpty();
+  _impl_.owner_.ClearToEmpty();
+  _impl_.ownerusername_.ClearToEmpty();
+  ::memset(&_impl_.size_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.creationdate_) -
+      reinterpret_cast<char*>(&_impl_.size_)) + sizeof(_impl_.creationdate_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* File::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // string filename = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(10u /* 10 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_filename()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->filename().data(), static_cast<int>(this->filename().length()),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "StorageCloud.File.filename"));
-        } else {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_filename();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "StorageCloud.File.filename"));
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // .StorageCloud.FileType filetype = 2;
-      case 2: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(16u /* 16 & 0xFF */)) {
-          int value;
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   int, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>(
-                 input, &value)));
-          set_filetype(static_cast< ::StorageCloud::FileType >(value));
-        } else {
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_filetype(static_cast<::StorageCloud::FileType>(val));
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // uint64 size = 3;
-      case 3: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(24u /* 24 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
-                 input, &size_)));
-        } else {
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // bytes hash = 4;
-      case 4: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(34u /* 34 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadBytes(
-                input, this->mutable_hash()));
-        } else {
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_hash();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // string owner = 5;
-      case 5: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(42u /* 42 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_owner()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->owner().data(), static_cast<int>(this->owner().length()),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "StorageCloud.File.owner"));
-        } else {
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          auto str = _internal_mutable_owner();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "StorageCloud.File.owner"));
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // string ownerUsername = 6;
-      case 6: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(50u /* 50 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_ownerusername()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->ownerusername().data(), static_cast<int>(this->ownerusername().length()),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "StorageCloud.File.ownerUsername"));
-        } else {
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          auto str = _internal_mutable_ownerusername();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "StorageCloud.File.ownerUsername"));
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // uint64 creationDate = 7;
-      case 7: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(56u /* 56 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
-                 input, &creationdate_)));
-        } else {
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _impl_.creationdate_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // bool isShared = 8;
-      case 8: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(64u /* 64 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
-                 input, &isshared_)));
-        } else {
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _impl_.isshared_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, _internal_metadata_.mutable_unknown_fields()));
-        break;
-      }
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:StorageCloud.File)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:StorageCloud.File)
-  return false;
-#undef DO_
-}
-
-void File::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:StorageCloud.File)
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  // string filename = 1;
-  if (this->filename().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->filename().data(), static_cast<int>(this->filename().length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "StorageCloud.File.filename");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      1, this->filename(), output);
-  }
-
-  // .StorageCloud.FileType filetype = 2;
-  if (this->filetype() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteEnum(
-      2, this->filetype(), output);
-  }
-
-  // uint64 size = 3;
-  if (this->size() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt64(3, this->size(), output);
-  }
-
-  // bytes hash = 4;
-  if (this->hash().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteBytesMaybeAliased(
-      4, this->hash(), output);
-  }
-
-  // string owner = 5;
-  if (this->owner().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->owner().data(), static_cast<int>(this->owner().length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "StorageCloud.File.owner");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      5, this->owner(), output);
-  }
-
-  // string ownerUsername = 6;
-  if (this->ownerusername().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->ownerusername().data(), static_cast<int>(this->ownerusername().length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "StorageCloud.File.ownerUsername");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      6, this->ownerusername(), output);
-  }
-
-  // uint64 creationDate = 7;
-  if (this->creationdate() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt64(7, this->creationdate(), output);
-  }
-
-  // bool isShared = 8;
-  if (this->isshared() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteBool(8, this->isshared(), output);
-  }
-
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
-  }
-  // @@protoc_insertion_point(serialize_end:StorageCloud.File)
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-::google::protobuf::uint8* File::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
-  (void)deterministic; // Unused
+uint8_t* File::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:StorageCloud.File)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // string filename = 1;
-  if (this->filename().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->filename().data(), static_cast<int>(this->filename().length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+  if (!this->_internal_filename().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_filename().data(), static_cast<int>(this->_internal_filename().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
       "StorageCloud.File.filename");
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        1, this->filename(), target);
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_filename(), target);
   }
 
   // .StorageCloud.FileType filetype = 2;
-  if (this->filetype() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteEnumToArray(
-      2, this->filetype(), target);
+  if (this->_internal_filetype() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      2, this->_internal_filetype(), target);
   }
 
   // uint64 size = 3;
-  if (this->size() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(3, this->size(), target);
+  if (this->_internal_size() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(3, this->_internal_size(), target);
   }
 
   // bytes hash = 4;
-  if (this->hash().size() > 0) {
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteBytesToArray(
-        4, this->hash(), target);
+  if (!this->_internal_hash().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        4, this->_internal_hash(), target);
   }
 
   // string owner = 5;
-  if (this->owner().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->owner().data(), static_cast<int>(this->owner().length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+  if (!this->_internal_owner().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_owner().data(), static_cast<int>(this->_internal_owner().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
       "StorageCloud.File.owner");
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        5, this->owner(), target);
+    target = stream->WriteStringMaybeAliased(
+        5, this->_internal_owner(), target);
   }
 
   // string ownerUsername = 6;
-  if (this->ownerusername().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->ownerusername().data(), static_cast<int>(this->ownerusername().length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+  if (!this->_internal_ownerusername().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_ownerusername().data(), static_cast<int>(this->_internal_ownerusername().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
       "StorageCloud.File.ownerUsername");
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        6, this->ownerusername(), target);
+    target = stream->WriteStringMaybeAliased(
+        6, this->_internal_ownerusername(), target);
   }
 
   // uint64 creationDate = 7;
-  if (this->creationdate() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(7, this->creationdate(), target);
+  if (this->_internal_creationdate() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(7, this->_internal_creationdate(), target);
   }
 
   // bool isShared = 8;
-  if (this->isshared() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(8, this->isshared(), target);
+  if (this->_internal_isshared() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(8, this->_internal_isshared(), target);
   }
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:StorageCloud.File)
   return target;
@@ -2181,128 +1817,102 @@ size_t File::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:StorageCloud.File)
   size_t total_size = 0;
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
-  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
   // string filename = 1;
-  if (this->filename().size() > 0) {
+  if (!this->_internal_filename().empty()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->filename());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_filename());
   }
 
   // bytes hash = 4;
-  if (this->hash().size() > 0) {
+  if (!this->_internal_hash().empty()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::BytesSize(
-        this->hash());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_hash());
   }
 
   // string owner = 5;
-  if (this->owner().size() > 0) {
+  if (!this->_internal_owner().empty()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->owner());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_owner());
   }
 
   // string ownerUsername = 6;
-  if (this->ownerusername().size() > 0) {
+  if (!this->_internal_ownerusername().empty()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->ownerusername());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_ownerusername());
   }
 
   // uint64 size = 3;
-  if (this->size() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::UInt64Size(
-        this->size());
+  if (this->_internal_size() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_size());
   }
 
   // .StorageCloud.FileType filetype = 2;
-  if (this->filetype() != 0) {
+  if (this->_internal_filetype() != 0) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::EnumSize(this->filetype());
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_filetype());
   }
 
   // bool isShared = 8;
-  if (this->isshared() != 0) {
+  if (this->_internal_isshared() != 0) {
     total_size += 1 + 1;
   }
 
   // uint64 creationDate = 7;
-  if (this->creationdate() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::UInt64Size(
-        this->creationdate());
+  if (this->_internal_creationdate() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_creationdate());
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = cached_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void File::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:StorageCloud.File)
-  GOOGLE_DCHECK_NE(&from, this);
-  const File* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const File>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:StorageCloud.File)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:StorageCloud.File)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData File::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    File::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*File::GetClassData() const { return &_class_data_; }
 
-void File::MergeFrom(const File& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:StorageCloud.File)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
 
-  if (from.filename().size() > 0) {
+void File::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<File*>(&to_msg);
+  auto& from = static_cast<const File&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:StorageCloud.File)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-    filename_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.filename_);
+  if (!from._internal_filename().empty()) {
+    _this->_internal_set_filename(from._internal_filename());
   }
-  if (from.hash().size() > 0) {
-
-    hash_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.hash_);
+  if (!from._internal_hash().empty()) {
+    _this->_internal_set_hash(from._internal_hash());
   }
-  if (from.owner().size() > 0) {
-
-    owner_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.owner_);
+  if (!from._internal_owner().empty()) {
+    _this->_internal_set_owner(from._internal_owner());
   }
-  if (from.ownerusername().size() > 0) {
-
-    ownerusername_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.ownerusername_);
+  if (!from._internal_ownerusername().empty()) {
+    _this->_internal_set_ownerusername(from._internal_ownerusername());
   }
-  if (from.size() != 0) {
-    set_size(from.size());
+  if (from._internal_size() != 0) {
+    _this->_internal_set_size(from._internal_size());
   }
-  if (from.filetype() != 0) {
-    set_filetype(from.filetype());
+  if (from._internal_filetype() != 0) {
+    _this->_internal_set_filetype(from._internal_filetype());
   }
-  if (from.isshared() != 0) {
-    set_isshared(from.isshared());
+  if (from._internal_isshared() != 0) {
+    _this->_internal_set_isshared(from._internal_isshared());
   }
-  if (from.creationdate() != 0) {
-    set_creationdate(from.creationdate());
+  if (from._internal_creationdate() != 0) {
+    _this->_internal_set_creationdate(from._internal_creationdate());
   }
-}
-
-void File::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:StorageCloud.File)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void File::CopyFrom(const File& from) {
@@ -2316,181 +1926,241 @@ bool File::IsInitialized() const {
   return true;
 }
 
-void File::Swap(File* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void File::InternalSwap(File* other) {
   using std::swap;
-  filename_.Swap(&other->filename_);
-  hash_.Swap(&other->hash_);
-  owner_.Swap(&other->owner_);
-  ownerusername_.Swap(&other->ownerusername_);
-  swap(size_, other->size_);
-  swap(filetype_, other->filetype_);
-  swap(isshared_, other->isshared_);
-  swap(creationdate_, other->creationdate_);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  swap(_cached_size_, other->_cached_size_);
-}
-
-::google::protobuf::Metadata File::GetMetadata() const {
-  protobuf_messages_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_messages_2eproto::file_level_metadata[kIndexInFileMessages];
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.filename_, lhs_arena,
+      &other->_impl_.filename_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.hash_, lhs_arena,
+      &other->_impl_.hash_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.owner_, lhs_arena,
+      &other->_impl_.owner_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.ownerusername_, lhs_arena,
+      &other->_impl_.ownerusername_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(File, _impl_.creationdate_)
+      + sizeof(File::_impl_.creationdate_)
+      - PROTOBUF_FIELD_OFFSET(File, _impl_.size_)>(
+          reinterpret_cast<char*>(&_impl_.size_),
+          reinterpret_cast<char*>(&other->_impl_.size_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata File::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_messages_2eproto_getter, &descriptor_table_messages_2eproto_once,
+      file_level_metadata_messages_2eproto[3]);
 }
 
-
 // ===================================================================
 
-void Handshake::InitAsDefaultInstance() {
-}
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int Handshake::kEncryptionAlgorithmFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+class Handshake::_Internal {
+ public:
+};
 
-Handshake::Handshake()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
-    ::protobuf_messages_2eproto::InitDefaultsHandshake();
-  }
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:StorageCloud.Handshake)
+Handshake::Handshake(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:StorageCloud.Handshake)
 }
 Handshake::Handshake(const Handshake& from)
-  : ::google::protobuf::Message(),
-      _internal_metadata_(NULL),
-      _cached_size_(0) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  encryptionalgorithm_ = from.encryptionalgorithm_;
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Handshake* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.publickey_){}
+    , decltype(_impl_.encryptionalgorithm_){}
+    , decltype(_impl_.rawdataframes_){}
+    , decltype(_impl_.protocolversion_){}
+    , decltype(_impl_.hashalgorithm_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.publickey_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.publickey_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_publickey().empty()) {
+    _this->_impl_.publickey_.Set(from._internal_publickey(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.encryptionalgorithm_, &from._impl_.encryptionalgorithm_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.hashalgorithm_) -
+    reinterpret_cast<char*>(&_impl_.encryptionalgorithm_)) + sizeof(_impl_.hashalgorithm_));
   // @@protoc_insertion_point(copy_constructor:StorageCloud.Handshake)
 }
 
-void Handshake::SharedCtor() {
-  encryptionalgorithm_ = 0;
-  _cached_size_ = 0;
+inline void Handshake::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.publickey_){}
+    , decltype(_impl_.encryptionalgorithm_){0}
+    , decltype(_impl_.rawdataframes_){false}
+    , decltype(_impl_.protocolversion_){0u}
+    , decltype(_impl_.hashalgorithm_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.publickey_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.publickey_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 Handshake::~Handshake() {
   // @@protoc_insertion_point(destructor:StorageCloud.Handshake)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void Handshake::SharedDtor() {
+inline void Handshake::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.publickey_.Destroy();
 }
 
 void Handshake::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* Handshake::descriptor() {
-  ::protobuf_messages_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_messages_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
-}
-
-const Handshake& Handshake::default_instance() {
-  ::protobuf_messages_2eproto::InitDefaultsHandshake();
-  return *internal_default_instance();
-}
-
-Handshake* Handshake::New(::google::protobuf::Arena* arena) const {
-  Handshake* n = new Handshake;
-  if (arena != NULL) {
-    arena->Own(n);
-  }
-  return n;
+  _impl_._cached_size_.Set(size);
 }
 
 void Handshake::Clear() {
 // @@protoc_insertion_point(message_clear_start:StorageCloud.Handshake)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  encryptionalgorithm_ = 0;
-  _internal_metadata_.Clear();
+  _impl_.publickey_.ClearToEmpty();
+  ::memset(&_impl_.encryptionalgorithm_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.hashalgorithm_) -
+      reinterpret_cast<char*>(&_impl_.encryptionalgorithm_)) + sizeof(_impl_.hashalgorithm_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-bool Handshake::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:StorageCloud.Handshake)
-  for (;;) {
-    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+const char* Handshake::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // .StorageCloud.EncryptionAlgorithm encryptionAlgorithm = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(8u /* 8 & 0xFF */)) {
-          int value;
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   int, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>(
-                 input, &value)));
-          set_encryptionalgorithm(static_cast< ::StorageCloud::EncryptionAlgorithm >(value));
-        } else {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_encryptionalgorithm(static_cast<::StorageCloud::EncryptionAlgorithm>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // bool rawDataFrames = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.rawdataframes_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 protocolVersion = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.protocolversion_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .StorageCloud.HashAlgorithm hashAlgorithm = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_hashalgorithm(static_cast<::StorageCloud::HashAlgorithm>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes publicKey = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          auto str = _internal_mutable_publickey();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, _internal_metadata_.mutable_unknown_fields()));
-        break;
-      }
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:StorageCloud.Handshake)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:StorageCloud.Handshake)
-  return false;
-#undef DO_
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-void Handshake::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:StorageCloud.Handshake)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+uint8_t* Handshake::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:StorageCloud.Handshake)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // .StorageCloud.EncryptionAlgorithm encryptionAlgorithm = 1;
-  if (this->encryptionalgorithm() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteEnum(
-      1, this->encryptionalgorithm(), output);
+  if (this->_internal_encryptionalgorithm() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      1, this->_internal_encryptionalgorithm(), target);
   }
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
+  // bool rawDataFrames = 2;
+  if (this->_internal_rawdataframes() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(2, this->_internal_rawdataframes(), target);
   }
-  // @@protoc_insertion_point(serialize_end:StorageCloud.Handshake)
-}
 
-::google::protobuf::uint8* Handshake::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
-  (void)deterministic; // Unused
-  // @@protoc_insertion_point(serialize_to_array_start:StorageCloud.Handshake)
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
+  // uint32 protocolVersion = 3;
+  if (this->_internal_protocolversion() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_protocolversion(), target);
+  }
 
-  // .StorageCloud.EncryptionAlgorithm encryptionAlgorithm = 1;
-  if (this->encryptionalgorithm() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteEnumToArray(
-      1, this->encryptionalgorithm(), target);
+  // .StorageCloud.HashAlgorithm hashAlgorithm = 4;
+  if (this->_internal_hashalgorithm() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      4, this->_internal_hashalgorithm(), target);
+  }
+
+  // bytes publicKey = 5;
+  if (!this->_internal_publickey().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        5, this->_internal_publickey(), target);
   }
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:StorageCloud.Handshake)
   return target;
@@ -2500,56 +2170,73 @@ size_t Handshake::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:StorageCloud.Handshake)
   size_t total_size = 0;
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // bytes publicKey = 5;
+  if (!this->_internal_publickey().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_publickey());
   }
+
   // .StorageCloud.EncryptionAlgorithm encryptionAlgorithm = 1;
-  if (this->encryptionalgorithm() != 0) {
+  if (this->_internal_encryptionalgorithm() != 0) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::EnumSize(this->encryptionalgorithm());
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_encryptionalgorithm());
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = cached_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
-}
+  // bool rawDataFrames = 2;
+  if (this->_internal_rawdataframes() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // uint32 protocolVersion = 3;
+  if (this->_internal_protocolversion() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_protocolversion());
+  }
 
-void Handshake::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:StorageCloud.Handshake)
-  GOOGLE_DCHECK_NE(&from, this);
-  const Handshake* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const Handshake>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:StorageCloud.Handshake)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:StorageCloud.Handshake)
-    MergeFrom(*source);
+  // .StorageCloud.HashAlgorithm hashAlgorithm = 4;
+  if (this->_internal_hashalgorithm() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_hashalgorithm());
   }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void Handshake::MergeFrom(const Handshake& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:StorageCloud.Handshake)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Handshake::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Handshake::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Handshake::GetClassData() const { return &_class_data_; }
+
+
+void Handshake::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Handshake*>(&to_msg);
+  auto& from = static_cast<const Handshake&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:StorageCloud.Handshake)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.encryptionalgorithm() != 0) {
-    set_encryptionalgorithm(from.encryptionalgorithm());
+  if (!from._internal_publickey().empty()) {
+    _this->_internal_set_publickey(from._internal_publickey());
   }
-}
-
-void Handshake::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:StorageCloud.Handshake)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  if (from._internal_encryptionalgorithm() != 0) {
+    _this->_internal_set_encryptionalgorithm(from._internal_encryptionalgorithm());
+  }
+  if (from._internal_rawdataframes() != 0) {
+    _this->_internal_set_rawdataframes(from._internal_rawdataframes());
+  }
+  if (from._internal_protocolversion() != 0) {
+    _this->_internal_set_protocolversion(from._internal_protocolversion());
+  }
+  if (from._internal_hashalgorithm() != 0) {
+    _this->_internal_set_hashalgorithm(from._internal_hashalgorithm());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void Handshake::CopyFrom(const Handshake& from) {
@@ -2563,823 +2250,1100 @@ bool Handshake::IsInitialized() const {
   return true;
 }
 
-void Handshake::Swap(Handshake* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void Handshake::InternalSwap(Handshake* other) {
   using std::swap;
-  swap(encryptionalgorithm_, other->encryptionalgorithm_);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  swap(_cached_size_, other->_cached_size_);
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.publickey_, lhs_arena,
+      &other->_impl_.publickey_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Handshake, _impl_.hashalgorithm_)
+      + sizeof(Handshake::_impl_.hashalgorithm_)
+      - PROTOBUF_FIELD_OFFSET(Handshake, _impl_.encryptionalgorithm_)>(
+          reinterpret_cast<char*>(&_impl_.encryptionalgorithm_),
+          reinterpret_cast<char*>(&other->_impl_.encryptionalgorithm_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Handshake::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_messages_2eproto_getter, &descriptor_table_messages_2eproto_once,
+      file_level_metadata_messages_2eproto[4]);
 }
 
-::google::protobuf::Metadata Handshake::GetMetadata() const {
-  protobuf_messages_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_messages_2eproto::file_level_metadata[kIndexInFileMessages];
-}
-
-
 // ===================================================================
 
-void UserDetails::InitAsDefaultInstance() {
-}
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int UserDetails::kUsernameFieldNumber;
-const int UserDetails::kFirstNameFieldNumber;
-const int UserDetails::kLastNameFieldNumber;
-const int UserDetails::kRoleFieldNumber;
-const int UserDetails::kTotalSpaceFieldNumber;
-const int UserDetails::kUsedSpaceFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+class UserDetails::_Internal {
+ public:
+};
 
-UserDetails::UserDetails()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
-    ::protobuf_messages_2eproto::InitDefaultsUserDetails();
-  }
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:StorageCloud.UserDetails)
+UserDetails::UserDetails(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:StorageCloud.UserDetails)
 }
 UserDetails::UserDetails(const UserDetails& from)
-  : ::google::protobuf::Message(),
-      _internal_metadata_(NULL),
-      _cached_size_(0) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  username_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.username().size() > 0) {
-    username_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.username_);
-  }
-  firstname_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.firstname().size() > 0) {
-    firstname_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.firstname_);
-  }
-  lastname_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.lastname().size() > 0) {
-    lastname_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.lastname_);
-  }
-  ::memcpy(&totalspace_, &from.totalspace_,
-    static_cast<size_t>(reinterpret_cast<char*>(&role_) -
-    reinterpret_cast<char*>(&totalspace_)) + sizeof(role_));
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  UserDetails* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.username_){}
+    , decltype(_impl_.firstname_){}
+    , decltype(_impl_.lastname_){}
+    , decltype(_impl_.totalspace_){}
+    , decltype(_impl_.usedspace_){}
+    , decltype(_impl_.role_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.username_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.username_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_username().empty()) {
+    _this->_impl_.username_.Set(from._internal_username(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.firstname_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.firstname_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_firstname().empty()) {
+    _this->_impl_.firstname_.Set(from._internal_firstname(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.lastname_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.lastname_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_lastname().empty()) {
+    _this->_impl_.lastname_.Set(from._internal_lastname(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.totalspace_, &from._impl_.totalspace_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.role_) -
+    reinterpret_cast<char*>(&_impl_.totalspace_)) + sizeof(_impl_.role_));
   // @@protoc_insertion_point(copy_constructor:StorageCloud.UserDetails)
 }
 
-void UserDetails::SharedCtor() {
-  username_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  firstname_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  lastname_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  ::memset(&totalspace_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&role_) -
-      reinterpret_cast<char*>(&totalspace_)) + sizeof(role_));
-  _cached_size_ = 0;
+inline void UserDetails::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.username_){}
+    , decltype(_impl_.firstname_){}
+    , decltype(_impl_.lastname_){}
+    , decltype(_impl_.totalspace_){uint64_t{0u}}
+    , decltype(_impl_.usedspace_){uint64_t{0u}}
+    , decltype(_impl_.role_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.username_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.username_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.firstname_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.firstname_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.lastname_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.lastname_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 UserDetails::~UserDetails() {
   // @@protoc_insertion_point(destructor:StorageCloud.UserDetails)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void UserDetails::SharedDtor() {
-  username_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  firstname_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  lastname_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline void UserDetails::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.username_.Destroy();
+  _impl_.firstname_.Destroy();
+  _impl_.lastname_.Destroy();
 }
 
 void UserDetails::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* UserDetails::descriptor() {
-  ::protobuf_messages_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_messages_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
-}
-
-const UserDetails& UserDetails::default_instance() {
-  ::protobuf_messages_2eproto::InitDefaultsUserDetails();
-  return *internal_default_instance();
-}
-
-UserDetails* UserDetails::New(::google::protobuf::Arena* arena) const {
-  UserDetails* n = new UserDetails;
-  if (arena != NULL) {
-    arena->Own(n);
-  }
-  return n;
+  _impl_._cached_size_.Set(size);
 }
 
 void UserDetails::Clear() {
 // @@protoc_insertion_point(message_clear_start:StorageCloud.UserDetails)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  username_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  firstname_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  lastname_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  ::memset(&totalspace_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&role_) -
-      reinterpret_cast<char*>(&totalspace_)) + sizeof(role_));
-  _internal_metadata_.Clear();
-}
-
-bool UserDetails::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:StorageCloud.UserDetails)
-  for (;;) {
-    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+  _impl_.username_.ClearToEmpty();
+  _impl_.firstname_.ClearToEmpty();
+  _impl_.lastname_.ClearToEmpty();
+  ::memset(&_impl_.totalspace_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.role_) -
+      reinterpret_cast<char*>(&_impl_.totalspace_)) + sizeof(_impl_.role_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* UserDetails::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // string username = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(10u /* 10 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_username()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->username().data(), static_cast<int>(this->username().length()),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "StorageCloud.UserDetails.username"));
-        } else {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_username();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "StorageCloud.UserDetails.username"));
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // string firstName = 2;
-      case 2: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(18u /* 18 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_firstname()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->firstname().data(), static_cast<int>(this->firstname().length()),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "StorageCloud.UserDetails.firstName"));
-        } else {
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_firstname();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "StorageCloud.UserDetails.firstName"));
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // string lastName = 3;
-      case 3: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(26u /* 26 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_lastname()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->lastname().data(), static_cast<int>(this->lastname().length()),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "StorageCloud.UserDetails.lastName"));
-        } else {
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_lastname();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "StorageCloud.UserDetails.lastName"));
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // .StorageCloud.UserRole role = 4;
-      case 4: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(32u /* 32 & 0xFF */)) {
-          int value;
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   int, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>(
-                 input, &value)));
-          set_role(static_cast< ::StorageCloud::UserRole >(value));
-        } else {
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_role(static_cast<::StorageCloud::UserRole>(val));
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // uint64 totalSpace = 5;
-      case 5: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(40u /* 40 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
-                 input, &totalspace_)));
-        } else {
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.totalspace_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // uint64 usedSpace = 6;
-      case 6: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(48u /* 48 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
-                 input, &usedspace_)));
-        } else {
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.usedspace_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, _internal_metadata_.mutable_unknown_fields()));
-        break;
-      }
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:StorageCloud.UserDetails)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:StorageCloud.UserDetails)
-  return false;
-#undef DO_
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-void UserDetails::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:StorageCloud.UserDetails)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+uint8_t* UserDetails::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:StorageCloud.UserDetails)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // string username = 1;
-  if (this->username().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->username().data(), static_cast<int>(this->username().length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+  if (!this->_internal_username().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_username().data(), static_cast<int>(this->_internal_username().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
       "StorageCloud.UserDetails.username");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      1, this->username(), output);
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_username(), target);
   }
 
   // string firstName = 2;
-  if (this->firstname().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->firstname().data(), static_cast<int>(this->firstname().length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+  if (!this->_internal_firstname().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_firstname().data(), static_cast<int>(this->_internal_firstname().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
       "StorageCloud.UserDetails.firstName");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      2, this->firstname(), output);
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_firstname(), target);
   }
 
   // string lastName = 3;
-  if (this->lastname().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->lastname().data(), static_cast<int>(this->lastname().length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+  if (!this->_internal_lastname().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_lastname().data(), static_cast<int>(this->_internal_lastname().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
       "StorageCloud.UserDetails.lastName");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      3, this->lastname(), output);
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_lastname(), target);
   }
 
   // .StorageCloud.UserRole role = 4;
-  if (this->role() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteEnum(
-      4, this->role(), output);
+  if (this->_internal_role() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      4, this->_internal_role(), target);
   }
 
   // uint64 totalSpace = 5;
-  if (this->totalspace() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt64(5, this->totalspace(), output);
+  if (this->_internal_totalspace() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(5, this->_internal_totalspace(), target);
   }
 
   // uint64 usedSpace = 6;
-  if (this->usedspace() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt64(6, this->usedspace(), output);
+  if (this->_internal_usedspace() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(6, this->_internal_usedspace(), target);
   }
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_end:StorageCloud.UserDetails)
+  // @@protoc_insertion_point(serialize_to_array_end:StorageCloud.UserDetails)
+  return target;
 }
 
-::google::protobuf::uint8* UserDetails::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
-  (void)deterministic; // Unused
-  // @@protoc_insertion_point(serialize_to_array_start:StorageCloud.UserDetails)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+size_t UserDetails::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:StorageCloud.UserDetails)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   // string username = 1;
-  if (this->username().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->username().data(), static_cast<int>(this->username().length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "StorageCloud.UserDetails.username");
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        1, this->username(), target);
+  if (!this->_internal_username().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_username());
   }
 
   // string firstName = 2;
-  if (this->firstname().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->firstname().data(), static_cast<int>(this->firstname().length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "StorageCloud.UserDetails.firstName");
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        2, this->firstname(), target);
+  if (!this->_internal_firstname().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_firstname());
   }
 
   // string lastName = 3;
-  if (this->lastname().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->lastname().data(), static_cast<int>(this->lastname().length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "StorageCloud.UserDetails.lastName");
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        3, this->lastname(), target);
-  }
-
-  // .StorageCloud.UserRole role = 4;
-  if (this->role() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteEnumToArray(
-      4, this->role(), target);
+  if (!this->_internal_lastname().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_lastname());
   }
 
   // uint64 totalSpace = 5;
-  if (this->totalspace() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(5, this->totalspace(), target);
+  if (this->_internal_totalspace() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_totalspace());
   }
 
   // uint64 usedSpace = 6;
-  if (this->usedspace() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(6, this->usedspace(), target);
+  if (this->_internal_usedspace() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_usedspace());
   }
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
+  // .StorageCloud.UserRole role = 4;
+  if (this->_internal_role() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_role());
   }
-  // @@protoc_insertion_point(serialize_to_array_end:StorageCloud.UserDetails)
-  return target;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-size_t UserDetails::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:StorageCloud.UserDetails)
-  size_t total_size = 0;
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData UserDetails::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    UserDetails::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*UserDetails::GetClassData() const { return &_class_data_; }
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
+
+void UserDetails::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<UserDetails*>(&to_msg);
+  auto& from = static_cast<const UserDetails&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:StorageCloud.UserDetails)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_username().empty()) {
+    _this->_internal_set_username(from._internal_username());
   }
-  // string username = 1;
-  if (this->username().size() > 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->username());
+  if (!from._internal_firstname().empty()) {
+    _this->_internal_set_firstname(from._internal_firstname());
+  }
+  if (!from._internal_lastname().empty()) {
+    _this->_internal_set_lastname(from._internal_lastname());
+  }
+  if (from._internal_totalspace() != 0) {
+    _this->_internal_set_totalspace(from._internal_totalspace());
   }
+  if (from._internal_usedspace() != 0) {
+    _this->_internal_set_usedspace(from._internal_usedspace());
+  }
+  if (from._internal_role() != 0) {
+    _this->_internal_set_role(from._internal_role());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
 
-  // string firstName = 2;
-  if (this->firstname().size() > 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->firstname());
+void UserDetails::CopyFrom(const UserDetails& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:StorageCloud.UserDetails)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool UserDetails::IsInitialized() const {
+  return true;
+}
+
+void UserDetails::InternalSwap(UserDetails* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.username_, lhs_arena,
+      &other->_impl_.username_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.firstname_, lhs_arena,
+      &other->_impl_.firstname_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.lastname_, lhs_arena,
+      &other->_impl_.lastname_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(UserDetails, _impl_.role_)
+      + sizeof(UserDetails::_impl_.role_)
+      - PROTOBUF_FIELD_OFFSET(UserDetails, _impl_.totalspace_)>(
+          reinterpret_cast<char*>(&_impl_.totalspace_),
+          reinterpret_cast<char*>(&other->_impl_.totalspace_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata UserDetails::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_messages_2eproto_getter, &descriptor_table_messages_2eproto_once,
+      file_level_metadata_messages_2eproto[5]);
+}
+
+// ===================================================================
+
+class CommandStats::_Internal {
+ public:
+};
+
+CommandStats::CommandStats(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:StorageCloud.CommandStats)
+}
+CommandStats::CommandStats(const CommandStats& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CommandStats* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.count_){}
+    , decltype(_impl_.errors_){}
+    , decltype(_impl_.bytesin_){}
+    , decltype(_impl_.bytesout_){}
+    , decltype(_impl_.meanus_){}
+    , decltype(_impl_.p50us_){}
+    , decltype(_impl_.p90us_){}
+    , decltype(_impl_.p99us_){}
+    , decltype(_impl_.maxus_){}
+    , decltype(_impl_.type_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.count_, &from._impl_.count_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.type_) -
+    reinterpret_cast<char*>(&_impl_.count_)) + sizeof(_impl_.type_));
+  // @@protoc_insertion_point(copy_constructor:StorageCloud.CommandStats)
+}
+
+inline void CommandStats::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.count_){uint64_t{0u}}
+    , decltype(_impl_.errors_){uint64_t{0u}}
+    , decltype(_impl_.bytesin_){uint64_t{0u}}
+    , decltype(_impl_.bytesout_){uint64_t{0u}}
+    , decltype(_impl_.meanus_){uint64_t{0u}}
+    , decltype(_impl_.p50us_){uint64_t{0u}}
+    , decltype(_impl_.p90us_){uint64_t{0u}}
+    , decltype(_impl_.p99us_){uint64_t{0u}}
+    , decltype(_impl_.maxus_){uint64_t{0u}}
+    , decltype(_impl_.type_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+CommandStats::~CommandStats() {
+  // @@protoc_insertion_point(destructor:StorageCloud.CommandStats)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
   }
+  SharedDtor();
+}
 
-  // string lastName = 3;
-  if (this->lastname().size() > 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->lastname());
+inline void CommandStats::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void CommandStats::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CommandStats::Clear() {
+// @@protoc_insertion_point(message_clear_start:StorageCloud.CommandStats)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&_impl_.count_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.type_) -
+      reinterpret_cast<char*>(&_impl_.count_)) + sizeof(_impl_.type_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CommandStats::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .StorageCloud.CommandType type = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_type(static_cast<::StorageCloud::CommandType>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 count = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.count_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 errors = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.errors_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 bytesIn = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.bytesin_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 bytesOut = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.bytesout_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 meanUs = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.meanus_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 p50Us = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _impl_.p50us_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 p90Us = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _impl_.p90us_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 p99Us = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 72)) {
+          _impl_.p99us_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 maxUs = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 80)) {
+          _impl_.maxus_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CommandStats::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:StorageCloud.CommandStats)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .StorageCloud.CommandType type = 1;
+  if (this->_internal_type() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      1, this->_internal_type(), target);
   }
 
-  // uint64 totalSpace = 5;
-  if (this->totalspace() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::UInt64Size(
-        this->totalspace());
+  // uint64 count = 2;
+  if (this->_internal_count() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_count(), target);
   }
 
-  // uint64 usedSpace = 6;
-  if (this->usedspace() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::UInt64Size(
-        this->usedspace());
+  // uint64 errors = 3;
+  if (this->_internal_errors() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(3, this->_internal_errors(), target);
   }
 
-  // .StorageCloud.UserRole role = 4;
-  if (this->role() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::EnumSize(this->role());
+  // uint64 bytesIn = 4;
+  if (this->_internal_bytesin() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(4, this->_internal_bytesin(), target);
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = cached_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
-}
+  // uint64 bytesOut = 5;
+  if (this->_internal_bytesout() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(5, this->_internal_bytesout(), target);
+  }
+
+  // uint64 meanUs = 6;
+  if (this->_internal_meanus() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(6, this->_internal_meanus(), target);
+  }
+
+  // uint64 p50Us = 7;
+  if (this->_internal_p50us() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(7, this->_internal_p50us(), target);
+  }
+
+  // uint64 p90Us = 8;
+  if (this->_internal_p90us() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(8, this->_internal_p90us(), target);
+  }
+
+  // uint64 p99Us = 9;
+  if (this->_internal_p99us() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(9, this->_internal_p99us(), target);
+  }
+
+  // uint64 maxUs = 10;
+  if (this->_internal_maxus() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(10, this->_internal_maxus(), target);
+  }
 
-void UserDetails::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:StorageCloud.UserDetails)
-  GOOGLE_DCHECK_NE(&from, this);
-  const UserDetails* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const UserDetails>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:StorageCloud.UserDetails)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:StorageCloud.UserDetails)
-    MergeFrom(*source);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
+  // @@protoc_insertion_point(serialize_to_array_end:StorageCloud.CommandStats)
+  return target;
 }
 
-void UserDetails::MergeFrom(const UserDetails& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:StorageCloud.UserDetails)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
+size_t CommandStats::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:StorageCloud.CommandStats)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  if (from.username().size() > 0) {
+  // uint64 count = 2;
+  if (this->_internal_count() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_count());
+  }
+
+  // uint64 errors = 3;
+  if (this->_internal_errors() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_errors());
+  }
+
+  // uint64 bytesIn = 4;
+  if (this->_internal_bytesin() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_bytesin());
+  }
 
-    username_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.username_);
+  // uint64 bytesOut = 5;
+  if (this->_internal_bytesout() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_bytesout());
   }
-  if (from.firstname().size() > 0) {
 
-    firstname_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.firstname_);
+  // uint64 meanUs = 6;
+  if (this->_internal_meanus() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_meanus());
   }
-  if (from.lastname().size() > 0) {
 
-    lastname_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.lastname_);
+  // uint64 p50Us = 7;
+  if (this->_internal_p50us() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_p50us());
   }
-  if (from.totalspace() != 0) {
-    set_totalspace(from.totalspace());
+
+  // uint64 p90Us = 8;
+  if (this->_internal_p90us() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_p90us());
   }
-  if (from.usedspace() != 0) {
-    set_usedspace(from.usedspace());
+
+  // uint64 p99Us = 9;
+  if (this->_internal_p99us() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_p99us());
   }
-  if (from.role() != 0) {
-    set_role(from.role());
+
+  // uint64 maxUs = 10;
+  if (this->_internal_maxus() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_maxus());
   }
+
+  // .StorageCloud.CommandType type = 1;
+  if (this->_internal_type() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_type());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void UserDetails::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:StorageCloud.UserDetails)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CommandStats::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CommandStats::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CommandStats::GetClassData() const { return &_class_data_; }
+
+
+void CommandStats::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CommandStats*>(&to_msg);
+  auto& from = static_cast<const CommandStats&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:StorageCloud.CommandStats)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_count() != 0) {
+    _this->_internal_set_count(from._internal_count());
+  }
+  if (from._internal_errors() != 0) {
+    _this->_internal_set_errors(from._internal_errors());
+  }
+  if (from._internal_bytesin() != 0) {
+    _this->_internal_set_bytesin(from._internal_bytesin());
+  }
+  if (from._internal_bytesout() != 0) {
+    _this->_internal_set_bytesout(from._internal_bytesout());
+  }
+  if (from._internal_meanus() != 0) {
+    _this->_internal_set_meanus(from._internal_meanus());
+  }
+  if (from._internal_p50us() != 0) {
+    _this->_internal_set_p50us(from._internal_p50us());
+  }
+  if (from._internal_p90us() != 0) {
+    _this->_internal_set_p90us(from._internal_p90us());
+  }
+  if (from._internal_p99us() != 0) {
+    _this->_internal_set_p99us(from._internal_p99us());
+  }
+  if (from._internal_maxus() != 0) {
+    _this->_internal_set_maxus(from._internal_maxus());
+  }
+  if (from._internal_type() != 0) {
+    _this->_internal_set_type(from._internal_type());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void UserDetails::CopyFrom(const UserDetails& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:StorageCloud.UserDetails)
+void CommandStats::CopyFrom(const CommandStats& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:StorageCloud.CommandStats)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool UserDetails::IsInitialized() const {
+bool CommandStats::IsInitialized() const {
   return true;
 }
 
-void UserDetails::Swap(UserDetails* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
-void UserDetails::InternalSwap(UserDetails* other) {
+void CommandStats::InternalSwap(CommandStats* other) {
   using std::swap;
-  username_.Swap(&other->username_);
-  firstname_.Swap(&other->firstname_);
-  lastname_.Swap(&other->lastname_);
-  swap(totalspace_, other->totalspace_);
-  swap(usedspace_, other->usedspace_);
-  swap(role_, other->role_);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  swap(_cached_size_, other->_cached_size_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(CommandStats, _impl_.type_)
+      + sizeof(CommandStats::_impl_.type_)
+      - PROTOBUF_FIELD_OFFSET(CommandStats, _impl_.count_)>(
+          reinterpret_cast<char*>(&_impl_.count_),
+          reinterpret_cast<char*>(&other->_impl_.count_));
 }
 
-::google::protobuf::Metadata UserDetails::GetMetadata() const {
-  protobuf_messages_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_messages_2eproto::file_level_metadata[kIndexInFileMessages];
+::PROTOBUF_NAMESPACE_ID::Metadata CommandStats::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_messages_2eproto_getter, &descriptor_table_messages_2eproto_once,
+      file_level_metadata_messages_2eproto[6]);
 }
 
-
 // ===================================================================
 
-void ServerResponse::InitAsDefaultInstance() {
-}
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int ServerResponse::kTypeFieldNumber;
-const int ServerResponse::kParamsFieldNumber;
-const int ServerResponse::kListFieldNumber;
-const int ServerResponse::kFileListFieldNumber;
-const int ServerResponse::kUserListFieldNumber;
-const int ServerResponse::kDataFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+class ServerResponse::_Internal {
+ public:
+};
 
-ServerResponse::ServerResponse()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
-    ::protobuf_messages_2eproto::InitDefaultsServerResponse();
-  }
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:StorageCloud.ServerResponse)
+ServerResponse::ServerResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:StorageCloud.ServerResponse)
 }
 ServerResponse::ServerResponse(const ServerResponse& from)
-  : ::google::protobuf::Message(),
-      _internal_metadata_(NULL),
-      params_(from.params_),
-      list_(from.list_),
-      filelist_(from.filelist_),
-      userlist_(from.userlist_),
-      _cached_size_(0) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  data_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.data().size() > 0) {
-    data_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.data_);
-  }
-  type_ = from.type_;
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ServerResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.params_){from._impl_.params_}
+    , decltype(_impl_.list_){from._impl_.list_}
+    , decltype(_impl_.filelist_){from._impl_.filelist_}
+    , decltype(_impl_.userlist_){from._impl_.userlist_}
+    , decltype(_impl_.stats_){from._impl_.stats_}
+    , decltype(_impl_.data_){}
+    , decltype(_impl_.type_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.data_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.data_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_data().empty()) {
+    _this->_impl_.data_.Set(from._internal_data(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.type_ = from._impl_.type_;
   // @@protoc_insertion_point(copy_constructor:StorageCloud.ServerResponse)
 }
 
-void ServerResponse::SharedCtor() {
-  data_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  type_ = 0;
-  _cached_size_ = 0;
+inline void ServerResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.params_){arena}
+    , decltype(_impl_.list_){arena}
+    , decltype(_impl_.filelist_){arena}
+    , decltype(_impl_.userlist_){arena}
+    , decltype(_impl_.stats_){arena}
+    , decltype(_impl_.data_){}
+    , decltype(_impl_.type_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.data_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.data_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 ServerResponse::~ServerResponse() {
   // @@protoc_insertion_point(destructor:StorageCloud.ServerResponse)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void ServerResponse::SharedDtor() {
-  data_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline void ServerResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.params_.~RepeatedPtrField();
+  _impl_.list_.~RepeatedPtrField();
+  _impl_.filelist_.~RepeatedPtrField();
+  _impl_.userlist_.~RepeatedPtrField();
+  _impl_.stats_.~RepeatedPtrField();
+  _impl_.data_.Destroy();
 }
 
 void ServerResponse::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* ServerResponse::descriptor() {
-  ::protobuf_messages_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_messages_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
-}
-
-const ServerResponse& ServerResponse::default_instance() {
-  ::protobuf_messages_2eproto::InitDefaultsServerResponse();
-  return *internal_default_instance();
-}
-
-ServerResponse* ServerResponse::New(::google::protobuf::Arena* arena) const {
-  ServerResponse* n = new ServerResponse;
-  if (arena != NULL) {
-    arena->Own(n);
-  }
-  return n;
+  _impl_._cached_size_.Set(size);
 }
 
 void ServerResponse::Clear() {
 // @@protoc_insertion_point(message_clear_start:StorageCloud.ServerResponse)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  params_.Clear();
-  list_.Clear();
-  filelist_.Clear();
-  userlist_.Clear();
-  data_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  type_ = 0;
-  _internal_metadata_.Clear();
-}
-
-bool ServerResponse::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:StorageCloud.ServerResponse)
-  for (;;) {
-    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+  _impl_.params_.Clear();
+  _impl_.list_.Clear();
+  _impl_.filelist_.Clear();
+  _impl_.userlist_.Clear();
+  _impl_.stats_.Clear();
+  _impl_.data_.ClearToEmpty();
+  _impl_.type_ = 0;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ServerResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // .StorageCloud.ResponseType type = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(8u /* 8 & 0xFF */)) {
-          int value;
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   int, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>(
-                 input, &value)));
-          set_type(static_cast< ::StorageCloud::ResponseType >(value));
-        } else {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_type(static_cast<::StorageCloud::ResponseType>(val));
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // repeated .StorageCloud.Param params = 2;
-      case 2: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(18u /* 18 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(input, add_params()));
-        } else {
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_params(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // repeated string list = 3;
-      case 3: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(26u /* 26 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->add_list()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->list(this->list_size() - 1).data(),
-            static_cast<int>(this->list(this->list_size() - 1).length()),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "StorageCloud.ServerResponse.list"));
-        } else {
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_list();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            CHK_(::_pbi::VerifyUTF8(str, "StorageCloud.ServerResponse.list"));
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // repeated .StorageCloud.File fileList = 4;
-      case 4: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(34u /* 34 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(input, add_filelist()));
-        } else {
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_filelist(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<34>(ptr));
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // repeated .StorageCloud.UserDetails userList = 5;
-      case 5: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(42u /* 42 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(input, add_userlist()));
-        } else {
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_userlist(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<42>(ptr));
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // bytes data = 6;
-      case 6: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(50u /* 50 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadBytes(
-                input, this->mutable_data()));
-        } else {
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          auto str = _internal_mutable_data();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .StorageCloud.CommandStats stats = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_stats(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<58>(ptr));
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, _internal_metadata_.mutable_unknown_fields()));
-        break;
-      }
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:StorageCloud.ServerResponse)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:StorageCloud.ServerResponse)
-  return false;
-#undef DO_
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-void ServerResponse::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:StorageCloud.ServerResponse)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+uint8_t* ServerResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:StorageCloud.ServerResponse)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // .StorageCloud.ResponseType type = 1;
-  if (this->type() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteEnum(
-      1, this->type(), output);
+  if (this->_internal_type() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      1, this->_internal_type(), target);
   }
 
   // repeated .StorageCloud.Param params = 2;
-  for (unsigned int i = 0,
-      n = static_cast<unsigned int>(this->params_size()); i < n; i++) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      2, this->params(static_cast<int>(i)), output);
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_params_size()); i < n; i++) {
+    const auto& repfield = this->_internal_params(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
   }
 
   // repeated string list = 3;
-  for (int i = 0, n = this->list_size(); i < n; i++) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->list(i).data(), static_cast<int>(this->list(i).length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+  for (int i = 0, n = this->_internal_list_size(); i < n; i++) {
+    const auto& s = this->_internal_list(i);
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      s.data(), static_cast<int>(s.length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
       "StorageCloud.ServerResponse.list");
-    ::google::protobuf::internal::WireFormatLite::WriteString(
-      3, this->list(i), output);
+    target = stream->WriteString(3, s, target);
   }
 
   // repeated .StorageCloud.File fileList = 4;
-  for (unsigned int i = 0,
-      n = static_cast<unsigned int>(this->filelist_size()); i < n; i++) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      4, this->filelist(static_cast<int>(i)), output);
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_filelist_size()); i < n; i++) {
+    const auto& repfield = this->_internal_filelist(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(4, repfield, repfield.GetCachedSize(), target, stream);
   }
 
   // repeated .StorageCloud.UserDetails userList = 5;
-  for (unsigned int i = 0,
-      n = static_cast<unsigned int>(this->userlist_size()); i < n; i++) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      5, this->userlist(static_cast<int>(i)), output);
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_userlist_size()); i < n; i++) {
+    const auto& repfield = this->_internal_userlist(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(5, repfield, repfield.GetCachedSize(), target, stream);
   }
 
   // bytes data = 6;
-  if (this->data().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteBytesMaybeAliased(
-      6, this->data(), output);
+  if (!this->_internal_data().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        6, this->_internal_data(), target);
   }
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
-  }
-  // @@protoc_insertion_point(serialize_end:StorageCloud.ServerResponse)
-}
-
-::google::protobuf::uint8* ServerResponse::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
-  (void)deterministic; // Unused
-  // @@protoc_insertion_point(serialize_to_array_start:StorageCloud.ServerResponse)
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  // .StorageCloud.ResponseType type = 1;
-  if (this->type() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteEnumToArray(
-      1, this->type(), target);
-  }
-
-  // repeated .StorageCloud.Param params = 2;
-  for (unsigned int i = 0,
-      n = static_cast<unsigned int>(this->params_size()); i < n; i++) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      InternalWriteMessageToArray(
-        2, this->params(static_cast<int>(i)), deterministic, target);
+  // repeated .StorageCloud.CommandStats stats = 7;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_stats_size()); i < n; i++) {
+    const auto& repfield = this->_internal_stats(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(7, repfield, repfield.GetCachedSize(), target, stream);
   }
 
-  // repeated string list = 3;
-  for (int i = 0, n = this->list_size(); i < n; i++) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->list(i).data(), static_cast<int>(this->list(i).length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "StorageCloud.ServerResponse.list");
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteStringToArray(3, this->list(i), target);
-  }
-
-  // repeated .StorageCloud.File fileList = 4;
-  for (unsigned int i = 0,
-      n = static_cast<unsigned int>(this->filelist_size()); i < n; i++) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      InternalWriteMessageToArray(
-        4, this->filelist(static_cast<int>(i)), deterministic, target);
-  }
-
-  // repeated .StorageCloud.UserDetails userList = 5;
-  for (unsigned int i = 0,
-      n = static_cast<unsigned int>(this->userlist_size()); i < n; i++) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      InternalWriteMessageToArray(
-        5, this->userlist(static_cast<int>(i)), deterministic, target);
-  }
-
-  // bytes data = 6;
-  if (this->data().size() > 0) {
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteBytesToArray(
-        6, this->data(), target);
-  }
-
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:StorageCloud.ServerResponse)
   return target;
@@ -3389,112 +3353,89 @@ size_t ServerResponse::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:StorageCloud.ServerResponse)
   size_t total_size = 0;
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
-  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
   // repeated .StorageCloud.Param params = 2;
-  {
-    unsigned int count = static_cast<unsigned int>(this->params_size());
-    total_size += 1UL * count;
-    for (unsigned int i = 0; i < count; i++) {
-      total_size +=
-        ::google::protobuf::internal::WireFormatLite::MessageSize(
-          this->params(static_cast<int>(i)));
-    }
+  total_size += 1UL * this->_internal_params_size();
+  for (const auto& msg : this->_impl_.params_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
   // repeated string list = 3;
   total_size += 1 *
-      ::google::protobuf::internal::FromIntSize(this->list_size());
-  for (int i = 0, n = this->list_size(); i < n; i++) {
-    total_size += ::google::protobuf::internal::WireFormatLite::StringSize(
-      this->list(i));
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.list_.size());
+  for (int i = 0, n = _impl_.list_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      _impl_.list_.Get(i));
   }
 
   // repeated .StorageCloud.File fileList = 4;
-  {
-    unsigned int count = static_cast<unsigned int>(this->filelist_size());
-    total_size += 1UL * count;
-    for (unsigned int i = 0; i < count; i++) {
-      total_size +=
-        ::google::protobuf::internal::WireFormatLite::MessageSize(
-          this->filelist(static_cast<int>(i)));
-    }
+  total_size += 1UL * this->_internal_filelist_size();
+  for (const auto& msg : this->_impl_.filelist_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
   // repeated .StorageCloud.UserDetails userList = 5;
-  {
-    unsigned int count = static_cast<unsigned int>(this->userlist_size());
-    total_size += 1UL * count;
-    for (unsigned int i = 0; i < count; i++) {
-      total_size +=
-        ::google::protobuf::internal::WireFormatLite::MessageSize(
-          this->userlist(static_cast<int>(i)));
-    }
+  total_size += 1UL * this->_internal_userlist_size();
+  for (const auto& msg : this->_impl_.userlist_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated .StorageCloud.CommandStats stats = 7;
+  total_size += 1UL * this->_internal_stats_size();
+  for (const auto& msg : this->_impl_.stats_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
   // bytes data = 6;
-  if (this->data().size() > 0) {
+  if (!this->_internal_data().empty()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::BytesSize(
-        this->data());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_data());
   }
 
   // .StorageCloud.ResponseType type = 1;
-  if (this->type() != 0) {
+  if (this->_internal_type() != 0) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::EnumSize(this->type());
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_type());
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = cached_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void ServerResponse::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:StorageCloud.ServerResponse)
-  GOOGLE_DCHECK_NE(&from, this);
-  const ServerResponse* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const ServerResponse>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:StorageCloud.ServerResponse)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:StorageCloud.ServerResponse)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ServerResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ServerResponse::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ServerResponse::GetClassData() const { return &_class_data_; }
 
-void ServerResponse::MergeFrom(const ServerResponse& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:StorageCloud.ServerResponse)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
 
-  params_.MergeFrom(from.params_);
-  list_.MergeFrom(from.list_);
-  filelist_.MergeFrom(from.filelist_);
-  userlist_.MergeFrom(from.userlist_);
-  if (from.data().size() > 0) {
+void ServerResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ServerResponse*>(&to_msg);
+  auto& from = static_cast<const ServerResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:StorageCloud.ServerResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-    data_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.data_);
+  _this->_impl_.params_.MergeFrom(from._impl_.params_);
+  _this->_impl_.list_.MergeFrom(from._impl_.list_);
+  _this->_impl_.filelist_.MergeFrom(from._impl_.filelist_);
+  _this->_impl_.userlist_.MergeFrom(from._impl_.userlist_);
+  _this->_impl_.stats_.MergeFrom(from._impl_.stats_);
+  if (!from._internal_data().empty()) {
+    _this->_internal_set_data(from._internal_data());
   }
-  if (from.type() != 0) {
-    set_type(from.type());
+  if (from._internal_type() != 0) {
+    _this->_internal_set_type(from._internal_type());
   }
-}
-
-void ServerResponse::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:StorageCloud.ServerResponse)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void ServerResponse::CopyFrom(const ServerResponse& from) {
@@ -3508,29 +3449,65 @@ bool ServerResponse::IsInitialized() const {
   return true;
 }
 
-void ServerResponse::Swap(ServerResponse* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void ServerResponse::InternalSwap(ServerResponse* other) {
   using std::swap;
-  params_.InternalSwap(&other->params_);
-  list_.InternalSwap(&other->list_);
-  filelist_.InternalSwap(&other->filelist_);
-  userlist_.InternalSwap(&other->userlist_);
-  data_.Swap(&other->data_);
-  swap(type_, other->type_);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  swap(_cached_size_, other->_cached_size_);
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.params_.InternalSwap(&other->_impl_.params_);
+  _impl_.list_.InternalSwap(&other->_impl_.list_);
+  _impl_.filelist_.InternalSwap(&other->_impl_.filelist_);
+  _impl_.userlist_.InternalSwap(&other->_impl_.userlist_);
+  _impl_.stats_.InternalSwap(&other->_impl_.stats_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.data_, lhs_arena,
+      &other->_impl_.data_, rhs_arena
+  );
+  swap(_impl_.type_, other->_impl_.type_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ServerResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_messages_2eproto_getter, &descriptor_table_messages_2eproto_once,
+      file_level_metadata_messages_2eproto[7]);
 }
 
-::google::protobuf::Metadata ServerResponse::GetMetadata() const {
-  protobuf_messages_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_messages_2eproto::file_level_metadata[kIndexInFileMessages];
-}
-
-
 // @@protoc_insertion_point(namespace_scope)
 }  // namespace StorageCloud
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::StorageCloud::Param*
+Arena::CreateMaybeMessage< ::StorageCloud::Param >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::StorageCloud::Param >(arena);
+}
+template<> PROTOBUF_NOINLINE ::StorageCloud::EncodedMessage*
+Arena::CreateMaybeMessage< ::StorageCloud::EncodedMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::StorageCloud::EncodedMessage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::StorageCloud::Command*
+Arena::CreateMaybeMessage< ::StorageCloud::Command >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::StorageCloud::Command >(arena);
+}
+template<> PROTOBUF_NOINLINE ::StorageCloud::File*
+Arena::CreateMaybeMessage< ::StorageCloud::File >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::StorageCloud::File >(arena);
+}
+template<> PROTOBUF_NOINLINE ::StorageCloud::Handshake*
+Arena::CreateMaybeMessage< ::StorageCloud::Handshake >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::StorageCloud::Handshake >(arena);
+}
+template<> PROTOBUF_NOINLINE ::StorageCloud::UserDetails*
+Arena::CreateMaybeMessage< ::StorageCloud::UserDetails >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::StorageCloud::UserDetails >(arena);
+}
+template<> PROTOBUF_NOINLINE ::StorageCloud::CommandStats*
+Arena::CreateMaybeMessage< ::StorageCloud::CommandStats >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::StorageCloud::CommandStats >(arena);
+}
+template<> PROTOBUF_NOINLINE ::StorageCloud::ServerResponse*
+Arena::CreateMaybeMessage< ::StorageCloud::ServerResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::StorageCloud::ServerResponse >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
 
 // @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
@@ -1,146 +1,147 @@
 // Generated by the protocol buffer compiler.  DO NOT EDIT!
 // source: messages.proto
 
-#ifndef PROTOBUF_messages_2eproto__INCLUDED
-#define PROTOBUF_messages_2eproto__INCLUDED
+#ifndef GOOGLE_PROTOBUF_INCLUDED_messages_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_messages_2eproto
 
+#include <limits>
 #include <string>
 
-#include <google/protobuf/stubs/common.h>
-
-#if GOOGLE_PROTOBUF_VERSION < 3005000
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
 #error This file was generated by a newer version of protoc which is
-#error incompatible with your Protocol Buffer headers.  Please update
+#error incompatible with your Protocol Buffer headers. Please update
 #error your headers.
 #endif
-#if 3005001 < GOOGLE_PROTOBUF_MIN_PROTOC_VERSION
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
 #error This file was generated by an older version of protoc which is
-#error incompatible with your Protocol Buffer headers.  Please
+#error incompatible with your Protocol Buffer headers. Please
 #error regenerate this file with a newer version of protoc.
 #endif
 
+#include <google/protobuf/port_undef.inc>
 #include <google/protobuf/io/coded_stream.h>
 #include <google/protobuf/arena.h>
 #include <google/protobuf/arenastring.h>
-#include <google/protobuf/generated_message_table_driven.h>
 #include <google/protobuf/generated_message_util.h>
-#include <google/protobuf/metadata.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
 #include <google/protobuf/message.h>
 #include <google/protobuf/repeated_field.h>  // IWYU pragma: export
 #include <google/protobuf/extension_set.h>  // IWYU pragma: export
 #include <google/protobuf/generated_enum_reflection.h>
 #include <google/protobuf/unknown_field_set.h>
 // @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_messages_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
 
-namespace protobuf_messages_2eproto {
 // Internal implementation detail -- do not use these members.
-struct TableStruct {
-  static const ::google::protobuf::internal::ParseTableField entries[];
-  static const ::google::protobuf::internal::AuxillaryParseTableField aux[];
-  static const ::google::protobuf::internal::ParseTable schema[7];
-  static const ::google::protobuf::internal::FieldMetadata field_metadata[];
-  static const ::google::protobuf::internal::SerializationTable serialization_table[];
-  static const ::google::protobuf::uint32 offsets[];
+struct TableStruct_messages_2eproto {
+  static const uint32_t offsets[];
 };
-void AddDescriptors();
-void InitDefaultsParamImpl();
-void InitDefaultsParam();
-void InitDefaultsEncodedMessageImpl();
-void InitDefaultsEncodedMessage();
-void InitDefaultsCommandImpl();
-void InitDefaultsCommand();
-void InitDefaultsFileImpl();
-void InitDefaultsFile();
-void InitDefaultsHandshakeImpl();
-void InitDefaultsHandshake();
-void InitDefaultsUserDetailsImpl();
-void InitDefaultsUserDetails();
-void InitDefaultsServerResponseImpl();
-void InitDefaultsServerResponse();
-inline void InitDefaults() {
-  InitDefaultsParam();
-  InitDefaultsEncodedMessage();
-  InitDefaultsCommand();
-  InitDefaultsFile();
-  InitDefaultsHandshake();
-  InitDefaultsUserDetails();
-  InitDefaultsServerResponse();
-}
-}  // namespace protobuf_messages_2eproto
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_messages_2eproto;
 namespace StorageCloud {
 class Command;
-class CommandDefaultTypeInternal;
+struct CommandDefaultTypeInternal;
 extern CommandDefaultTypeInternal _Command_default_instance_;
+class CommandStats;
+struct CommandStatsDefaultTypeInternal;
+extern CommandStatsDefaultTypeInternal _CommandStats_default_instance_;
 class EncodedMessage;
-class EncodedMessageDefaultTypeInternal;
+struct EncodedMessageDefaultTypeInternal;
 extern EncodedMessageDefaultTypeInternal _EncodedMessage_default_instance_;
 class File;
-class FileDefaultTypeInternal;
+struct FileDefaultTypeInternal;
 extern FileDefaultTypeInternal _File_default_instance_;
 class Handshake;
-class HandshakeDefaultTypeInternal;
+struct HandshakeDefaultTypeInternal;
 extern HandshakeDefaultTypeInternal _Handshake_default_instance_;
 class Param;
-class ParamDefaultTypeInternal;
+struct ParamDefaultTypeInternal;
 extern ParamDefaultTypeInternal _Param_default_instance_;
 class ServerResponse;
-class ServerResponseDefaultTypeInternal;
+struct ServerResponseDefaultTypeInternal;
 extern ServerResponseDefaultTypeInternal _ServerResponse_default_instance_;
 class UserDetails;
-class UserDetailsDefaultTypeInternal;
+struct UserDetailsDefaultTypeInternal;
 extern UserDetailsDefaultTypeInternal _UserDetails_default_instance_;
 }  // namespace StorageCloud
+PROTOBUF_NAMESPACE_OPEN
+template<> ::StorageCloud::Command* Arena::CreateMaybeMessage<::StorageCloud::Command>(Arena*);
+template<> ::StorageCloud::CommandStats* Arena::CreateMaybeMessage<::StorageCloud::CommandStats>(Arena*);
+template<> ::StorageCloud::EncodedMessage* Arena::CreateMaybeMessage<::StorageCloud::EncodedMessage>(Arena*);
+template<> ::StorageCloud::File* Arena::CreateMaybeMessage<::StorageCloud::File>(Arena*);
+template<> ::StorageCloud::Handshake* Arena::CreateMaybeMessage<::StorageCloud::Handshake>(Arena*);
+template<> ::StorageCloud::Param* Arena::CreateMaybeMessage<::StorageCloud::Param>(Arena*);
+template<> ::StorageCloud::ServerResponse* Arena::CreateMaybeMessage<::StorageCloud::ServerResponse>(Arena*);
+template<> ::StorageCloud::UserDetails* Arena::CreateMaybeMessage<::StorageCloud::UserDetails>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
 namespace StorageCloud {
 
-enum HashAlgorithm {
+enum HashAlgorithm : int {
   NULL2 = 0,
   H_NOHASH = 1,
   H_SHA256 = 2,
   H_SHA512 = 3,
   H_SHA1 = 4,
   H_MD5 = 5,
-  HashAlgorithm_INT_MIN_SENTINEL_DO_NOT_USE_ = ::google::protobuf::kint32min,
-  HashAlgorithm_INT_MAX_SENTINEL_DO_NOT_USE_ = ::google::protobuf::kint32max
+  H_CRC32C = 6,
+  H_XXH3 = 7,
+  HashAlgorithm_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  HashAlgorithm_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
 };
 bool HashAlgorithm_IsValid(int value);
-const HashAlgorithm HashAlgorithm_MIN = NULL2;
-const HashAlgorithm HashAlgorithm_MAX = H_MD5;
-const int HashAlgorithm_ARRAYSIZE = HashAlgorithm_MAX + 1;
-
-const ::google::protobuf::EnumDescriptor* HashAlgorithm_descriptor();
-inline const ::std::string& HashAlgorithm_Name(HashAlgorithm value) {
-  return ::google::protobuf::internal::NameOfEnum(
-    HashAlgorithm_descriptor(), value);
+constexpr HashAlgorithm HashAlgorithm_MIN = NULL2;
+constexpr HashAlgorithm HashAlgorithm_MAX = H_XXH3;
+constexpr int HashAlgorithm_ARRAYSIZE = HashAlgorithm_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* HashAlgorithm_descriptor();
+template<typename T>
+inline const std::string& HashAlgorithm_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, HashAlgorithm>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function HashAlgorithm_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    HashAlgorithm_descriptor(), enum_t_value);
 }
 inline bool HashAlgorithm_Parse(
-    const ::std::string& name, HashAlgorithm* value) {
-  return ::google::protobuf::internal::ParseNamedEnum<HashAlgorithm>(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, HashAlgorithm* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<HashAlgorithm>(
     HashAlgorithm_descriptor(), name, value);
 }
-enum MessageType {
+enum MessageType : int {
   NULL3 = 0,
   COMMAND = 1,
   SERVER_RESPONSE = 2,
   HANDSHAKE = 3,
-  MessageType_INT_MIN_SENTINEL_DO_NOT_USE_ = ::google::protobuf::kint32min,
-  MessageType_INT_MAX_SENTINEL_DO_NOT_USE_ = ::google::protobuf::kint32max
+  MessageType_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  MessageType_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
 };
 bool MessageType_IsValid(int value);
-const MessageType MessageType_MIN = NULL3;
-const MessageType MessageType_MAX = HANDSHAKE;
-const int MessageType_ARRAYSIZE = MessageType_MAX + 1;
-
-const ::google::protobuf::EnumDescriptor* MessageType_descriptor();
-inline const ::std::string& MessageType_Name(MessageType value) {
-  return ::google::protobuf::internal::NameOfEnum(
-    MessageType_descriptor(), value);
+constexpr MessageType MessageType_MIN = NULL3;
+constexpr MessageType MessageType_MAX = HANDSHAKE;
+constexpr int MessageType_ARRAYSIZE = MessageType_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* MessageType_descriptor();
+template<typename T>
+inline const std::string& MessageType_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, MessageType>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function MessageType_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    MessageType_descriptor(), enum_t_value);
 }
 inline bool MessageType_Parse(
-    const ::std::string& name, MessageType* value) {
-  return ::google::protobuf::internal::ParseNamedEnum<MessageType>(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, MessageType* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<MessageType>(
     MessageType_descriptor(), name, value);
 }
-enum CommandType {
+enum CommandType : int {
   NULL1 = 0,
   LOGIN = 1,
   RELOGIN = 2,
@@ -172,69 +173,82 @@ enum CommandType {
   CHANGE_QUOTA = 28,
   SHARED_DOWNLOAD = 29,
   SHARE_INFO = 30,
-  CommandType_INT_MIN_SENTINEL_DO_NOT_USE_ = ::google::protobuf::kint32min,
-  CommandType_INT_MAX_SENTINEL_DO_NOT_USE_ = ::google::protobuf::kint32max
+  STATS = 31,
+  CommandType_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  CommandType_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
 };
 bool CommandType_IsValid(int value);
-const CommandType CommandType_MIN = NULL1;
-const CommandType CommandType_MAX = SHARE_INFO;
-const int CommandType_ARRAYSIZE = CommandType_MAX + 1;
-
-const ::google::protobuf::EnumDescriptor* CommandType_descriptor();
-inline const ::std::string& CommandType_Name(CommandType value) {
-  return ::google::protobuf::internal::NameOfEnum(
-    CommandType_descriptor(), value);
+constexpr CommandType CommandType_MIN = NULL1;
+constexpr CommandType CommandType_MAX = STATS;
+constexpr int CommandType_ARRAYSIZE = CommandType_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* CommandType_descriptor();
+template<typename T>
+inline const std::string& CommandType_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, CommandType>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function CommandType_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    CommandType_descriptor(), enum_t_value);
 }
 inline bool CommandType_Parse(
-    const ::std::string& name, CommandType* value) {
-  return ::google::protobuf::internal::ParseNamedEnum<CommandType>(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, CommandType* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<CommandType>(
     CommandType_descriptor(), name, value);
 }
-enum FileType {
+enum FileType : int {
   NULL6 = 0,
   FILE = 1,
   DIRECTORY = 2,
-  FileType_INT_MIN_SENTINEL_DO_NOT_USE_ = ::google::protobuf::kint32min,
-  FileType_INT_MAX_SENTINEL_DO_NOT_USE_ = ::google::protobuf::kint32max
+  FileType_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  FileType_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
 };
 bool FileType_IsValid(int value);
-const FileType FileType_MIN = NULL6;
-const FileType FileType_MAX = DIRECTORY;
-const int FileType_ARRAYSIZE = FileType_MAX + 1;
-
-const ::google::protobuf::EnumDescriptor* FileType_descriptor();
-inline const ::std::string& FileType_Name(FileType value) {
-  return ::google::protobuf::internal::NameOfEnum(
-    FileType_descriptor(), value);
+constexpr FileType FileType_MIN = NULL6;
+constexpr FileType FileType_MAX = DIRECTORY;
+constexpr int FileType_ARRAYSIZE = FileType_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* FileType_descriptor();
+template<typename T>
+inline const std::string& FileType_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, FileType>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function FileType_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    FileType_descriptor(), enum_t_value);
 }
 inline bool FileType_Parse(
-    const ::std::string& name, FileType* value) {
-  return ::google::protobuf::internal::ParseNamedEnum<FileType>(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, FileType* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<FileType>(
     FileType_descriptor(), name, value);
 }
-enum UserRole {
+enum UserRole : int {
   NULL7 = 0,
   USER = 1,
   ADMIN = 2,
-  UserRole_INT_MIN_SENTINEL_DO_NOT_USE_ = ::google::protobuf::kint32min,
-  UserRole_INT_MAX_SENTINEL_DO_NOT_USE_ = ::google::protobuf::kint32max
+  UserRole_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  UserRole_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
 };
 bool UserRole_IsValid(int value);
-const UserRole UserRole_MIN = NULL7;
-const UserRole UserRole_MAX = ADMIN;
-const int UserRole_ARRAYSIZE = UserRole_MAX + 1;
-
-const ::google::protobuf::EnumDescriptor* UserRole_descriptor();
-inline const ::std::string& UserRole_Name(UserRole value) {
-  return ::google::protobuf::internal::NameOfEnum(
-    UserRole_descriptor(), value);
+constexpr UserRole UserRole_MIN = NULL7;
+constexpr UserRole UserRole_MAX = ADMIN;
+constexpr int UserRole_ARRAYSIZE = UserRole_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* UserRole_descriptor();
+template<typename T>
+inline const std::string& UserRole_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, UserRole>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function UserRole_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    UserRole_descriptor(), enum_t_value);
 }
 inline bool UserRole_Parse(
-    const ::std::string& name, UserRole* value) {
-  return ::google::protobuf::internal::ParseNamedEnum<UserRole>(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, UserRole* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<UserRole>(
     UserRole_descriptor(), name, value);
 }
-enum ResponseType {
+enum ResponseType : int {
   NULL5 = 0,
   OK = 1,
   ERROR = 2,
@@ -245,77 +259,102 @@ enum ResponseType {
   SRV_DATA = 7,
   CAN_SEND = 8,
   USERS = 9,
-  ResponseType_INT_MIN_SENTINEL_DO_NOT_USE_ = ::google::protobuf::kint32min,
-  ResponseType_INT_MAX_SENTINEL_DO_NOT_USE_ = ::google::protobuf::kint32max
+  CMD_STATS = 10,
+  ResponseType_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  ResponseType_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
 };
 bool ResponseType_IsValid(int value);
-const ResponseType ResponseType_MIN = NULL5;
-const ResponseType ResponseType_MAX = USERS;
-const int ResponseType_ARRAYSIZE = ResponseType_MAX + 1;
-
-const ::google::protobuf::EnumDescriptor* ResponseType_descriptor();
-inline const ::std::string& ResponseType_Name(ResponseType value) {
-  return ::google::protobuf::internal::NameOfEnum(
-    ResponseType_descriptor(), value);
+constexpr ResponseType ResponseType_MIN = NULL5;
+constexpr ResponseType ResponseType_MAX = CMD_STATS;
+constexpr int ResponseType_ARRAYSIZE = ResponseType_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* ResponseType_descriptor();
+template<typename T>
+inline const std::string& ResponseType_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, ResponseType>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function ResponseType_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    ResponseType_descriptor(), enum_t_value);
 }
 inline bool ResponseType_Parse(
-    const ::std::string& name, ResponseType* value) {
-  return ::google::protobuf::internal::ParseNamedEnum<ResponseType>(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, ResponseType* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<ResponseType>(
     ResponseType_descriptor(), name, value);
 }
-enum EncryptionAlgorithm {
+enum EncryptionAlgorithm : int {
   NULL4 = 0,
   NOENCRYPTION = 1,
   CAESAR = 2,
-  EncryptionAlgorithm_INT_MIN_SENTINEL_DO_NOT_USE_ = ::google::protobuf::kint32min,
-  EncryptionAlgorithm_INT_MAX_SENTINEL_DO_NOT_USE_ = ::google::protobuf::kint32max
+  AES_128_GCM = 3,
+  AES_256_GCM = 4,
+  EncryptionAlgorithm_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  EncryptionAlgorithm_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
 };
 bool EncryptionAlgorithm_IsValid(int value);
-const EncryptionAlgorithm EncryptionAlgorithm_MIN = NULL4;
-const EncryptionAlgorithm EncryptionAlgorithm_MAX = CAESAR;
-const int EncryptionAlgorithm_ARRAYSIZE = EncryptionAlgorithm_MAX + 1;
-
-const ::google::protobuf::EnumDescriptor* EncryptionAlgorithm_descriptor();
-inline const ::std::string& EncryptionAlgorithm_Name(EncryptionAlgorithm value) {
-  return ::google::protobuf::internal::NameOfEnum(
-    EncryptionAlgorithm_descriptor(), value);
+constexpr EncryptionAlgorithm EncryptionAlgorithm_MIN = NULL4;
+constexpr EncryptionAlgorithm EncryptionAlgorithm_MAX = AES_256_GCM;
+constexpr int EncryptionAlgorithm_ARRAYSIZE = EncryptionAlgorithm_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* EncryptionAlgorithm_descriptor();
+template<typename T>
+inline const std::string& EncryptionAlgorithm_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, EncryptionAlgorithm>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function EncryptionAlgorithm_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    EncryptionAlgorithm_descriptor(), enum_t_value);
 }
 inline bool EncryptionAlgorithm_Parse(
-    const ::std::string& name, EncryptionAlgorithm* value) {
-  return ::google::protobuf::internal::ParseNamedEnum<EncryptionAlgorithm>(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, EncryptionAlgorithm* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<EncryptionAlgorithm>(
     EncryptionAlgorithm_descriptor(), name, value);
 }
 // ===================================================================
 
-class Param : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:StorageCloud.Param) */ {
+class Param final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:StorageCloud.Param) */ {
  public:
-  Param();
-  virtual ~Param();
+  inline Param() : Param(nullptr) {}
+  ~Param() override;
+  explicit PROTOBUF_CONSTEXPR Param(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   Param(const Param& from);
-
-  inline Param& operator=(const Param& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   Param(Param&& from) noexcept
     : Param() {
     *this = ::std::move(from);
   }
 
+  inline Param& operator=(const Param& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline Param& operator=(Param&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const Param& default_instance();
 
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Param& default_instance() {
+    return *internal_default_instance();
+  }
   enum ValueCase {
     kSParamVal = 2,
     kIParamVal = 3,
@@ -323,1046 +362,1771 @@ class Param : public ::google::protobuf::Message /* @@protoc_insertion_point(cla
     VALUE_NOT_SET = 0,
   };
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const Param* internal_default_instance() {
     return reinterpret_cast<const Param*>(
                &_Param_default_instance_);
   }
-  static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
+  static constexpr int kIndexInFileMessages =
     0;
 
-  void Swap(Param* other);
   friend void swap(Param& a, Param& b) {
     a.Swap(&b);
   }
+  inline void Swap(Param* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Param* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline Param* New() const PROTOBUF_FINAL { return New(NULL); }
-
-  Param* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
-  void CopyFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
-  void MergeFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
+  Param* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Param>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const Param& from);
-  void MergeFrom(const Param& from);
-  void Clear() PROTOBUF_FINAL;
-  bool IsInitialized() const PROTOBUF_FINAL;
-
-  size_t ByteSizeLong() const PROTOBUF_FINAL;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) PROTOBUF_FINAL;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const PROTOBUF_FINAL;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const PROTOBUF_FINAL;
-  int GetCachedSize() const PROTOBUF_FINAL { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Param& from) {
+    Param::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const PROTOBUF_FINAL;
+  void SetCachedSize(int size) const final;
   void InternalSwap(Param* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "StorageCloud.Param";
   }
+  protected:
+  explicit Param(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const PROTOBUF_FINAL;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kParamIdFieldNumber = 1,
+    kSParamValFieldNumber = 2,
+    kIParamValFieldNumber = 3,
+    kBParamValFieldNumber = 4,
+  };
   // string paramId = 1;
   void clear_paramid();
-  static const int kParamIdFieldNumber = 1;
-  const ::std::string& paramid() const;
-  void set_paramid(const ::std::string& value);
-  #if LANG_CXX11
-  void set_paramid(::std::string&& value);
-  #endif
-  void set_paramid(const char* value);
-  void set_paramid(const char* value, size_t size);
-  ::std::string* mutable_paramid();
-  ::std::string* release_paramid();
-  void set_allocated_paramid(::std::string* paramid);
+  const std::string& paramid() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_paramid(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_paramid();
+  PROTOBUF_NODISCARD std::string* release_paramid();
+  void set_allocated_paramid(std::string* paramid);
+  private:
+  const std::string& _internal_paramid() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_paramid(const std::string& value);
+  std::string* _internal_mutable_paramid();
+  public:
 
   // string SParamVal = 2;
-  private:
   bool has_sparamval() const;
+  private:
+  bool _internal_has_sparamval() const;
   public:
   void clear_sparamval();
-  static const int kSParamValFieldNumber = 2;
-  const ::std::string& sparamval() const;
-  void set_sparamval(const ::std::string& value);
-  #if LANG_CXX11
-  void set_sparamval(::std::string&& value);
-  #endif
-  void set_sparamval(const char* value);
-  void set_sparamval(const char* value, size_t size);
-  ::std::string* mutable_sparamval();
-  ::std::string* release_sparamval();
-  void set_allocated_sparamval(::std::string* sparamval);
+  const std::string& sparamval() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_sparamval(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_sparamval();
+  PROTOBUF_NODISCARD std::string* release_sparamval();
+  void set_allocated_sparamval(std::string* sparamval);
+  private:
+  const std::string& _internal_sparamval() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_sparamval(const std::string& value);
+  std::string* _internal_mutable_sparamval();
+  public:
 
   // int64 IParamVal = 3;
-  private:
   bool has_iparamval() const;
+  private:
+  bool _internal_has_iparamval() const;
   public:
   void clear_iparamval();
-  static const int kIParamValFieldNumber = 3;
-  ::google::protobuf::int64 iparamval() const;
-  void set_iparamval(::google::protobuf::int64 value);
+  int64_t iparamval() const;
+  void set_iparamval(int64_t value);
+  private:
+  int64_t _internal_iparamval() const;
+  void _internal_set_iparamval(int64_t value);
+  public:
 
   // bytes BParamVal = 4;
-  private:
   bool has_bparamval() const;
+  private:
+  bool _internal_has_bparamval() const;
   public:
   void clear_bparamval();
-  static const int kBParamValFieldNumber = 4;
-  const ::std::string& bparamval() const;
-  void set_bparamval(const ::std::string& value);
-  #if LANG_CXX11
-  void set_bparamval(::std::string&& value);
-  #endif
-  void set_bparamval(const char* value);
-  void set_bparamval(const void* value, size_t size);
-  ::std::string* mutable_bparamval();
-  ::std::string* release_bparamval();
-  void set_allocated_bparamval(::std::string* bparamval);
+  const std::string& bparamval() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_bparamval(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_bparamval();
+  PROTOBUF_NODISCARD std::string* release_bparamval();
+  void set_allocated_bparamval(std::string* bparamval);
+  private:
+  const std::string& _internal_bparamval() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_bparamval(const std::string& value);
+  std::string* _internal_mutable_bparamval();
+  public:
 
+  void clear_value();
   ValueCase value_case() const;
   // @@protoc_insertion_point(class_scope:StorageCloud.Param)
  private:
+  class _Internal;
   void set_has_sparamval();
   void set_has_iparamval();
   void set_has_bparamval();
 
   inline bool has_value() const;
-  void clear_value();
   inline void clear_has_value();
 
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::internal::ArenaStringPtr paramid_;
-  union ValueUnion {
-    ValueUnion() {}
-    ::google::protobuf::internal::ArenaStringPtr sparamval_;
-    ::google::protobuf::int64 iparamval_;
-    ::google::protobuf::internal::ArenaStringPtr bparamval_;
-  } value_;
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _oneof_case_[1];
-
-  friend struct ::protobuf_messages_2eproto::TableStruct;
-  friend void ::protobuf_messages_2eproto::InitDefaultsParamImpl();
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr paramid_;
+    union ValueUnion {
+      constexpr ValueUnion() : _constinit_{} {}
+        ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized _constinit_;
+      ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr sparamval_;
+      int64_t iparamval_;
+      ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr bparamval_;
+    } value_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint32_t _oneof_case_[1];
+
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_messages_2eproto;
 };
 // -------------------------------------------------------------------
 
-class EncodedMessage : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:StorageCloud.EncodedMessage) */ {
+class EncodedMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:StorageCloud.EncodedMessage) */ {
  public:
-  EncodedMessage();
-  virtual ~EncodedMessage();
+  inline EncodedMessage() : EncodedMessage(nullptr) {}
+  ~EncodedMessage() override;
+  explicit PROTOBUF_CONSTEXPR EncodedMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   EncodedMessage(const EncodedMessage& from);
-
-  inline EncodedMessage& operator=(const EncodedMessage& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   EncodedMessage(EncodedMessage&& from) noexcept
     : EncodedMessage() {
     *this = ::std::move(from);
   }
 
+  inline EncodedMessage& operator=(const EncodedMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline EncodedMessage& operator=(EncodedMessage&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const EncodedMessage& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const EncodedMessage& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const EncodedMessage* internal_default_instance() {
     return reinterpret_cast<const EncodedMessage*>(
                &_EncodedMessage_default_instance_);
   }
-  static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
+  static constexpr int kIndexInFileMessages =
     1;
 
-  void Swap(EncodedMessage* other);
   friend void swap(EncodedMessage& a, EncodedMessage& b) {
     a.Swap(&b);
   }
+  inline void Swap(EncodedMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(EncodedMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline EncodedMessage* New() const PROTOBUF_FINAL { return New(NULL); }
-
-  EncodedMessage* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
-  void CopyFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
-  void MergeFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
+  EncodedMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<EncodedMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const EncodedMessage& from);
-  void MergeFrom(const EncodedMessage& from);
-  void Clear() PROTOBUF_FINAL;
-  bool IsInitialized() const PROTOBUF_FINAL;
-
-  size_t ByteSizeLong() const PROTOBUF_FINAL;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) PROTOBUF_FINAL;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const PROTOBUF_FINAL;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const PROTOBUF_FINAL;
-  int GetCachedSize() const PROTOBUF_FINAL { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const EncodedMessage& from) {
+    EncodedMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const PROTOBUF_FINAL;
+  void SetCachedSize(int size) const final;
   void InternalSwap(EncodedMessage* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "StorageCloud.EncodedMessage";
   }
+  protected:
+  explicit EncodedMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const PROTOBUF_FINAL;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kHashFieldNumber = 3,
+    kDataFieldNumber = 5,
+    kDataSizeFieldNumber = 1,
+    kHashAlgorithmFieldNumber = 2,
+    kTypeFieldNumber = 4,
+  };
   // bytes hash = 3;
   void clear_hash();
-  static const int kHashFieldNumber = 3;
-  const ::std::string& hash() const;
-  void set_hash(const ::std::string& value);
-  #if LANG_CXX11
-  void set_hash(::std::string&& value);
-  #endif
-  void set_hash(const char* value);
-  void set_hash(const void* value, size_t size);
-  ::std::string* mutable_hash();
-  ::std::string* release_hash();
-  void set_allocated_hash(::std::string* hash);
+  const std::string& hash() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_hash(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_hash();
+  PROTOBUF_NODISCARD std::string* release_hash();
+  void set_allocated_hash(std::string* hash);
+  private:
+  const std::string& _internal_hash() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_hash(const std::string& value);
+  std::string* _internal_mutable_hash();
+  public:
 
   // bytes data = 5;
   void clear_data();
-  static const int kDataFieldNumber = 5;
-  const ::std::string& data() const;
-  void set_data(const ::std::string& value);
-  #if LANG_CXX11
-  void set_data(::std::string&& value);
-  #endif
-  void set_data(const char* value);
-  void set_data(const void* value, size_t size);
-  ::std::string* mutable_data();
-  ::std::string* release_data();
-  void set_allocated_data(::std::string* data);
+  const std::string& data() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_data(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_data();
+  PROTOBUF_NODISCARD std::string* release_data();
+  void set_allocated_data(std::string* data);
+  private:
+  const std::string& _internal_data() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_data(const std::string& value);
+  std::string* _internal_mutable_data();
+  public:
 
   // uint64 dataSize = 1;
   void clear_datasize();
-  static const int kDataSizeFieldNumber = 1;
-  ::google::protobuf::uint64 datasize() const;
-  void set_datasize(::google::protobuf::uint64 value);
+  uint64_t datasize() const;
+  void set_datasize(uint64_t value);
+  private:
+  uint64_t _internal_datasize() const;
+  void _internal_set_datasize(uint64_t value);
+  public:
 
   // .StorageCloud.HashAlgorithm hashAlgorithm = 2;
   void clear_hashalgorithm();
-  static const int kHashAlgorithmFieldNumber = 2;
   ::StorageCloud::HashAlgorithm hashalgorithm() const;
   void set_hashalgorithm(::StorageCloud::HashAlgorithm value);
+  private:
+  ::StorageCloud::HashAlgorithm _internal_hashalgorithm() const;
+  void _internal_set_hashalgorithm(::StorageCloud::HashAlgorithm value);
+  public:
 
   // .StorageCloud.MessageType type = 4;
   void clear_type();
-  static const int kTypeFieldNumber = 4;
   ::StorageCloud::MessageType type() const;
   void set_type(::StorageCloud::MessageType value);
+  private:
+  ::StorageCloud::MessageType _internal_type() const;
+  void _internal_set_type(::StorageCloud::MessageType value);
+  public:
 
   // @@protoc_insertion_point(class_scope:StorageCloud.EncodedMessage)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::internal::ArenaStringPtr hash_;
-  ::google::protobuf::internal::ArenaStringPtr data_;
-  ::google::protobuf::uint64 datasize_;
-  int hashalgorithm_;
-  int type_;
-  mutable int _cached_size_;
-  friend struct ::protobuf_messages_2eproto::TableStruct;
-  friend void ::protobuf_messages_2eproto::InitDefaultsEncodedMessageImpl();
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr hash_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr data_;
+    uint64_t datasize_;
+    int hashalgorithm_;
+    int type_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_messages_2eproto;
 };
 // -------------------------------------------------------------------
 
-class Command : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:StorageCloud.Command) */ {
+class Command final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:StorageCloud.Command) */ {
  public:
-  Command();
-  virtual ~Command();
+  inline Command() : Command(nullptr) {}
+  ~Command() override;
+  explicit PROTOBUF_CONSTEXPR Command(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   Command(const Command& from);
-
-  inline Command& operator=(const Command& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   Command(Command&& from) noexcept
     : Command() {
     *this = ::std::move(from);
   }
 
+  inline Command& operator=(const Command& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline Command& operator=(Command&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const Command& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Command& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const Command* internal_default_instance() {
     return reinterpret_cast<const Command*>(
                &_Command_default_instance_);
   }
-  static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
+  static constexpr int kIndexInFileMessages =
     2;
 
-  void Swap(Command* other);
   friend void swap(Command& a, Command& b) {
     a.Swap(&b);
   }
+  inline void Swap(Command* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Command* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline Command* New() const PROTOBUF_FINAL { return New(NULL); }
-
-  Command* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
-  void CopyFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
-  void MergeFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
+  Command* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Command>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const Command& from);
-  void MergeFrom(const Command& from);
-  void Clear() PROTOBUF_FINAL;
-  bool IsInitialized() const PROTOBUF_FINAL;
-
-  size_t ByteSizeLong() const PROTOBUF_FINAL;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) PROTOBUF_FINAL;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const PROTOBUF_FINAL;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const PROTOBUF_FINAL;
-  int GetCachedSize() const PROTOBUF_FINAL { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Command& from) {
+    Command::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const PROTOBUF_FINAL;
+  void SetCachedSize(int size) const final;
   void InternalSwap(Command* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "StorageCloud.Command";
   }
+  protected:
+  explicit Command(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const PROTOBUF_FINAL;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kParamsFieldNumber = 2,
+    kListFieldNumber = 3,
+    kDataFieldNumber = 4,
+    kTypeFieldNumber = 1,
+  };
   // repeated .StorageCloud.Param params = 2;
   int params_size() const;
+  private:
+  int _internal_params_size() const;
+  public:
   void clear_params();
-  static const int kParamsFieldNumber = 2;
-  const ::StorageCloud::Param& params(int index) const;
   ::StorageCloud::Param* mutable_params(int index);
-  ::StorageCloud::Param* add_params();
-  ::google::protobuf::RepeatedPtrField< ::StorageCloud::Param >*
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::StorageCloud::Param >*
       mutable_params();
-  const ::google::protobuf::RepeatedPtrField< ::StorageCloud::Param >&
+  private:
+  const ::StorageCloud::Param& _internal_params(int index) const;
+  ::StorageCloud::Param* _internal_add_params();
+  public:
+  const ::StorageCloud::Param& params(int index) const;
+  ::StorageCloud::Param* add_params();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::StorageCloud::Param >&
       params() const;
 
   // repeated string list = 3;
   int list_size() const;
+  private:
+  int _internal_list_size() const;
+  public:
   void clear_list();
-  static const int kListFieldNumber = 3;
-  const ::std::string& list(int index) const;
-  ::std::string* mutable_list(int index);
-  void set_list(int index, const ::std::string& value);
-  #if LANG_CXX11
-  void set_list(int index, ::std::string&& value);
-  #endif
+  const std::string& list(int index) const;
+  std::string* mutable_list(int index);
+  void set_list(int index, const std::string& value);
+  void set_list(int index, std::string&& value);
   void set_list(int index, const char* value);
   void set_list(int index, const char* value, size_t size);
-  ::std::string* add_list();
-  void add_list(const ::std::string& value);
-  #if LANG_CXX11
-  void add_list(::std::string&& value);
-  #endif
+  std::string* add_list();
+  void add_list(const std::string& value);
+  void add_list(std::string&& value);
   void add_list(const char* value);
   void add_list(const char* value, size_t size);
-  const ::google::protobuf::RepeatedPtrField< ::std::string>& list() const;
-  ::google::protobuf::RepeatedPtrField< ::std::string>* mutable_list();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& list() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_list();
+  private:
+  const std::string& _internal_list(int index) const;
+  std::string* _internal_add_list();
+  public:
 
   // bytes data = 4;
   void clear_data();
-  static const int kDataFieldNumber = 4;
-  const ::std::string& data() const;
-  void set_data(const ::std::string& value);
-  #if LANG_CXX11
-  void set_data(::std::string&& value);
-  #endif
-  void set_data(const char* value);
-  void set_data(const void* value, size_t size);
-  ::std::string* mutable_data();
-  ::std::string* release_data();
-  void set_allocated_data(::std::string* data);
+  const std::string& data() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_data(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_data();
+  PROTOBUF_NODISCARD std::string* release_data();
+  void set_allocated_data(std::string* data);
+  private:
+  const std::string& _internal_data() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_data(const std::string& value);
+  std::string* _internal_mutable_data();
+  public:
 
   // .StorageCloud.CommandType type = 1;
   void clear_type();
-  static const int kTypeFieldNumber = 1;
   ::StorageCloud::CommandType type() const;
   void set_type(::StorageCloud::CommandType value);
+  private:
+  ::StorageCloud::CommandType _internal_type() const;
+  void _internal_set_type(::StorageCloud::CommandType value);
+  public:
 
   // @@protoc_insertion_point(class_scope:StorageCloud.Command)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::RepeatedPtrField< ::StorageCloud::Param > params_;
-  ::google::protobuf::RepeatedPtrField< ::std::string> list_;
-  ::google::protobuf::internal::ArenaStringPtr data_;
-  int type_;
-  mutable int _cached_size_;
-  friend struct ::protobuf_messages_2eproto::TableStruct;
-  friend void ::protobuf_messages_2eproto::InitDefaultsCommandImpl();
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::StorageCloud::Param > params_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> list_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr data_;
+    int type_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_messages_2eproto;
 };
 // -------------------------------------------------------------------
 
-class File : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:StorageCloud.File) */ {
+class File final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:StorageCloud.File) */ {
  public:
-  File();
-  virtual ~File();
+  inline File() : File(nullptr) {}
+  ~File() override;
+  explicit PROTOBUF_CONSTEXPR File(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   File(const File& from);
-
-  inline File& operator=(const File& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   File(File&& from) noexcept
     : File() {
     *this = ::std::move(from);
   }
 
+  inline File& operator=(const File& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline File& operator=(File&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const File& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const File& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const File* internal_default_instance() {
     return reinterpret_cast<const File*>(
                &_File_default_instance_);
   }
-  static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
+  static constexpr int kIndexInFileMessages =
     3;
 
-  void Swap(File* other);
   friend void swap(File& a, File& b) {
     a.Swap(&b);
   }
+  inline void Swap(File* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(File* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline File* New() const PROTOBUF_FINAL { return New(NULL); }
-
-  File* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
-  void CopyFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
-  void MergeFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
+  File* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<File>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const File& from);
-  void MergeFrom(const File& from);
-  void Clear() PROTOBUF_FINAL;
-  bool IsInitialized() const PROTOBUF_FINAL;
-
-  size_t ByteSizeLong() const PROTOBUF_FINAL;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) PROTOBUF_FINAL;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const PROTOBUF_FINAL;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const PROTOBUF_FINAL;
-  int GetCachedSize() const PROTOBUF_FINAL { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const File& from) {
+    File::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const PROTOBUF_FINAL;
+  void SetCachedSize(int size) const final;
   void InternalSwap(File* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "StorageCloud.File";
   }
+  protected:
+  explicit File(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const PROTOBUF_FINAL;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kFilenameFieldNumber = 1,
+    kHashFieldNumber = 4,
+    kOwnerFieldNumber = 5,
+    kOwnerUsernameFieldNumber = 6,
+    kSizeFieldNumber = 3,
+    kFiletypeFieldNumber = 2,
+    kIsSharedFieldNumber = 8,
+    kCreationDateFieldNumber = 7,
+  };
   // string filename = 1;
   void clear_filename();
-  static const int kFilenameFieldNumber = 1;
-  const ::std::string& filename() const;
-  void set_filename(const ::std::string& value);
-  #if LANG_CXX11
-  void set_filename(::std::string&& value);
-  #endif
-  void set_filename(const char* value);
-  void set_filename(const char* value, size_t size);
-  ::std::string* mutable_filename();
-  ::std::string* release_filename();
-  void set_allocated_filename(::std::string* filename);
+  const std::string& filename() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_filename(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_filename();
+  PROTOBUF_NODISCARD std::string* release_filename();
+  void set_allocated_filename(std::string* filename);
+  private:
+  const std::string& _internal_filename() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_filename(const std::string& value);
+  std::string* _internal_mutable_filename();
+  public:
 
   // bytes hash = 4;
   void clear_hash();
-  static const int kHashFieldNumber = 4;
-  const ::std::string& hash() const;
-  void set_hash(const ::std::string& value);
-  #if LANG_CXX11
-  void set_hash(::std::string&& value);
-  #endif
-  void set_hash(const char* value);
-  void set_hash(const void* value, size_t size);
-  ::std::string* mutable_hash();
-  ::std::string* release_hash();
-  void set_allocated_hash(::std::string* hash);
+  const std::string& hash() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_hash(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_hash();
+  PROTOBUF_NODISCARD std::string* release_hash();
+  void set_allocated_hash(std::string* hash);
+  private:
+  const std::string& _internal_hash() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_hash(const std::string& value);
+  std::string* _internal_mutable_hash();
+  public:
 
   // string owner = 5;
   void clear_owner();
-  static const int kOwnerFieldNumber = 5;
-  const ::std::string& owner() const;
-  void set_owner(const ::std::string& value);
-  #if LANG_CXX11
-  void set_owner(::std::string&& value);
-  #endif
-  void set_owner(const char* value);
-  void set_owner(const char* value, size_t size);
-  ::std::string* mutable_owner();
-  ::std::string* release_owner();
-  void set_allocated_owner(::std::string* owner);
+  const std::string& owner() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_owner(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_owner();
+  PROTOBUF_NODISCARD std::string* release_owner();
+  void set_allocated_owner(std::string* owner);
+  private:
+  const std::string& _internal_owner() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_owner(const std::string& value);
+  std::string* _internal_mutable_owner();
+  public:
 
   // string ownerUsername = 6;
   void clear_ownerusername();
-  static const int kOwnerUsernameFieldNumber = 6;
-  const ::std::string& ownerusername() const;
-  void set_ownerusername(const ::std::string& value);
-  #if LANG_CXX11
-  void set_ownerusername(::std::string&& value);
-  #endif
-  void set_ownerusername(const char* value);
-  void set_ownerusername(const char* value, size_t size);
-  ::std::string* mutable_ownerusername();
-  ::std::string* release_ownerusername();
-  void set_allocated_ownerusername(::std::string* ownerusername);
+  const std::string& ownerusername() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_ownerusername(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_ownerusername();
+  PROTOBUF_NODISCARD std::string* release_ownerusername();
+  void set_allocated_ownerusername(std::string* ownerusername);
+  private:
+  const std::string& _internal_ownerusername() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_ownerusername(const std::string& value);
+  std::string* _internal_mutable_ownerusername();
+  public:
 
   // uint64 size = 3;
   void clear_size();
-  static const int kSizeFieldNumber = 3;
-  ::google::protobuf::uint64 size() const;
-  void set_size(::google::protobuf::uint64 value);
+  uint64_t size() const;
+  void set_size(uint64_t value);
+  private:
+  uint64_t _internal_size() const;
+  void _internal_set_size(uint64_t value);
+  public:
 
   // .StorageCloud.FileType filetype = 2;
   void clear_filetype();
-  static const int kFiletypeFieldNumber = 2;
   ::StorageCloud::FileType filetype() const;
   void set_filetype(::StorageCloud::FileType value);
+  private:
+  ::StorageCloud::FileType _internal_filetype() const;
+  void _internal_set_filetype(::StorageCloud::FileType value);
+  public:
 
   // bool isShared = 8;
   void clear_isshared();
-  static const int kIsSharedFieldNumber = 8;
   bool isshared() const;
   void set_isshared(bool value);
+  private:
+  bool _internal_isshared() const;
+  void _internal_set_isshared(bool value);
+  public:
 
   // uint64 creationDate = 7;
   void clear_creationdate();
-  static const int kCreationDateFieldNumber = 7;
-  ::google::protobuf::uint64 creationdate() const;
-  void set_creationdate(::google::protobuf::uint64 value);
+  uint64_t creationdate() const;
+  void set_creationdate(uint64_t value);
+  private:
+  uint64_t _internal_creationdate() const;
+  void _internal_set_creationdate(uint64_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:StorageCloud.File)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::internal::ArenaStringPtr filename_;
-  ::google::protobuf::internal::ArenaStringPtr hash_;
-  ::google::protobuf::internal::ArenaStringPtr owner_;
-  ::google::protobuf::internal::ArenaStringPtr ownerusername_;
-  ::google::protobuf::uint64 size_;
-  int filetype_;
-  bool isshared_;
-  ::google::protobuf::uint64 creationdate_;
-  mutable int _cached_size_;
-  friend struct ::protobuf_messages_2eproto::TableStruct;
-  friend void ::protobuf_messages_2eproto::InitDefaultsFileImpl();
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr filename_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr hash_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr owner_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr ownerusername_;
+    uint64_t size_;
+    int filetype_;
+    bool isshared_;
+    uint64_t creationdate_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_messages_2eproto;
 };
 // -------------------------------------------------------------------
 
-class Handshake : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:StorageCloud.Handshake) */ {
+class Handshake final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:StorageCloud.Handshake) */ {
  public:
-  Handshake();
-  virtual ~Handshake();
+  inline Handshake() : Handshake(nullptr) {}
+  ~Handshake() override;
+  explicit PROTOBUF_CONSTEXPR Handshake(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   Handshake(const Handshake& from);
-
-  inline Handshake& operator=(const Handshake& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   Handshake(Handshake&& from) noexcept
     : Handshake() {
     *this = ::std::move(from);
   }
 
+  inline Handshake& operator=(const Handshake& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline Handshake& operator=(Handshake&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const Handshake& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Handshake& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const Handshake* internal_default_instance() {
     return reinterpret_cast<const Handshake*>(
                &_Handshake_default_instance_);
   }
-  static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
+  static constexpr int kIndexInFileMessages =
     4;
 
-  void Swap(Handshake* other);
   friend void swap(Handshake& a, Handshake& b) {
     a.Swap(&b);
   }
+  inline void Swap(Handshake* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Handshake* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline Handshake* New() const PROTOBUF_FINAL { return New(NULL); }
-
-  Handshake* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
-  void CopyFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
-  void MergeFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
+  Handshake* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Handshake>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const Handshake& from);
-  void MergeFrom(const Handshake& from);
-  void Clear() PROTOBUF_FINAL;
-  bool IsInitialized() const PROTOBUF_FINAL;
-
-  size_t ByteSizeLong() const PROTOBUF_FINAL;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) PROTOBUF_FINAL;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const PROTOBUF_FINAL;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const PROTOBUF_FINAL;
-  int GetCachedSize() const PROTOBUF_FINAL { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Handshake& from) {
+    Handshake::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const PROTOBUF_FINAL;
+  void SetCachedSize(int size) const final;
   void InternalSwap(Handshake* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "StorageCloud.Handshake";
   }
+  protected:
+  explicit Handshake(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const PROTOBUF_FINAL;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kPublicKeyFieldNumber = 5,
+    kEncryptionAlgorithmFieldNumber = 1,
+    kRawDataFramesFieldNumber = 2,
+    kProtocolVersionFieldNumber = 3,
+    kHashAlgorithmFieldNumber = 4,
+  };
+  // bytes publicKey = 5;
+  void clear_publickey();
+  const std::string& publickey() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_publickey(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_publickey();
+  PROTOBUF_NODISCARD std::string* release_publickey();
+  void set_allocated_publickey(std::string* publickey);
+  private:
+  const std::string& _internal_publickey() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_publickey(const std::string& value);
+  std::string* _internal_mutable_publickey();
+  public:
+
   // .StorageCloud.EncryptionAlgorithm encryptionAlgorithm = 1;
   void clear_encryptionalgorithm();
-  static const int kEncryptionAlgorithmFieldNumber = 1;
   ::StorageCloud::EncryptionAlgorithm encryptionalgorithm() const;
   void set_encryptionalgorithm(::StorageCloud::EncryptionAlgorithm value);
+  private:
+  ::StorageCloud::EncryptionAlgorithm _internal_encryptionalgorithm() const;
+  void _internal_set_encryptionalgorithm(::StorageCloud::EncryptionAlgorithm value);
+  public:
+
+  // bool rawDataFrames = 2;
+  void clear_rawdataframes();
+  bool rawdataframes() const;
+  void set_rawdataframes(bool value);
+  private:
+  bool _internal_rawdataframes() const;
+  void _internal_set_rawdataframes(bool value);
+  public:
+
+  // uint32 protocolVersion = 3;
+  void clear_protocolversion();
+  uint32_t protocolversion() const;
+  void set_protocolversion(uint32_t value);
+  private:
+  uint32_t _internal_protocolversion() const;
+  void _internal_set_protocolversion(uint32_t value);
+  public:
+
+  // .StorageCloud.HashAlgorithm hashAlgorithm = 4;
+  void clear_hashalgorithm();
+  ::StorageCloud::HashAlgorithm hashalgorithm() const;
+  void set_hashalgorithm(::StorageCloud::HashAlgorithm value);
+  private:
+  ::StorageCloud::HashAlgorithm _internal_hashalgorithm() const;
+  void _internal_set_hashalgorithm(::StorageCloud::HashAlgorithm value);
+  public:
 
   // @@protoc_insertion_point(class_scope:StorageCloud.Handshake)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  int encryptionalgorithm_;
-  mutable int _cached_size_;
-  friend struct ::protobuf_messages_2eproto::TableStruct;
-  friend void ::protobuf_messages_2eproto::InitDefaultsHandshakeImpl();
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr publickey_;
+    int encryptionalgorithm_;
+    bool rawdataframes_;
+    uint32_t protocolversion_;
+    int hashalgorithm_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_messages_2eproto;
 };
 // -------------------------------------------------------------------
 
-class UserDetails : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:StorageCloud.UserDetails) */ {
+class UserDetails final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:StorageCloud.UserDetails) */ {
  public:
-  UserDetails();
-  virtual ~UserDetails();
+  inline UserDetails() : UserDetails(nullptr) {}
+  ~UserDetails() override;
+  explicit PROTOBUF_CONSTEXPR UserDetails(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   UserDetails(const UserDetails& from);
-
-  inline UserDetails& operator=(const UserDetails& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   UserDetails(UserDetails&& from) noexcept
     : UserDetails() {
     *this = ::std::move(from);
   }
 
+  inline UserDetails& operator=(const UserDetails& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline UserDetails& operator=(UserDetails&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const UserDetails& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const UserDetails& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const UserDetails* internal_default_instance() {
     return reinterpret_cast<const UserDetails*>(
                &_UserDetails_default_instance_);
   }
-  static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
+  static constexpr int kIndexInFileMessages =
     5;
 
-  void Swap(UserDetails* other);
   friend void swap(UserDetails& a, UserDetails& b) {
     a.Swap(&b);
   }
+  inline void Swap(UserDetails* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(UserDetails* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline UserDetails* New() const PROTOBUF_FINAL { return New(NULL); }
-
-  UserDetails* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
-  void CopyFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
-  void MergeFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
+  UserDetails* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<UserDetails>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const UserDetails& from);
-  void MergeFrom(const UserDetails& from);
-  void Clear() PROTOBUF_FINAL;
-  bool IsInitialized() const PROTOBUF_FINAL;
-
-  size_t ByteSizeLong() const PROTOBUF_FINAL;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) PROTOBUF_FINAL;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const PROTOBUF_FINAL;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const PROTOBUF_FINAL;
-  int GetCachedSize() const PROTOBUF_FINAL { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const UserDetails& from) {
+    UserDetails::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const PROTOBUF_FINAL;
+  void SetCachedSize(int size) const final;
   void InternalSwap(UserDetails* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "StorageCloud.UserDetails";
   }
+  protected:
+  explicit UserDetails(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const PROTOBUF_FINAL;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kUsernameFieldNumber = 1,
+    kFirstNameFieldNumber = 2,
+    kLastNameFieldNumber = 3,
+    kTotalSpaceFieldNumber = 5,
+    kUsedSpaceFieldNumber = 6,
+    kRoleFieldNumber = 4,
+  };
   // string username = 1;
   void clear_username();
-  static const int kUsernameFieldNumber = 1;
-  const ::std::string& username() const;
-  void set_username(const ::std::string& value);
-  #if LANG_CXX11
-  void set_username(::std::string&& value);
-  #endif
-  void set_username(const char* value);
-  void set_username(const char* value, size_t size);
-  ::std::string* mutable_username();
-  ::std::string* release_username();
-  void set_allocated_username(::std::string* username);
+  const std::string& username() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_username(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_username();
+  PROTOBUF_NODISCARD std::string* release_username();
+  void set_allocated_username(std::string* username);
+  private:
+  const std::string& _internal_username() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_username(const std::string& value);
+  std::string* _internal_mutable_username();
+  public:
 
   // string firstName = 2;
   void clear_firstname();
-  static const int kFirstNameFieldNumber = 2;
-  const ::std::string& firstname() const;
-  void set_firstname(const ::std::string& value);
-  #if LANG_CXX11
-  void set_firstname(::std::string&& value);
-  #endif
-  void set_firstname(const char* value);
-  void set_firstname(const char* value, size_t size);
-  ::std::string* mutable_firstname();
-  ::std::string* release_firstname();
-  void set_allocated_firstname(::std::string* firstname);
+  const std::string& firstname() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_firstname(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_firstname();
+  PROTOBUF_NODISCARD std::string* release_firstname();
+  void set_allocated_firstname(std::string* firstname);
+  private:
+  const std::string& _internal_firstname() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_firstname(const std::string& value);
+  std::string* _internal_mutable_firstname();
+  public:
 
   // string lastName = 3;
   void clear_lastname();
-  static const int kLastNameFieldNumber = 3;
-  const ::std::string& lastname() const;
-  void set_lastname(const ::std::string& value);
-  #if LANG_CXX11
-  void set_lastname(::std::string&& value);
-  #endif
-  void set_lastname(const char* value);
-  void set_lastname(const char* value, size_t size);
-  ::std::string* mutable_lastname();
-  ::std::string* release_lastname();
-  void set_allocated_lastname(::std::string* lastname);
+  const std::string& lastname() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_lastname(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_lastname();
+  PROTOBUF_NODISCARD std::string* release_lastname();
+  void set_allocated_lastname(std::string* lastname);
+  private:
+  const std::string& _internal_lastname() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_lastname(const std::string& value);
+  std::string* _internal_mutable_lastname();
+  public:
 
   // uint64 totalSpace = 5;
   void clear_totalspace();
-  static const int kTotalSpaceFieldNumber = 5;
-  ::google::protobuf::uint64 totalspace() const;
-  void set_totalspace(::google::protobuf::uint64 value);
+  uint64_t totalspace() const;
+  void set_totalspace(uint64_t value);
+  private:
+  uint64_t _internal_totalspace() const;
+  void _internal_set_totalspace(uint64_t value);
+  public:
 
   // uint64 usedSpace = 6;
   void clear_usedspace();
-  static const int kUsedSpaceFieldNumber = 6;
-  ::google::protobuf::uint64 usedspace() const;
-  void set_usedspace(::google::protobuf::uint64 value);
+  uint64_t usedspace() const;
+  void set_usedspace(uint64_t value);
+  private:
+  uint64_t _internal_usedspace() const;
+  void _internal_set_usedspace(uint64_t value);
+  public:
 
   // .StorageCloud.UserRole role = 4;
   void clear_role();
-  static const int kRoleFieldNumber = 4;
   ::StorageCloud::UserRole role() const;
   void set_role(::StorageCloud::UserRole value);
+  private:
+  ::StorageCloud::UserRole _internal_role() const;
+  void _internal_set_role(::StorageCloud::UserRole value);
+  public:
 
   // @@protoc_insertion_point(class_scope:StorageCloud.UserDetails)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::internal::ArenaStringPtr username_;
-  ::google::protobuf::internal::ArenaStringPtr firstname_;
-  ::google::protobuf::internal::ArenaStringPtr lastname_;
-  ::google::protobuf::uint64 totalspace_;
-  ::google::protobuf::uint64 usedspace_;
-  int role_;
-  mutable int _cached_size_;
-  friend struct ::protobuf_messages_2eproto::TableStruct;
-  friend void ::protobuf_messages_2eproto::InitDefaultsUserDetailsImpl();
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr username_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr firstname_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr lastname_;
+    uint64_t totalspace_;
+    uint64_t usedspace_;
+    int role_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_messages_2eproto;
 };
 // -------------------------------------------------------------------
 
-class ServerResponse : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:StorageCloud.ServerResponse) */ {
+class CommandStats final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:StorageCloud.CommandStats) */ {
  public:
-  ServerResponse();
-  virtual ~ServerResponse();
+  inline CommandStats() : CommandStats(nullptr) {}
+  ~CommandStats() override;
+  explicit PROTOBUF_CONSTEXPR CommandStats(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  ServerResponse(const ServerResponse& from);
+  CommandStats(const CommandStats& from);
+  CommandStats(CommandStats&& from) noexcept
+    : CommandStats() {
+    *this = ::std::move(from);
+  }
 
-  inline ServerResponse& operator=(const ServerResponse& from) {
+  inline CommandStats& operator=(const CommandStats& from) {
     CopyFrom(from);
     return *this;
   }
-  #if LANG_CXX11
+  inline CommandStats& operator=(CommandStats&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CommandStats& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CommandStats* internal_default_instance() {
+    return reinterpret_cast<const CommandStats*>(
+               &_CommandStats_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    6;
+
+  friend void swap(CommandStats& a, CommandStats& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CommandStats* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CommandStats* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CommandStats* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CommandStats>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CommandStats& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CommandStats& from) {
+    CommandStats::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CommandStats* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "StorageCloud.CommandStats";
+  }
+  protected:
+  explicit CommandStats(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kCountFieldNumber = 2,
+    kErrorsFieldNumber = 3,
+    kBytesInFieldNumber = 4,
+    kBytesOutFieldNumber = 5,
+    kMeanUsFieldNumber = 6,
+    kP50UsFieldNumber = 7,
+    kP90UsFieldNumber = 8,
+    kP99UsFieldNumber = 9,
+    kMaxUsFieldNumber = 10,
+    kTypeFieldNumber = 1,
+  };
+  // uint64 count = 2;
+  void clear_count();
+  uint64_t count() const;
+  void set_count(uint64_t value);
+  private:
+  uint64_t _internal_count() const;
+  void _internal_set_count(uint64_t value);
+  public:
+
+  // uint64 errors = 3;
+  void clear_errors();
+  uint64_t errors() const;
+  void set_errors(uint64_t value);
+  private:
+  uint64_t _internal_errors() const;
+  void _internal_set_errors(uint64_t value);
+  public:
+
+  // uint64 bytesIn = 4;
+  void clear_bytesin();
+  uint64_t bytesin() const;
+  void set_bytesin(uint64_t value);
+  private:
+  uint64_t _internal_bytesin() const;
+  void _internal_set_bytesin(uint64_t value);
+  public:
+
+  // uint64 bytesOut = 5;
+  void clear_bytesout();
+  uint64_t bytesout() const;
+  void set_bytesout(uint64_t value);
+  private:
+  uint64_t _internal_bytesout() const;
+  void _internal_set_bytesout(uint64_t value);
+  public:
+
+  // uint64 meanUs = 6;
+  void clear_meanus();
+  uint64_t meanus() const;
+  void set_meanus(uint64_t value);
+  private:
+  uint64_t _internal_meanus() const;
+  void _internal_set_meanus(uint64_t value);
+  public:
+
+  // uint64 p50Us = 7;
+  void clear_p50us();
+  uint64_t p50us() const;
+  void set_p50us(uint64_t value);
+  private:
+  uint64_t _internal_p50us() const;
+  void _internal_set_p50us(uint64_t value);
+  public:
+
+  // uint64 p90Us = 8;
+  void clear_p90us();
+  uint64_t p90us() const;
+  void set_p90us(uint64_t value);
+  private:
+  uint64_t _internal_p90us() const;
+  void _internal_set_p90us(uint64_t value);
+  public:
+
+  // uint64 p99Us = 9;
+  void clear_p99us();
+  uint64_t p99us() const;
+  void set_p99us(uint64_t value);
+  private:
+  uint64_t _internal_p99us() const;
+  void _internal_set_p99us(uint64_t value);
+  public:
+
+  // uint64 maxUs = 10;
+  void clear_maxus();
+  uint64_t maxus() const;
+  void set_maxus(uint64_t value);
+  private:
+  uint64_t _internal_maxus() const;
+  void _internal_set_maxus(uint64_t value);
+  public:
+
+  // .StorageCloud.CommandType type = 1;
+  void clear_type();
+  ::StorageCloud::CommandType type() const;
+  void set_type(::StorageCloud::CommandType value);
+  private:
+  ::StorageCloud::CommandType _internal_type() const;
+  void _internal_set_type(::StorageCloud::CommandType value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:StorageCloud.CommandStats)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    uint64_t count_;
+    uint64_t errors_;
+    uint64_t bytesin_;
+    uint64_t bytesout_;
+    uint64_t meanus_;
+    uint64_t p50us_;
+    uint64_t p90us_;
+    uint64_t p99us_;
+    uint64_t maxus_;
+    int type_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_messages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ServerResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:StorageCloud.ServerResponse) */ {
+ public:
+  inline ServerResponse() : ServerResponse(nullptr) {}
+  ~ServerResponse() override;
+  explicit PROTOBUF_CONSTEXPR ServerResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ServerResponse(const ServerResponse& from);
   ServerResponse(ServerResponse&& from) noexcept
     : ServerResponse() {
     *this = ::std::move(from);
   }
 
+  inline ServerResponse& operator=(const ServerResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline ServerResponse& operator=(ServerResponse&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const ServerResponse& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ServerResponse& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const ServerResponse* internal_default_instance() {
     return reinterpret_cast<const ServerResponse*>(
                &_ServerResponse_default_instance_);
   }
-  static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
-    6;
+  static constexpr int kIndexInFileMessages =
+    7;
 
-  void Swap(ServerResponse* other);
   friend void swap(ServerResponse& a, ServerResponse& b) {
     a.Swap(&b);
   }
+  inline void Swap(ServerResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ServerResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline ServerResponse* New() const PROTOBUF_FINAL { return New(NULL); }
-
-  ServerResponse* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
-  void CopyFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
-  void MergeFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
+  ServerResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ServerResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const ServerResponse& from);
-  void MergeFrom(const ServerResponse& from);
-  void Clear() PROTOBUF_FINAL;
-  bool IsInitialized() const PROTOBUF_FINAL;
-
-  size_t ByteSizeLong() const PROTOBUF_FINAL;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) PROTOBUF_FINAL;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const PROTOBUF_FINAL;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const PROTOBUF_FINAL;
-  int GetCachedSize() const PROTOBUF_FINAL { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ServerResponse& from) {
+    ServerResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const PROTOBUF_FINAL;
+  void SetCachedSize(int size) const final;
   void InternalSwap(ServerResponse* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "StorageCloud.ServerResponse";
   }
+  protected:
+  explicit ServerResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const PROTOBUF_FINAL;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kParamsFieldNumber = 2,
+    kListFieldNumber = 3,
+    kFileListFieldNumber = 4,
+    kUserListFieldNumber = 5,
+    kStatsFieldNumber = 7,
+    kDataFieldNumber = 6,
+    kTypeFieldNumber = 1,
+  };
   // repeated .StorageCloud.Param params = 2;
   int params_size() const;
+  private:
+  int _internal_params_size() const;
+  public:
   void clear_params();
-  static const int kParamsFieldNumber = 2;
-  const ::StorageCloud::Param& params(int index) const;
   ::StorageCloud::Param* mutable_params(int index);
-  ::StorageCloud::Param* add_params();
-  ::google::protobuf::RepeatedPtrField< ::StorageCloud::Param >*
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::StorageCloud::Param >*
       mutable_params();
-  const ::google::protobuf::RepeatedPtrField< ::StorageCloud::Param >&
+  private:
+  const ::StorageCloud::Param& _internal_params(int index) const;
+  ::StorageCloud::Param* _internal_add_params();
+  public:
+  const ::StorageCloud::Param& params(int index) const;
+  ::StorageCloud::Param* add_params();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::StorageCloud::Param >&
       params() const;
 
   // repeated string list = 3;
   int list_size() const;
+  private:
+  int _internal_list_size() const;
+  public:
   void clear_list();
-  static const int kListFieldNumber = 3;
-  const ::std::string& list(int index) const;
-  ::std::string* mutable_list(int index);
-  void set_list(int index, const ::std::string& value);
-  #if LANG_CXX11
-  void set_list(int index, ::std::string&& value);
-  #endif
+  const std::string& list(int index) const;
+  std::string* mutable_list(int index);
+  void set_list(int index, const std::string& value);
+  void set_list(int index, std::string&& value);
   void set_list(int index, const char* value);
   void set_list(int index, const char* value, size_t size);
-  ::std::string* add_list();
-  void add_list(const ::std::string& value);
-  #if LANG_CXX11
-  void add_list(::std::string&& value);
-  #endif
+  std::string* add_list();
+  void add_list(const std::string& value);
+  void add_list(std::string&& value);
   void add_list(const char* value);
   void add_list(const char* value, size_t size);
-  const ::google::protobuf::RepeatedPtrField< ::std::string>& list() const;
-  ::google::protobuf::RepeatedPtrField< ::std::string>* mutable_list();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& list() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_list();
+  private:
+  const std::string& _internal_list(int index) const;
+  std::string* _internal_add_list();
+  public:
 
   // repeated .StorageCloud.File fileList = 4;
   int filelist_size() const;
+  private:
+  int _internal_filelist_size() const;
+  public:
   void clear_filelist();
-  static const int kFileListFieldNumber = 4;
-  const ::StorageCloud::File& filelist(int index) const;
   ::StorageCloud::File* mutable_filelist(int index);
-  ::StorageCloud::File* add_filelist();
-  ::google::protobuf::RepeatedPtrField< ::StorageCloud::File >*
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::StorageCloud::File >*
       mutable_filelist();
-  const ::google::protobuf::RepeatedPtrField< ::StorageCloud::File >&
+  private:
+  const ::StorageCloud::File& _internal_filelist(int index) const;
+  ::StorageCloud::File* _internal_add_filelist();
+  public:
+  const ::StorageCloud::File& filelist(int index) const;
+  ::StorageCloud::File* add_filelist();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::StorageCloud::File >&
       filelist() const;
 
   // repeated .StorageCloud.UserDetails userList = 5;
   int userlist_size() const;
+  private:
+  int _internal_userlist_size() const;
+  public:
   void clear_userlist();
-  static const int kUserListFieldNumber = 5;
-  const ::StorageCloud::UserDetails& userlist(int index) const;
   ::StorageCloud::UserDetails* mutable_userlist(int index);
-  ::StorageCloud::UserDetails* add_userlist();
-  ::google::protobuf::RepeatedPtrField< ::StorageCloud::UserDetails >*
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::StorageCloud::UserDetails >*
       mutable_userlist();
-  const ::google::protobuf::RepeatedPtrField< ::StorageCloud::UserDetails >&
+  private:
+  const ::StorageCloud::UserDetails& _internal_userlist(int index) const;
+  ::StorageCloud::UserDetails* _internal_add_userlist();
+  public:
+  const ::StorageCloud::UserDetails& userlist(int index) const;
+  ::StorageCloud::UserDetails* add_userlist();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::StorageCloud::UserDetails >&
       userlist() const;
 
+  // repeated .StorageCloud.CommandStats stats = 7;
+  int stats_size() const;
+  private:
+  int _internal_stats_size() const;
+  public:
+  void clear_stats();
+  ::StorageCloud::CommandStats* mutable_stats(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::StorageCloud::CommandStats >*
+      mutable_stats();
+  private:
+  const ::StorageCloud::CommandStats& _internal_stats(int index) const;
+  ::StorageCloud::CommandStats* _internal_add_stats();
+  public:
+  const ::StorageCloud::CommandStats& stats(int index) const;
+  ::StorageCloud::CommandStats* add_stats();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::StorageCloud::CommandStats >&
+      stats() const;
+
   // bytes data = 6;
   void clear_data();
-  static const int kDataFieldNumber = 6;
-  const ::std::string& data() const;
-  void set_data(const ::std::string& value);
-  #if LANG_CXX11
-  void set_data(::std::string&& value);
-  #endif
-  void set_data(const char* value);
-  void set_data(const void* value, size_t size);
-  ::std::string* mutable_data();
-  ::std::string* release_data();
-  void set_allocated_data(::std::string* data);
+  const std::string& data() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_data(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_data();
+  PROTOBUF_NODISCARD std::string* release_data();
+  void set_allocated_data(std::string* data);
+  private:
+  const std::string& _internal_data() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_data(const std::string& value);
+  std::string* _internal_mutable_data();
+  public:
 
   // .StorageCloud.ResponseType type = 1;
   void clear_type();
-  static const int kTypeFieldNumber = 1;
   ::StorageCloud::ResponseType type() const;
   void set_type(::StorageCloud::ResponseType value);
+  private:
+  ::StorageCloud::ResponseType _internal_type() const;
+  void _internal_set_type(::StorageCloud::ResponseType value);
+  public:
 
   // @@protoc_insertion_point(class_scope:StorageCloud.ServerResponse)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::RepeatedPtrField< ::StorageCloud::Param > params_;
-  ::google::protobuf::RepeatedPtrField< ::std::string> list_;
-  ::google::protobuf::RepeatedPtrField< ::StorageCloud::File > filelist_;
-  ::google::protobuf::RepeatedPtrField< ::StorageCloud::UserDetails > userlist_;
-  ::google::protobuf::internal::ArenaStringPtr data_;
-  int type_;
-  mutable int _cached_size_;
-  friend struct ::protobuf_messages_2eproto::TableStruct;
-  friend void ::protobuf_messages_2eproto::InitDefaultsServerResponseImpl();
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::StorageCloud::Param > params_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> list_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::StorageCloud::File > filelist_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::StorageCloud::UserDetails > userlist_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::StorageCloud::CommandStats > stats_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr data_;
+    int type_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_messages_2eproto;
 };
 // ===================================================================
 
@@ -1377,272 +2141,242 @@ class ServerResponse : public ::google::protobuf::Message /* @@protoc_insertion_
 
 // string paramId = 1;
 inline void Param::clear_paramid() {
-  paramid_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.paramid_.ClearToEmpty();
 }
-inline const ::std::string& Param::paramid() const {
+inline const std::string& Param::paramid() const {
   // @@protoc_insertion_point(field_get:StorageCloud.Param.paramId)
-  return paramid_.GetNoArena();
+  return _internal_paramid();
 }
-inline void Param::set_paramid(const ::std::string& value) {
-  
-  paramid_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Param::set_paramid(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.paramid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:StorageCloud.Param.paramId)
 }
-#if LANG_CXX11
-inline void Param::set_paramid(::std::string&& value) {
-  
-  paramid_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:StorageCloud.Param.paramId)
+inline std::string* Param::mutable_paramid() {
+  std::string* _s = _internal_mutable_paramid();
+  // @@protoc_insertion_point(field_mutable:StorageCloud.Param.paramId)
+  return _s;
 }
-#endif
-inline void Param::set_paramid(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
-  
-  paramid_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:StorageCloud.Param.paramId)
+inline const std::string& Param::_internal_paramid() const {
+  return _impl_.paramid_.Get();
 }
-inline void Param::set_paramid(const char* value, size_t size) {
+inline void Param::_internal_set_paramid(const std::string& value) {
   
-  paramid_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:StorageCloud.Param.paramId)
+  _impl_.paramid_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* Param::mutable_paramid() {
+inline std::string* Param::_internal_mutable_paramid() {
   
-  // @@protoc_insertion_point(field_mutable:StorageCloud.Param.paramId)
-  return paramid_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.paramid_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* Param::release_paramid() {
+inline std::string* Param::release_paramid() {
   // @@protoc_insertion_point(field_release:StorageCloud.Param.paramId)
-  
-  return paramid_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.paramid_.Release();
 }
-inline void Param::set_allocated_paramid(::std::string* paramid) {
-  if (paramid != NULL) {
+inline void Param::set_allocated_paramid(std::string* paramid) {
+  if (paramid != nullptr) {
     
   } else {
     
   }
-  paramid_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), paramid);
+  _impl_.paramid_.SetAllocated(paramid, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.paramid_.IsDefault()) {
+    _impl_.paramid_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:StorageCloud.Param.paramId)
 }
 
 // string SParamVal = 2;
-inline bool Param::has_sparamval() const {
+inline bool Param::_internal_has_sparamval() const {
   return value_case() == kSParamVal;
 }
+inline bool Param::has_sparamval() const {
+  return _internal_has_sparamval();
+}
 inline void Param::set_has_sparamval() {
-  _oneof_case_[0] = kSParamVal;
+  _impl_._oneof_case_[0] = kSParamVal;
 }
 inline void Param::clear_sparamval() {
-  if (has_sparamval()) {
-    value_.sparamval_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (_internal_has_sparamval()) {
+    _impl_.value_.sparamval_.Destroy();
     clear_has_value();
   }
 }
-inline const ::std::string& Param::sparamval() const {
+inline const std::string& Param::sparamval() const {
   // @@protoc_insertion_point(field_get:StorageCloud.Param.SParamVal)
-  if (has_sparamval()) {
-    return value_.sparamval_.GetNoArena();
-  }
-  return *&::google::protobuf::internal::GetEmptyStringAlreadyInited();
+  return _internal_sparamval();
 }
-inline void Param::set_sparamval(const ::std::string& value) {
-  // @@protoc_insertion_point(field_set:StorageCloud.Param.SParamVal)
-  if (!has_sparamval()) {
+template <typename ArgT0, typename... ArgT>
+inline void Param::set_sparamval(ArgT0&& arg0, ArgT... args) {
+  if (!_internal_has_sparamval()) {
     clear_value();
     set_has_sparamval();
-    value_.sparamval_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+    _impl_.value_.sparamval_.InitDefault();
   }
-  value_.sparamval_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  _impl_.value_.sparamval_.Set( static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:StorageCloud.Param.SParamVal)
 }
-#if LANG_CXX11
-inline void Param::set_sparamval(::std::string&& value) {
-  // @@protoc_insertion_point(field_set:StorageCloud.Param.SParamVal)
-  if (!has_sparamval()) {
-    clear_value();
-    set_has_sparamval();
-    value_.sparamval_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  }
-  value_.sparamval_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:StorageCloud.Param.SParamVal)
+inline std::string* Param::mutable_sparamval() {
+  std::string* _s = _internal_mutable_sparamval();
+  // @@protoc_insertion_point(field_mutable:StorageCloud.Param.SParamVal)
+  return _s;
 }
-#endif
-inline void Param::set_sparamval(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
-  if (!has_sparamval()) {
-    clear_value();
-    set_has_sparamval();
-    value_.sparamval_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline const std::string& Param::_internal_sparamval() const {
+  if (_internal_has_sparamval()) {
+    return _impl_.value_.sparamval_.Get();
   }
-  value_.sparamval_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:StorageCloud.Param.SParamVal)
+  return ::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited();
 }
-inline void Param::set_sparamval(const char* value, size_t size) {
-  if (!has_sparamval()) {
+inline void Param::_internal_set_sparamval(const std::string& value) {
+  if (!_internal_has_sparamval()) {
     clear_value();
     set_has_sparamval();
-    value_.sparamval_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+    _impl_.value_.sparamval_.InitDefault();
   }
-  value_.sparamval_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:StorageCloud.Param.SParamVal)
+  _impl_.value_.sparamval_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* Param::mutable_sparamval() {
-  if (!has_sparamval()) {
+inline std::string* Param::_internal_mutable_sparamval() {
+  if (!_internal_has_sparamval()) {
     clear_value();
     set_has_sparamval();
-    value_.sparamval_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+    _impl_.value_.sparamval_.InitDefault();
   }
-  // @@protoc_insertion_point(field_mutable:StorageCloud.Param.SParamVal)
-  return value_.sparamval_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.value_.sparamval_.Mutable(      GetArenaForAllocation());
 }
-inline ::std::string* Param::release_sparamval() {
+inline std::string* Param::release_sparamval() {
   // @@protoc_insertion_point(field_release:StorageCloud.Param.SParamVal)
-  if (has_sparamval()) {
+  if (_internal_has_sparamval()) {
     clear_has_value();
-    return value_.sparamval_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+    return _impl_.value_.sparamval_.Release();
   } else {
-    return NULL;
+    return nullptr;
   }
 }
-inline void Param::set_allocated_sparamval(::std::string* sparamval) {
-  if (!has_sparamval()) {
-    value_.sparamval_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline void Param::set_allocated_sparamval(std::string* sparamval) {
+  if (has_value()) {
+    clear_value();
   }
-  clear_value();
-  if (sparamval != NULL) {
+  if (sparamval != nullptr) {
     set_has_sparamval();
-    value_.sparamval_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-        sparamval);
+    _impl_.value_.sparamval_.InitAllocated(sparamval, GetArenaForAllocation());
   }
   // @@protoc_insertion_point(field_set_allocated:StorageCloud.Param.SParamVal)
 }
 
 // int64 IParamVal = 3;
-inline bool Param::has_iparamval() const {
+inline bool Param::_internal_has_iparamval() const {
   return value_case() == kIParamVal;
 }
+inline bool Param::has_iparamval() const {
+  return _internal_has_iparamval();
+}
 inline void Param::set_has_iparamval() {
-  _oneof_case_[0] = kIParamVal;
+  _impl_._oneof_case_[0] = kIParamVal;
 }
 inline void Param::clear_iparamval() {
-  if (has_iparamval()) {
-    value_.iparamval_ = GOOGLE_LONGLONG(0);
+  if (_internal_has_iparamval()) {
+    _impl_.value_.iparamval_ = int64_t{0};
     clear_has_value();
   }
 }
-inline ::google::protobuf::int64 Param::iparamval() const {
-  // @@protoc_insertion_point(field_get:StorageCloud.Param.IParamVal)
-  if (has_iparamval()) {
-    return value_.iparamval_;
+inline int64_t Param::_internal_iparamval() const {
+  if (_internal_has_iparamval()) {
+    return _impl_.value_.iparamval_;
   }
-  return GOOGLE_LONGLONG(0);
+  return int64_t{0};
 }
-inline void Param::set_iparamval(::google::protobuf::int64 value) {
-  if (!has_iparamval()) {
+inline void Param::_internal_set_iparamval(int64_t value) {
+  if (!_internal_has_iparamval()) {
     clear_value();
     set_has_iparamval();
   }
-  value_.iparamval_ = value;
+  _impl_.value_.iparamval_ = value;
+}
+inline int64_t Param::iparamval() const {
+  // @@protoc_insertion_point(field_get:StorageCloud.Param.IParamVal)
+  return _internal_iparamval();
+}
+inline void Param::set_iparamval(int64_t value) {
+  _internal_set_iparamval(value);
   // @@protoc_insertion_point(field_set:StorageCloud.Param.IParamVal)
 }
 
 // bytes BParamVal = 4;
-inline bool Param::has_bparamval() const {
+inline bool Param::_internal_has_bparamval() const {
   return value_case() == kBParamVal;
 }
+inline bool Param::has_bparamval() const {
+  return _internal_has_bparamval();
+}
 inline void Param::set_has_bparamval() {
-  _oneof_case_[0] = kBParamVal;
+  _impl_._oneof_case_[0] = kBParamVal;
 }
 inline void Param::clear_bparamval() {
-  if (has_bparamval()) {
-    value_.bparamval_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (_internal_has_bparamval()) {
+    _impl_.value_.bparamval_.Destroy();
     clear_has_value();
   }
 }
-inline const ::std::string& Param::bparamval() const {
+inline const std::string& Param::bparamval() const {
   // @@protoc_insertion_point(field_get:StorageCloud.Param.BParamVal)
-  if (has_bparamval()) {
-    return value_.bparamval_.GetNoArena();
-  }
-  return *&::google::protobuf::internal::GetEmptyStringAlreadyInited();
+  return _internal_bparamval();
 }
-inline void Param::set_bparamval(const ::std::string& value) {
-  // @@protoc_insertion_point(field_set:StorageCloud.Param.BParamVal)
-  if (!has_bparamval()) {
+template <typename ArgT0, typename... ArgT>
+inline void Param::set_bparamval(ArgT0&& arg0, ArgT... args) {
+  if (!_internal_has_bparamval()) {
     clear_value();
     set_has_bparamval();
-    value_.bparamval_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+    _impl_.value_.bparamval_.InitDefault();
   }
-  value_.bparamval_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  _impl_.value_.bparamval_.SetBytes( static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:StorageCloud.Param.BParamVal)
 }
-#if LANG_CXX11
-inline void Param::set_bparamval(::std::string&& value) {
-  // @@protoc_insertion_point(field_set:StorageCloud.Param.BParamVal)
-  if (!has_bparamval()) {
-    clear_value();
-    set_has_bparamval();
-    value_.bparamval_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  }
-  value_.bparamval_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:StorageCloud.Param.BParamVal)
+inline std::string* Param::mutable_bparamval() {
+  std::string* _s = _internal_mutable_bparamval();
+  // @@protoc_insertion_point(field_mutable:StorageCloud.Param.BParamVal)
+  return _s;
 }
-#endif
-inline void Param::set_bparamval(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
-  if (!has_bparamval()) {
-    clear_value();
-    set_has_bparamval();
-    value_.bparamval_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline const std::string& Param::_internal_bparamval() const {
+  if (_internal_has_bparamval()) {
+    return _impl_.value_.bparamval_.Get();
   }
-  value_.bparamval_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:StorageCloud.Param.BParamVal)
+  return ::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited();
 }
-inline void Param::set_bparamval(const void* value, size_t size) {
-  if (!has_bparamval()) {
+inline void Param::_internal_set_bparamval(const std::string& value) {
+  if (!_internal_has_bparamval()) {
     clear_value();
     set_has_bparamval();
-    value_.bparamval_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+    _impl_.value_.bparamval_.InitDefault();
   }
-  value_.bparamval_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:StorageCloud.Param.BParamVal)
+  _impl_.value_.bparamval_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* Param::mutable_bparamval() {
-  if (!has_bparamval()) {
+inline std::string* Param::_internal_mutable_bparamval() {
+  if (!_internal_has_bparamval()) {
     clear_value();
     set_has_bparamval();
-    value_.bparamval_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+    _impl_.value_.bparamval_.InitDefault();
   }
-  // @@protoc_insertion_point(field_mutable:StorageCloud.Param.BParamVal)
-  return value_.bparamval_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.value_.bparamval_.Mutable(      GetArenaForAllocation());
 }
-inline ::std::string* Param::release_bparamval() {
+inline std::string* Param::release_bparamval() {
   // @@protoc_insertion_point(field_release:StorageCloud.Param.BParamVal)
-  if (has_bparamval()) {
+  if (_internal_has_bparamval()) {
     clear_has_value();
-    return value_.bparamval_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+    return _impl_.value_.bparamval_.Release();
   } else {
-    return NULL;
+    return nullptr;
   }
 }
-inline void Param::set_allocated_bparamval(::std::string* bparamval) {
-  if (!has_bparamval()) {
-    value_.bparamval_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline void Param::set_allocated_bparamval(std::string* bparamval) {
+  if (has_value()) {
+    clear_value();
   }
-  clear_value();
-  if (bparamval != NULL) {
+  if (bparamval != nullptr) {
     set_has_bparamval();
-    value_.bparamval_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-        bparamval);
+    _impl_.value_.bparamval_.InitAllocated(bparamval, GetArenaForAllocation());
   }
   // @@protoc_insertion_point(field_set_allocated:StorageCloud.Param.BParamVal)
 }
@@ -1651,10 +2385,10 @@ inline bool Param::has_value() const {
   return value_case() != VALUE_NOT_SET;
 }
 inline void Param::clear_has_value() {
-  _oneof_case_[0] = VALUE_NOT_SET;
+  _impl_._oneof_case_[0] = VALUE_NOT_SET;
 }
 inline Param::ValueCase Param::value_case() const {
-  return Param::ValueCase(_oneof_case_[0]);
+  return Param::ValueCase(_impl_._oneof_case_[0]);
 }
 // -------------------------------------------------------------------
 
@@ -1662,149 +2396,161 @@ inline Param::ValueCase Param::value_case() const {
 
 // uint64 dataSize = 1;
 inline void EncodedMessage::clear_datasize() {
-  datasize_ = GOOGLE_ULONGLONG(0);
+  _impl_.datasize_ = uint64_t{0u};
 }
-inline ::google::protobuf::uint64 EncodedMessage::datasize() const {
+inline uint64_t EncodedMessage::_internal_datasize() const {
+  return _impl_.datasize_;
+}
+inline uint64_t EncodedMessage::datasize() const {
   // @@protoc_insertion_point(field_get:StorageCloud.EncodedMessage.dataSize)
-  return datasize_;
+  return _internal_datasize();
 }
-inline void EncodedMessage::set_datasize(::google::protobuf::uint64 value) {
+inline void EncodedMessage::_internal_set_datasize(uint64_t value) {
   
-  datasize_ = value;
+  _impl_.datasize_ = value;
+}
+inline void EncodedMessage::set_datasize(uint64_t value) {
+  _internal_set_datasize(value);
   // @@protoc_insertion_point(field_set:StorageCloud.EncodedMessage.dataSize)
 }
 
 // .StorageCloud.HashAlgorithm hashAlgorithm = 2;
 inline void EncodedMessage::clear_hashalgorithm() {
-  hashalgorithm_ = 0;
+  _impl_.hashalgorithm_ = 0;
+}
+inline ::StorageCloud::HashAlgorithm EncodedMessage::_internal_hashalgorithm() const {
+  return static_cast< ::StorageCloud::HashAlgorithm >(_impl_.hashalgorithm_);
 }
 inline ::StorageCloud::HashAlgorithm EncodedMessage::hashalgorithm() const {
   // @@protoc_insertion_point(field_get:StorageCloud.EncodedMessage.hashAlgorithm)
-  return static_cast< ::StorageCloud::HashAlgorithm >(hashalgorithm_);
+  return _internal_hashalgorithm();
 }
-inline void EncodedMessage::set_hashalgorithm(::StorageCloud::HashAlgorithm value) {
+inline void EncodedMessage::_internal_set_hashalgorithm(::StorageCloud::HashAlgorithm value) {
   
-  hashalgorithm_ = value;
+  _impl_.hashalgorithm_ = value;
+}
+inline void EncodedMessage::set_hashalgorithm(::StorageCloud::HashAlgorithm value) {
+  _internal_set_hashalgorithm(value);
   // @@protoc_insertion_point(field_set:StorageCloud.EncodedMessage.hashAlgorithm)
 }
 
 // bytes hash = 3;
 inline void EncodedMessage::clear_hash() {
-  hash_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.hash_.ClearToEmpty();
 }
-inline const ::std::string& EncodedMessage::hash() const {
+inline const std::string& EncodedMessage::hash() const {
   // @@protoc_insertion_point(field_get:StorageCloud.EncodedMessage.hash)
-  return hash_.GetNoArena();
+  return _internal_hash();
 }
-inline void EncodedMessage::set_hash(const ::std::string& value) {
-  
-  hash_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void EncodedMessage::set_hash(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.hash_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:StorageCloud.EncodedMessage.hash)
 }
-#if LANG_CXX11
-inline void EncodedMessage::set_hash(::std::string&& value) {
-  
-  hash_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:StorageCloud.EncodedMessage.hash)
+inline std::string* EncodedMessage::mutable_hash() {
+  std::string* _s = _internal_mutable_hash();
+  // @@protoc_insertion_point(field_mutable:StorageCloud.EncodedMessage.hash)
+  return _s;
 }
-#endif
-inline void EncodedMessage::set_hash(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
-  
-  hash_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:StorageCloud.EncodedMessage.hash)
+inline const std::string& EncodedMessage::_internal_hash() const {
+  return _impl_.hash_.Get();
 }
-inline void EncodedMessage::set_hash(const void* value, size_t size) {
+inline void EncodedMessage::_internal_set_hash(const std::string& value) {
   
-  hash_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:StorageCloud.EncodedMessage.hash)
+  _impl_.hash_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* EncodedMessage::mutable_hash() {
+inline std::string* EncodedMessage::_internal_mutable_hash() {
   
-  // @@protoc_insertion_point(field_mutable:StorageCloud.EncodedMessage.hash)
-  return hash_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.hash_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* EncodedMessage::release_hash() {
+inline std::string* EncodedMessage::release_hash() {
   // @@protoc_insertion_point(field_release:StorageCloud.EncodedMessage.hash)
-  
-  return hash_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.hash_.Release();
 }
-inline void EncodedMessage::set_allocated_hash(::std::string* hash) {
-  if (hash != NULL) {
+inline void EncodedMessage::set_allocated_hash(std::string* hash) {
+  if (hash != nullptr) {
     
   } else {
     
   }
-  hash_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), hash);
+  _impl_.hash_.SetAllocated(hash, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.hash_.IsDefault()) {
+    _impl_.hash_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:StorageCloud.EncodedMessage.hash)
 }
 
 // .StorageCloud.MessageType type = 4;
 inline void EncodedMessage::clear_type() {
-  type_ = 0;
+  _impl_.type_ = 0;
+}
+inline ::StorageCloud::MessageType EncodedMessage::_internal_type() const {
+  return static_cast< ::StorageCloud::MessageType >(_impl_.type_);
 }
 inline ::StorageCloud::MessageType EncodedMessage::type() const {
   // @@protoc_insertion_point(field_get:StorageCloud.EncodedMessage.type)
-  return static_cast< ::StorageCloud::MessageType >(type_);
+  return _internal_type();
 }
-inline void EncodedMessage::set_type(::StorageCloud::MessageType value) {
+inline void EncodedMessage::_internal_set_type(::StorageCloud::MessageType value) {
   
-  type_ = value;
+  _impl_.type_ = value;
+}
+inline void EncodedMessage::set_type(::StorageCloud::MessageType value) {
+  _internal_set_type(value);
   // @@protoc_insertion_point(field_set:StorageCloud.EncodedMessage.type)
 }
 
 // bytes data = 5;
 inline void EncodedMessage::clear_data() {
-  data_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.data_.ClearToEmpty();
 }
-inline const ::std::string& EncodedMessage::data() const {
+inline const std::string& EncodedMessage::data() const {
   // @@protoc_insertion_point(field_get:StorageCloud.EncodedMessage.data)
-  return data_.GetNoArena();
+  return _internal_data();
 }
-inline void EncodedMessage::set_data(const ::std::string& value) {
-  
-  data_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void EncodedMessage::set_data(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.data_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:StorageCloud.EncodedMessage.data)
 }
-#if LANG_CXX11
-inline void EncodedMessage::set_data(::std::string&& value) {
-  
-  data_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:StorageCloud.EncodedMessage.data)
+inline std::string* EncodedMessage::mutable_data() {
+  std::string* _s = _internal_mutable_data();
+  // @@protoc_insertion_point(field_mutable:StorageCloud.EncodedMessage.data)
+  return _s;
 }
-#endif
-inline void EncodedMessage::set_data(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
-  
-  data_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:StorageCloud.EncodedMessage.data)
+inline const std::string& EncodedMessage::_internal_data() const {
+  return _impl_.data_.Get();
 }
-inline void EncodedMessage::set_data(const void* value, size_t size) {
+inline void EncodedMessage::_internal_set_data(const std::string& value) {
   
-  data_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:StorageCloud.EncodedMessage.data)
+  _impl_.data_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* EncodedMessage::mutable_data() {
+inline std::string* EncodedMessage::_internal_mutable_data() {
   
-  // @@protoc_insertion_point(field_mutable:StorageCloud.EncodedMessage.data)
-  return data_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.data_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* EncodedMessage::release_data() {
+inline std::string* EncodedMessage::release_data() {
   // @@protoc_insertion_point(field_release:StorageCloud.EncodedMessage.data)
-  
-  return data_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.data_.Release();
 }
-inline void EncodedMessage::set_allocated_data(::std::string* data) {
-  if (data != NULL) {
+inline void EncodedMessage::set_allocated_data(std::string* data) {
+  if (data != nullptr) {
     
   } else {
     
   }
-  data_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), data);
+  _impl_.data_.SetAllocated(data, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.data_.IsDefault()) {
+    _impl_.data_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:StorageCloud.EncodedMessage.data)
 }
 
@@ -1814,167 +2560,186 @@ inline void EncodedMessage::set_allocated_data(::std::string* data) {
 
 // .StorageCloud.CommandType type = 1;
 inline void Command::clear_type() {
-  type_ = 0;
+  _impl_.type_ = 0;
+}
+inline ::StorageCloud::CommandType Command::_internal_type() const {
+  return static_cast< ::StorageCloud::CommandType >(_impl_.type_);
 }
 inline ::StorageCloud::CommandType Command::type() const {
   // @@protoc_insertion_point(field_get:StorageCloud.Command.type)
-  return static_cast< ::StorageCloud::CommandType >(type_);
+  return _internal_type();
 }
-inline void Command::set_type(::StorageCloud::CommandType value) {
+inline void Command::_internal_set_type(::StorageCloud::CommandType value) {
   
-  type_ = value;
+  _impl_.type_ = value;
+}
+inline void Command::set_type(::StorageCloud::CommandType value) {
+  _internal_set_type(value);
   // @@protoc_insertion_point(field_set:StorageCloud.Command.type)
 }
 
 // repeated .StorageCloud.Param params = 2;
+inline int Command::_internal_params_size() const {
+  return _impl_.params_.size();
+}
 inline int Command::params_size() const {
-  return params_.size();
+  return _internal_params_size();
 }
 inline void Command::clear_params() {
-  params_.Clear();
-}
-inline const ::StorageCloud::Param& Command::params(int index) const {
-  // @@protoc_insertion_point(field_get:StorageCloud.Command.params)
-  return params_.Get(index);
+  _impl_.params_.Clear();
 }
 inline ::StorageCloud::Param* Command::mutable_params(int index) {
   // @@protoc_insertion_point(field_mutable:StorageCloud.Command.params)
-  return params_.Mutable(index);
+  return _impl_.params_.Mutable(index);
 }
-inline ::StorageCloud::Param* Command::add_params() {
-  // @@protoc_insertion_point(field_add:StorageCloud.Command.params)
-  return params_.Add();
-}
-inline ::google::protobuf::RepeatedPtrField< ::StorageCloud::Param >*
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::StorageCloud::Param >*
 Command::mutable_params() {
   // @@protoc_insertion_point(field_mutable_list:StorageCloud.Command.params)
-  return &params_;
+  return &_impl_.params_;
+}
+inline const ::StorageCloud::Param& Command::_internal_params(int index) const {
+  return _impl_.params_.Get(index);
+}
+inline const ::StorageCloud::Param& Command::params(int index) const {
+  // @@protoc_insertion_point(field_get:StorageCloud.Command.params)
+  return _internal_params(index);
+}
+inline ::StorageCloud::Param* Command::_internal_add_params() {
+  return _impl_.params_.Add();
 }
-inline const ::google::protobuf::RepeatedPtrField< ::StorageCloud::Param >&
+inline ::StorageCloud::Param* Command::add_params() {
+  ::StorageCloud::Param* _add = _internal_add_params();
+  // @@protoc_insertion_point(field_add:StorageCloud.Command.params)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::StorageCloud::Param >&
 Command::params() const {
   // @@protoc_insertion_point(field_list:StorageCloud.Command.params)
-  return params_;
+  return _impl_.params_;
 }
 
 // repeated string list = 3;
+inline int Command::_internal_list_size() const {
+  return _impl_.list_.size();
+}
 inline int Command::list_size() const {
-  return list_.size();
+  return _internal_list_size();
 }
 inline void Command::clear_list() {
-  list_.Clear();
+  _impl_.list_.Clear();
+}
+inline std::string* Command::add_list() {
+  std::string* _s = _internal_add_list();
+  // @@protoc_insertion_point(field_add_mutable:StorageCloud.Command.list)
+  return _s;
+}
+inline const std::string& Command::_internal_list(int index) const {
+  return _impl_.list_.Get(index);
 }
-inline const ::std::string& Command::list(int index) const {
+inline const std::string& Command::list(int index) const {
   // @@protoc_insertion_point(field_get:StorageCloud.Command.list)
-  return list_.Get(index);
+  return _internal_list(index);
 }
-inline ::std::string* Command::mutable_list(int index) {
+inline std::string* Command::mutable_list(int index) {
   // @@protoc_insertion_point(field_mutable:StorageCloud.Command.list)
-  return list_.Mutable(index);
+  return _impl_.list_.Mutable(index);
 }
-inline void Command::set_list(int index, const ::std::string& value) {
+inline void Command::set_list(int index, const std::string& value) {
+  _impl_.list_.Mutable(index)->assign(value);
   // @@protoc_insertion_point(field_set:StorageCloud.Command.list)
-  list_.Mutable(index)->assign(value);
 }
-#if LANG_CXX11
-inline void Command::set_list(int index, ::std::string&& value) {
+inline void Command::set_list(int index, std::string&& value) {
+  _impl_.list_.Mutable(index)->assign(std::move(value));
   // @@protoc_insertion_point(field_set:StorageCloud.Command.list)
-  list_.Mutable(index)->assign(std::move(value));
 }
-#endif
 inline void Command::set_list(int index, const char* value) {
-  GOOGLE_DCHECK(value != NULL);
-  list_.Mutable(index)->assign(value);
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.list_.Mutable(index)->assign(value);
   // @@protoc_insertion_point(field_set_char:StorageCloud.Command.list)
 }
 inline void Command::set_list(int index, const char* value, size_t size) {
-  list_.Mutable(index)->assign(
+  _impl_.list_.Mutable(index)->assign(
     reinterpret_cast<const char*>(value), size);
   // @@protoc_insertion_point(field_set_pointer:StorageCloud.Command.list)
 }
-inline ::std::string* Command::add_list() {
-  // @@protoc_insertion_point(field_add_mutable:StorageCloud.Command.list)
-  return list_.Add();
+inline std::string* Command::_internal_add_list() {
+  return _impl_.list_.Add();
 }
-inline void Command::add_list(const ::std::string& value) {
-  list_.Add()->assign(value);
+inline void Command::add_list(const std::string& value) {
+  _impl_.list_.Add()->assign(value);
   // @@protoc_insertion_point(field_add:StorageCloud.Command.list)
 }
-#if LANG_CXX11
-inline void Command::add_list(::std::string&& value) {
-  list_.Add(std::move(value));
+inline void Command::add_list(std::string&& value) {
+  _impl_.list_.Add(std::move(value));
   // @@protoc_insertion_point(field_add:StorageCloud.Command.list)
 }
-#endif
 inline void Command::add_list(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
-  list_.Add()->assign(value);
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.list_.Add()->assign(value);
   // @@protoc_insertion_point(field_add_char:StorageCloud.Command.list)
 }
 inline void Command::add_list(const char* value, size_t size) {
-  list_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  _impl_.list_.Add()->assign(reinterpret_cast<const char*>(value), size);
   // @@protoc_insertion_point(field_add_pointer:StorageCloud.Command.list)
 }
-inline const ::google::protobuf::RepeatedPtrField< ::std::string>&
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
 Command::list() const {
   // @@protoc_insertion_point(field_list:StorageCloud.Command.list)
-  return list_;
+  return _impl_.list_;
 }
-inline ::google::protobuf::RepeatedPtrField< ::std::string>*
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
 Command::mutable_list() {
   // @@protoc_insertion_point(field_mutable_list:StorageCloud.Command.list)
-  return &list_;
+  return &_impl_.list_;
 }
 
 // bytes data = 4;
 inline void Command::clear_data() {
-  data_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.data_.ClearToEmpty();
 }
-inline const ::std::string& Command::data() const {
+inline const std::string& Command::data() const {
   // @@protoc_insertion_point(field_get:StorageCloud.Command.data)
-  return data_.GetNoArena();
+  return _internal_data();
 }
-inline void Command::set_data(const ::std::string& value) {
-  
-  data_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Command::set_data(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.data_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:StorageCloud.Command.data)
 }
-#if LANG_CXX11
-inline void Command::set_data(::std::string&& value) {
-  
-  data_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:StorageCloud.Command.data)
+inline std::string* Command::mutable_data() {
+  std::string* _s = _internal_mutable_data();
+  // @@protoc_insertion_point(field_mutable:StorageCloud.Command.data)
+  return _s;
 }
-#endif
-inline void Command::set_data(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
-  
-  data_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:StorageCloud.Command.data)
+inline const std::string& Command::_internal_data() const {
+  return _impl_.data_.Get();
 }
-inline void Command::set_data(const void* value, size_t size) {
+inline void Command::_internal_set_data(const std::string& value) {
   
-  data_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:StorageCloud.Command.data)
+  _impl_.data_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* Command::mutable_data() {
+inline std::string* Command::_internal_mutable_data() {
   
-  // @@protoc_insertion_point(field_mutable:StorageCloud.Command.data)
-  return data_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.data_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* Command::release_data() {
+inline std::string* Command::release_data() {
   // @@protoc_insertion_point(field_release:StorageCloud.Command.data)
-  
-  return data_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.data_.Release();
 }
-inline void Command::set_allocated_data(::std::string* data) {
-  if (data != NULL) {
+inline void Command::set_allocated_data(std::string* data) {
+  if (data != nullptr) {
     
   } else {
     
   }
-  data_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), data);
+  _impl_.data_.SetAllocated(data, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.data_.IsDefault()) {
+    _impl_.data_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:StorageCloud.Command.data)
 }
 
@@ -1984,269 +2749,281 @@ inline void Command::set_allocated_data(::std::string* data) {
 
 // string filename = 1;
 inline void File::clear_filename() {
-  filename_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.filename_.ClearToEmpty();
 }
-inline const ::std::string& File::filename() const {
+inline const std::string& File::filename() const {
   // @@protoc_insertion_point(field_get:StorageCloud.File.filename)
-  return filename_.GetNoArena();
+  return _internal_filename();
 }
-inline void File::set_filename(const ::std::string& value) {
-  
-  filename_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void File::set_filename(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.filename_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:StorageCloud.File.filename)
 }
-#if LANG_CXX11
-inline void File::set_filename(::std::string&& value) {
-  
-  filename_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:StorageCloud.File.filename)
+inline std::string* File::mutable_filename() {
+  std::string* _s = _internal_mutable_filename();
+  // @@protoc_insertion_point(field_mutable:StorageCloud.File.filename)
+  return _s;
 }
-#endif
-inline void File::set_filename(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
-  
-  filename_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:StorageCloud.File.filename)
+inline const std::string& File::_internal_filename() const {
+  return _impl_.filename_.Get();
 }
-inline void File::set_filename(const char* value, size_t size) {
+inline void File::_internal_set_filename(const std::string& value) {
   
-  filename_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:StorageCloud.File.filename)
+  _impl_.filename_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* File::mutable_filename() {
+inline std::string* File::_internal_mutable_filename() {
   
-  // @@protoc_insertion_point(field_mutable:StorageCloud.File.filename)
-  return filename_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.filename_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* File::release_filename() {
+inline std::string* File::release_filename() {
   // @@protoc_insertion_point(field_release:StorageCloud.File.filename)
-  
-  return filename_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.filename_.Release();
 }
-inline void File::set_allocated_filename(::std::string* filename) {
-  if (filename != NULL) {
+inline void File::set_allocated_filename(std::string* filename) {
+  if (filename != nullptr) {
     
   } else {
     
   }
-  filename_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), filename);
+  _impl_.filename_.SetAllocated(filename, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.filename_.IsDefault()) {
+    _impl_.filename_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:StorageCloud.File.filename)
 }
 
 // .StorageCloud.FileType filetype = 2;
 inline void File::clear_filetype() {
-  filetype_ = 0;
+  _impl_.filetype_ = 0;
+}
+inline ::StorageCloud::FileType File::_internal_filetype() const {
+  return static_cast< ::StorageCloud::FileType >(_impl_.filetype_);
 }
 inline ::StorageCloud::FileType File::filetype() const {
   // @@protoc_insertion_point(field_get:StorageCloud.File.filetype)
-  return static_cast< ::StorageCloud::FileType >(filetype_);
+  return _internal_filetype();
 }
-inline void File::set_filetype(::StorageCloud::FileType value) {
+inline void File::_internal_set_filetype(::StorageCloud::FileType value) {
   
-  filetype_ = value;
+  _impl_.filetype_ = value;
+}
+inline void File::set_filetype(::StorageCloud::FileType value) {
+  _internal_set_filetype(value);
   // @@protoc_insertion_point(field_set:StorageCloud.File.filetype)
 }
 
 // uint64 size = 3;
 inline void File::clear_size() {
-  size_ = GOOGLE_ULONGLONG(0);
+  _impl_.size_ = uint64_t{0u};
+}
+inline uint64_t File::_internal_size() const {
+  return _impl_.size_;
 }
-inline ::google::protobuf::uint64 File::size() const {
+inline uint64_t File::size() const {
   // @@protoc_insertion_point(field_get:StorageCloud.File.size)
-  return size_;
+  return _internal_size();
 }
-inline void File::set_size(::google::protobuf::uint64 value) {
+inline void File::_internal_set_size(uint64_t value) {
   
-  size_ = value;
+  _impl_.size_ = value;
+}
+inline void File::set_size(uint64_t value) {
+  _internal_set_size(value);
   // @@protoc_insertion_point(field_set:StorageCloud.File.size)
 }
 
 // bytes hash = 4;
 inline void File::clear_hash() {
-  hash_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.hash_.ClearToEmpty();
 }
-inline const ::std::string& File::hash() const {
+inline const std::string& File::hash() const {
   // @@protoc_insertion_point(field_get:StorageCloud.File.hash)
-  return hash_.GetNoArena();
+  return _internal_hash();
 }
-inline void File::set_hash(const ::std::string& value) {
-  
-  hash_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void File::set_hash(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.hash_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:StorageCloud.File.hash)
 }
-#if LANG_CXX11
-inline void File::set_hash(::std::string&& value) {
-  
-  hash_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:StorageCloud.File.hash)
+inline std::string* File::mutable_hash() {
+  std::string* _s = _internal_mutable_hash();
+  // @@protoc_insertion_point(field_mutable:StorageCloud.File.hash)
+  return _s;
 }
-#endif
-inline void File::set_hash(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
-  
-  hash_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:StorageCloud.File.hash)
+inline const std::string& File::_internal_hash() const {
+  return _impl_.hash_.Get();
 }
-inline void File::set_hash(const void* value, size_t size) {
+inline void File::_internal_set_hash(const std::string& value) {
   
-  hash_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:StorageCloud.File.hash)
+  _impl_.hash_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* File::mutable_hash() {
+inline std::string* File::_internal_mutable_hash() {
   
-  // @@protoc_insertion_point(field_mutable:StorageCloud.File.hash)
-  return hash_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.hash_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* File::release_hash() {
+inline std::string* File::release_hash() {
   // @@protoc_insertion_point(field_release:StorageCloud.File.hash)
-  
-  return hash_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.hash_.Release();
 }
-inline void File::set_allocated_hash(::std::string* hash) {
-  if (hash != NULL) {
+inline void File::set_allocated_hash(std::string* hash) {
+  if (hash != nullptr) {
     
   } else {
     
   }
-  hash_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), hash);
+  _impl_.hash_.SetAllocated(hash, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.hash_.IsDefault()) {
+    _impl_.hash_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:StorageCloud.File.hash)
 }
 
 // string owner = 5;
 inline void File::clear_owner() {
-  owner_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.owner_.ClearToEmpty();
 }
-inline const ::std::string& File::owner() const {
+inline const std::string& File::owner() const {
   // @@protoc_insertion_point(field_get:StorageCloud.File.owner)
-  return owner_.GetNoArena();
+  return _internal_owner();
 }
-inline void File::set_owner(const ::std::string& value) {
-  
-  owner_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void File::set_owner(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.owner_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:StorageCloud.File.owner)
 }
-#if LANG_CXX11
-inline void File::set_owner(::std::string&& value) {
-  
-  owner_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:StorageCloud.File.owner)
+inline std::string* File::mutable_owner() {
+  std::string* _s = _internal_mutable_owner();
+  // @@protoc_insertion_point(field_mutable:StorageCloud.File.owner)
+  return _s;
 }
-#endif
-inline void File::set_owner(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
-  
-  owner_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:StorageCloud.File.owner)
+inline const std::string& File::_internal_owner() const {
+  return _impl_.owner_.Get();
 }
-inline void File::set_owner(const char* value, size_t size) {
+inline void File::_internal_set_owner(const std::string& value) {
   
-  owner_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:StorageCloud.File.owner)
+  _impl_.owner_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* File::mutable_owner() {
+inline std::string* File::_internal_mutable_owner() {
   
-  // @@protoc_insertion_point(field_mutable:StorageCloud.File.owner)
-  return owner_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.owner_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* File::release_owner() {
+inline std::string* File::release_owner() {
   // @@protoc_insertion_point(field_release:StorageCloud.File.owner)
-  
-  return owner_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.owner_.Release();
 }
-inline void File::set_allocated_owner(::std::string* owner) {
-  if (owner != NULL) {
+inline void File::set_allocated_owner(std::string* owner) {
+  if (owner != nullptr) {
     
   } else {
     
   }
-  owner_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), owner);
+  _impl_.owner_.SetAllocated(owner, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.owner_.IsDefault()) {
+    _impl_.owner_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:StorageCloud.File.owner)
 }
 
 // string ownerUsername = 6;
 inline void File::clear_ownerusername() {
-  ownerusername_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.ownerusername_.ClearToEmpty();
 }
-inline const ::std::string& File::ownerusername() const {
+inline const std::string& File::ownerusername() const {
   // @@protoc_insertion_point(field_get:StorageCloud.File.ownerUsername)
-  return ownerusername_.GetNoArena();
+  return _internal_ownerusername();
 }
-inline void File::set_ownerusername(const ::std::string& value) {
-  
-  ownerusername_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void File::set_ownerusername(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.ownerusername_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:StorageCloud.File.ownerUsername)
 }
-#if LANG_CXX11
-inline void File::set_ownerusername(::std::string&& value) {
-  
-  ownerusername_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:StorageCloud.File.ownerUsername)
+inline std::string* File::mutable_ownerusername() {
+  std::string* _s = _internal_mutable_ownerusername();
+  // @@protoc_insertion_point(field_mutable:StorageCloud.File.ownerUsername)
+  return _s;
 }
-#endif
-inline void File::set_ownerusername(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
-  
-  ownerusername_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:StorageCloud.File.ownerUsername)
+inline const std::string& File::_internal_ownerusername() const {
+  return _impl_.ownerusername_.Get();
 }
-inline void File::set_ownerusername(const char* value, size_t size) {
+inline void File::_internal_set_ownerusername(const std::string& value) {
   
-  ownerusername_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:StorageCloud.File.ownerUsername)
+  _impl_.ownerusername_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* File::mutable_ownerusername() {
+inline std::string* File::_internal_mutable_ownerusername() {
   
-  // @@protoc_insertion_point(field_mutable:StorageCloud.File.ownerUsername)
-  return ownerusername_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.ownerusername_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* File::release_ownerusername() {
+inline std::string* File::release_ownerusername() {
   // @@protoc_insertion_point(field_release:StorageCloud.File.ownerUsername)
-  
-  return ownerusername_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.ownerusername_.Release();
 }
-inline void File::set_allocated_ownerusername(::std::string* ownerusername) {
-  if (ownerusername != NULL) {
+inline void File::set_allocated_ownerusername(std::string* ownerusername) {
+  if (ownerusername != nullptr) {
     
   } else {
     
   }
-  ownerusername_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ownerusername);
+  _impl_.ownerusername_.SetAllocated(ownerusername, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.ownerusername_.IsDefault()) {
+    _impl_.ownerusername_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:StorageCloud.File.ownerUsername)
 }
 
 // uint64 creationDate = 7;
 inline void File::clear_creationdate() {
-  creationdate_ = GOOGLE_ULONGLONG(0);
+  _impl_.creationdate_ = uint64_t{0u};
 }
-inline ::google::protobuf::uint64 File::creationdate() const {
+inline uint64_t File::_internal_creationdate() const {
+  return _impl_.creationdate_;
+}
+inline uint64_t File::creationdate() const {
   // @@protoc_insertion_point(field_get:StorageCloud.File.creationDate)
-  return creationdate_;
+  return _internal_creationdate();
 }
-inline void File::set_creationdate(::google::protobuf::uint64 value) {
+inline void File::_internal_set_creationdate(uint64_t value) {
   
-  creationdate_ = value;
+  _impl_.creationdate_ = value;
+}
+inline void File::set_creationdate(uint64_t value) {
+  _internal_set_creationdate(value);
   // @@protoc_insertion_point(field_set:StorageCloud.File.creationDate)
 }
 
 // bool isShared = 8;
 inline void File::clear_isshared() {
-  isshared_ = false;
+  _impl_.isshared_ = false;
+}
+inline bool File::_internal_isshared() const {
+  return _impl_.isshared_;
 }
 inline bool File::isshared() const {
   // @@protoc_insertion_point(field_get:StorageCloud.File.isShared)
-  return isshared_;
+  return _internal_isshared();
 }
-inline void File::set_isshared(bool value) {
+inline void File::_internal_set_isshared(bool value) {
   
-  isshared_ = value;
+  _impl_.isshared_ = value;
+}
+inline void File::set_isshared(bool value) {
+  _internal_set_isshared(value);
   // @@protoc_insertion_point(field_set:StorageCloud.File.isShared)
 }
 
@@ -2256,453 +3033,861 @@ inline void File::set_isshared(bool value) {
 
 // .StorageCloud.EncryptionAlgorithm encryptionAlgorithm = 1;
 inline void Handshake::clear_encryptionalgorithm() {
-  encryptionalgorithm_ = 0;
+  _impl_.encryptionalgorithm_ = 0;
+}
+inline ::StorageCloud::EncryptionAlgorithm Handshake::_internal_encryptionalgorithm() const {
+  return static_cast< ::StorageCloud::EncryptionAlgorithm >(_impl_.encryptionalgorithm_);
 }
 inline ::StorageCloud::EncryptionAlgorithm Handshake::encryptionalgorithm() const {
   // @@protoc_insertion_point(field_get:StorageCloud.Handshake.encryptionAlgorithm)
-  return static_cast< ::StorageCloud::EncryptionAlgorithm >(encryptionalgorithm_);
+  return _internal_encryptionalgorithm();
 }
-inline void Handshake::set_encryptionalgorithm(::StorageCloud::EncryptionAlgorithm value) {
+inline void Handshake::_internal_set_encryptionalgorithm(::StorageCloud::EncryptionAlgorithm value) {
   
-  encryptionalgorithm_ = value;
+  _impl_.encryptionalgorithm_ = value;
+}
+inline void Handshake::set_encryptionalgorithm(::StorageCloud::EncryptionAlgorithm value) {
+  _internal_set_encryptionalgorithm(value);
   // @@protoc_insertion_point(field_set:StorageCloud.Handshake.encryptionAlgorithm)
 }
 
+// bool rawDataFrames = 2;
+inline void Handshake::clear_rawdataframes() {
+  _impl_.rawdataframes_ = false;
+}
+inline bool Handshake::_internal_rawdataframes() const {
+  return _impl_.rawdataframes_;
+}
+inline bool Handshake::rawdataframes() const {
+  // @@protoc_insertion_point(field_get:StorageCloud.Handshake.rawDataFrames)
+  return _internal_rawdataframes();
+}
+inline void Handshake::_internal_set_rawdataframes(bool value) {
+  
+  _impl_.rawdataframes_ = value;
+}
+inline void Handshake::set_rawdataframes(bool value) {
+  _internal_set_rawdataframes(value);
+  // @@protoc_insertion_point(field_set:StorageCloud.Handshake.rawDataFrames)
+}
+
+// uint32 protocolVersion = 3;
+inline void Handshake::clear_protocolversion() {
+  _impl_.protocolversion_ = 0u;
+}
+inline uint32_t Handshake::_internal_protocolversion() const {
+  return _impl_.protocolversion_;
+}
+inline uint32_t Handshake::protocolversion() const {
+  // @@protoc_insertion_point(field_get:StorageCloud.Handshake.protocolVersion)
+  return _internal_protocolversion();
+}
+inline void Handshake::_internal_set_protocolversion(uint32_t value) {
+  
+  _impl_.protocolversion_ = value;
+}
+inline void Handshake::set_protocolversion(uint32_t value) {
+  _internal_set_protocolversion(value);
+  // @@protoc_insertion_point(field_set:StorageCloud.Handshake.protocolVersion)
+}
+
+// .StorageCloud.HashAlgorithm hashAlgorithm = 4;
+inline void Handshake::clear_hashalgorithm() {
+  _impl_.hashalgorithm_ = 0;
+}
+inline ::StorageCloud::HashAlgorithm Handshake::_internal_hashalgorithm() const {
+  return static_cast< ::StorageCloud::HashAlgorithm >(_impl_.hashalgorithm_);
+}
+inline ::StorageCloud::HashAlgorithm Handshake::hashalgorithm() const {
+  // @@protoc_insertion_point(field_get:StorageCloud.Handshake.hashAlgorithm)
+  return _internal_hashalgorithm();
+}
+inline void Handshake::_internal_set_hashalgorithm(::StorageCloud::HashAlgorithm value) {
+  
+  _impl_.hashalgorithm_ = value;
+}
+inline void Handshake::set_hashalgorithm(::StorageCloud::HashAlgorithm value) {
+  _internal_set_hashalgorithm(value);
+  // @@protoc_insertion_point(field_set:StorageCloud.Handshake.hashAlgorithm)
+}
+
+// bytes publicKey = 5;
+inline void Handshake::clear_publickey() {
+  _impl_.publickey_.ClearToEmpty();
+}
+inline const std::string& Handshake::publickey() const {
+  // @@protoc_insertion_point(field_get:StorageCloud.Handshake.publicKey)
+  return _internal_publickey();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Handshake::set_publickey(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.publickey_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:StorageCloud.Handshake.publicKey)
+}
+inline std::string* Handshake::mutable_publickey() {
+  std::string* _s = _internal_mutable_publickey();
+  // @@protoc_insertion_point(field_mutable:StorageCloud.Handshake.publicKey)
+  return _s;
+}
+inline const std::string& Handshake::_internal_publickey() const {
+  return _impl_.publickey_.Get();
+}
+inline void Handshake::_internal_set_publickey(const std::string& value) {
+  
+  _impl_.publickey_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Handshake::_internal_mutable_publickey() {
+  
+  return _impl_.publickey_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Handshake::release_publickey() {
+  // @@protoc_insertion_point(field_release:StorageCloud.Handshake.publicKey)
+  return _impl_.publickey_.Release();
+}
+inline void Handshake::set_allocated_publickey(std::string* publickey) {
+  if (publickey != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.publickey_.SetAllocated(publickey, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.publickey_.IsDefault()) {
+    _impl_.publickey_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:StorageCloud.Handshake.publicKey)
+}
+
 // -------------------------------------------------------------------
 
 // UserDetails
 
 // string username = 1;
 inline void UserDetails::clear_username() {
-  username_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.username_.ClearToEmpty();
 }
-inline const ::std::string& UserDetails::username() const {
+inline const std::string& UserDetails::username() const {
   // @@protoc_insertion_point(field_get:StorageCloud.UserDetails.username)
-  return username_.GetNoArena();
+  return _internal_username();
 }
-inline void UserDetails::set_username(const ::std::string& value) {
-  
-  username_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void UserDetails::set_username(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.username_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:StorageCloud.UserDetails.username)
 }
-#if LANG_CXX11
-inline void UserDetails::set_username(::std::string&& value) {
-  
-  username_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:StorageCloud.UserDetails.username)
+inline std::string* UserDetails::mutable_username() {
+  std::string* _s = _internal_mutable_username();
+  // @@protoc_insertion_point(field_mutable:StorageCloud.UserDetails.username)
+  return _s;
 }
-#endif
-inline void UserDetails::set_username(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
-  
-  username_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:StorageCloud.UserDetails.username)
+inline const std::string& UserDetails::_internal_username() const {
+  return _impl_.username_.Get();
 }
-inline void UserDetails::set_username(const char* value, size_t size) {
+inline void UserDetails::_internal_set_username(const std::string& value) {
   
-  username_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:StorageCloud.UserDetails.username)
+  _impl_.username_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* UserDetails::mutable_username() {
+inline std::string* UserDetails::_internal_mutable_username() {
   
-  // @@protoc_insertion_point(field_mutable:StorageCloud.UserDetails.username)
-  return username_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.username_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* UserDetails::release_username() {
+inline std::string* UserDetails::release_username() {
   // @@protoc_insertion_point(field_release:StorageCloud.UserDetails.username)
-  
-  return username_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.username_.Release();
 }
-inline void UserDetails::set_allocated_username(::std::string* username) {
-  if (username != NULL) {
+inline void UserDetails::set_allocated_username(std::string* username) {
+  if (username != nullptr) {
     
   } else {
     
   }
-  username_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), username);
+  _impl_.username_.SetAllocated(username, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.username_.IsDefault()) {
+    _impl_.username_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:StorageCloud.UserDetails.username)
 }
 
 // string firstName = 2;
 inline void UserDetails::clear_firstname() {
-  firstname_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.firstname_.ClearToEmpty();
 }
-inline const ::std::string& UserDetails::firstname() const {
+inline const std::string& UserDetails::firstname() const {
   // @@protoc_insertion_point(field_get:StorageCloud.UserDetails.firstName)
-  return firstname_.GetNoArena();
+  return _internal_firstname();
 }
-inline void UserDetails::set_firstname(const ::std::string& value) {
-  
-  firstname_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void UserDetails::set_firstname(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.firstname_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:StorageCloud.UserDetails.firstName)
 }
-#if LANG_CXX11
-inline void UserDetails::set_firstname(::std::string&& value) {
-  
-  firstname_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:StorageCloud.UserDetails.firstName)
+inline std::string* UserDetails::mutable_firstname() {
+  std::string* _s = _internal_mutable_firstname();
+  // @@protoc_insertion_point(field_mutable:StorageCloud.UserDetails.firstName)
+  return _s;
 }
-#endif
-inline void UserDetails::set_firstname(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
-  
-  firstname_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:StorageCloud.UserDetails.firstName)
+inline const std::string& UserDetails::_internal_firstname() const {
+  return _impl_.firstname_.Get();
 }
-inline void UserDetails::set_firstname(const char* value, size_t size) {
+inline void UserDetails::_internal_set_firstname(const std::string& value) {
   
-  firstname_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:StorageCloud.UserDetails.firstName)
+  _impl_.firstname_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* UserDetails::mutable_firstname() {
+inline std::string* UserDetails::_internal_mutable_firstname() {
   
-  // @@protoc_insertion_point(field_mutable:StorageCloud.UserDetails.firstName)
-  return firstname_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.firstname_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* UserDetails::release_firstname() {
+inline std::string* UserDetails::release_firstname() {
   // @@protoc_insertion_point(field_release:StorageCloud.UserDetails.firstName)
-  
-  return firstname_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.firstname_.Release();
 }
-inline void UserDetails::set_allocated_firstname(::std::string* firstname) {
-  if (firstname != NULL) {
+inline void UserDetails::set_allocated_firstname(std::string* firstname) {
+  if (firstname != nullptr) {
     
   } else {
     
   }
-  firstname_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), firstname);
+  _impl_.firstname_.SetAllocated(firstname, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.firstname_.IsDefault()) {
+    _impl_.firstname_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:StorageCloud.UserDetails.firstName)
 }
 
 // string lastName = 3;
 inline void UserDetails::clear_lastname() {
-  lastname_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.lastname_.ClearToEmpty();
 }
-inline const ::std::string& UserDetails::lastname() const {
+inline const std::string& UserDetails::lastname() const {
   // @@protoc_insertion_point(field_get:StorageCloud.UserDetails.lastName)
-  return lastname_.GetNoArena();
+  return _internal_lastname();
 }
-inline void UserDetails::set_lastname(const ::std::string& value) {
-  
-  lastname_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void UserDetails::set_lastname(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.lastname_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:StorageCloud.UserDetails.lastName)
 }
-#if LANG_CXX11
-inline void UserDetails::set_lastname(::std::string&& value) {
-  
-  lastname_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:StorageCloud.UserDetails.lastName)
+inline std::string* UserDetails::mutable_lastname() {
+  std::string* _s = _internal_mutable_lastname();
+  // @@protoc_insertion_point(field_mutable:StorageCloud.UserDetails.lastName)
+  return _s;
 }
-#endif
-inline void UserDetails::set_lastname(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
-  
-  lastname_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:StorageCloud.UserDetails.lastName)
+inline const std::string& UserDetails::_internal_lastname() const {
+  return _impl_.lastname_.Get();
 }
-inline void UserDetails::set_lastname(const char* value, size_t size) {
+inline void UserDetails::_internal_set_lastname(const std::string& value) {
   
-  lastname_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:StorageCloud.UserDetails.lastName)
+  _impl_.lastname_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* UserDetails::mutable_lastname() {
+inline std::string* UserDetails::_internal_mutable_lastname() {
   
-  // @@protoc_insertion_point(field_mutable:StorageCloud.UserDetails.lastName)
-  return lastname_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.lastname_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* UserDetails::release_lastname() {
+inline std::string* UserDetails::release_lastname() {
   // @@protoc_insertion_point(field_release:StorageCloud.UserDetails.lastName)
-  
-  return lastname_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.lastname_.Release();
 }
-inline void UserDetails::set_allocated_lastname(::std::string* lastname) {
-  if (lastname != NULL) {
+inline void UserDetails::set_allocated_lastname(std::string* lastname) {
+  if (lastname != nullptr) {
     
   } else {
     
   }
-  lastname_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), lastname);
+  _impl_.lastname_.SetAllocated(lastname, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.lastname_.IsDefault()) {
+    _impl_.lastname_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:StorageCloud.UserDetails.lastName)
 }
 
 // .StorageCloud.UserRole role = 4;
 inline void UserDetails::clear_role() {
-  role_ = 0;
+  _impl_.role_ = 0;
+}
+inline ::StorageCloud::UserRole UserDetails::_internal_role() const {
+  return static_cast< ::StorageCloud::UserRole >(_impl_.role_);
 }
 inline ::StorageCloud::UserRole UserDetails::role() const {
   // @@protoc_insertion_point(field_get:StorageCloud.UserDetails.role)
-  return static_cast< ::StorageCloud::UserRole >(role_);
+  return _internal_role();
 }
-inline void UserDetails::set_role(::StorageCloud::UserRole value) {
+inline void UserDetails::_internal_set_role(::StorageCloud::UserRole value) {
   
-  role_ = value;
+  _impl_.role_ = value;
+}
+inline void UserDetails::set_role(::StorageCloud::UserRole value) {
+  _internal_set_role(value);
   // @@protoc_insertion_point(field_set:StorageCloud.UserDetails.role)
 }
 
 // uint64 totalSpace = 5;
 inline void UserDetails::clear_totalspace() {
-  totalspace_ = GOOGLE_ULONGLONG(0);
+  _impl_.totalspace_ = uint64_t{0u};
+}
+inline uint64_t UserDetails::_internal_totalspace() const {
+  return _impl_.totalspace_;
 }
-inline ::google::protobuf::uint64 UserDetails::totalspace() const {
+inline uint64_t UserDetails::totalspace() const {
   // @@protoc_insertion_point(field_get:StorageCloud.UserDetails.totalSpace)
-  return totalspace_;
+  return _internal_totalspace();
 }
-inline void UserDetails::set_totalspace(::google::protobuf::uint64 value) {
+inline void UserDetails::_internal_set_totalspace(uint64_t value) {
   
-  totalspace_ = value;
+  _impl_.totalspace_ = value;
+}
+inline void UserDetails::set_totalspace(uint64_t value) {
+  _internal_set_totalspace(value);
   // @@protoc_insertion_point(field_set:StorageCloud.UserDetails.totalSpace)
 }
 
 // uint64 usedSpace = 6;
 inline void UserDetails::clear_usedspace() {
-  usedspace_ = GOOGLE_ULONGLONG(0);
+  _impl_.usedspace_ = uint64_t{0u};
+}
+inline uint64_t UserDetails::_internal_usedspace() const {
+  return _impl_.usedspace_;
 }
-inline ::google::protobuf::uint64 UserDetails::usedspace() const {
+inline uint64_t UserDetails::usedspace() const {
   // @@protoc_insertion_point(field_get:StorageCloud.UserDetails.usedSpace)
-  return usedspace_;
+  return _internal_usedspace();
 }
-inline void UserDetails::set_usedspace(::google::protobuf::uint64 value) {
+inline void UserDetails::_internal_set_usedspace(uint64_t value) {
   
-  usedspace_ = value;
+  _impl_.usedspace_ = value;
+}
+inline void UserDetails::set_usedspace(uint64_t value) {
+  _internal_set_usedspace(value);
   // @@protoc_insertion_point(field_set:StorageCloud.UserDetails.usedSpace)
 }
 
 // -------------------------------------------------------------------
 
+// CommandStats
+
+// .StorageCloud.CommandType type = 1;
+inline void CommandStats::clear_type() {
+  _impl_.type_ = 0;
+}
+inline ::StorageCloud::CommandType CommandStats::_internal_type() const {
+  return static_cast< ::StorageCloud::CommandType >(_impl_.type_);
+}
+inline ::StorageCloud::CommandType CommandStats::type() const {
+  // @@protoc_insertion_point(field_get:StorageCloud.CommandStats.type)
+  return _internal_type();
+}
+inline void CommandStats::_internal_set_type(::StorageCloud::CommandType value) {
+  
+  _impl_.type_ = value;
+}
+inline void CommandStats::set_type(::StorageCloud::CommandType value) {
+  _internal_set_type(value);
+  // @@protoc_insertion_point(field_set:StorageCloud.CommandStats.type)
+}
+
+// uint64 count = 2;
+inline void CommandStats::clear_count() {
+  _impl_.count_ = uint64_t{0u};
+}
+inline uint64_t CommandStats::_internal_count() const {
+  return _impl_.count_;
+}
+inline uint64_t CommandStats::count() const {
+  // @@protoc_insertion_point(field_get:StorageCloud.CommandStats.count)
+  return _internal_count();
+}
+inline void CommandStats::_internal_set_count(uint64_t value) {
+  
+  _impl_.count_ = value;
+}
+inline void CommandStats::set_count(uint64_t value) {
+  _internal_set_count(value);
+  // @@protoc_insertion_point(field_set:StorageCloud.CommandStats.count)
+}
+
+// uint64 errors = 3;
+inline void CommandStats::clear_errors() {
+  _impl_.errors_ = uint64_t{0u};
+}
+inline uint64_t CommandStats::_internal_errors() const {
+  return _impl_.errors_;
+}
+inline uint64_t CommandStats::errors() const {
+  // @@protoc_insertion_point(field_get:StorageCloud.CommandStats.errors)
+  return _internal_errors();
+}
+inline void CommandStats::_internal_set_errors(uint64_t value) {
+  
+  _impl_.errors_ = value;
+}
+inline void CommandStats::set_errors(uint64_t value) {
+  _internal_set_errors(value);
+  // @@protoc_insertion_point(field_set:StorageCloud.CommandStats.errors)
+}
+
+// uint64 bytesIn = 4;
+inline void CommandStats::clear_bytesin() {
+  _impl_.bytesin_ = uint64_t{0u};
+}
+inline uint64_t CommandStats::_internal_bytesin() const {
+  return _impl_.bytesin_;
+}
+inline uint64_t CommandStats::bytesin() const {
+  // @@protoc_insertion_point(field_get:StorageCloud.CommandStats.bytesIn)
+  return _internal_bytesin();
+}
+inline void CommandStats::_internal_set_bytesin(uint64_t value) {
+  
+  _impl_.bytesin_ = value;
+}
+inline void CommandStats::set_bytesin(uint64_t value) {
+  _internal_set_bytesin(value);
+  // @@protoc_insertion_point(field_set:StorageCloud.CommandStats.bytesIn)
+}
+
+// uint64 bytesOut = 5;
+inline void CommandStats::clear_bytesout() {
+  _impl_.bytesout_ = uint64_t{0u};
+}
+inline uint64_t CommandStats::_internal_bytesout() const {
+  return _impl_.bytesout_;
+}
+inline uint64_t CommandStats::bytesout() const {
+  // @@protoc_insertion_point(field_get:StorageCloud.CommandStats.bytesOut)
+  return _internal_bytesout();
+}
+inline void CommandStats::_internal_set_bytesout(uint64_t value) {
+  
+  _impl_.bytesout_ = value;
+}
+inline void CommandStats::set_bytesout(uint64_t value) {
+  _internal_set_bytesout(value);
+  // @@protoc_insertion_point(field_set:StorageCloud.CommandStats.bytesOut)
+}
+
+// uint64 meanUs = 6;
+inline void CommandStats::clear_meanus() {
+  _impl_.meanus_ = uint64_t{0u};
+}
+inline uint64_t CommandStats::_internal_meanus() const {
+  return _impl_.meanus_;
+}
+inline uint64_t CommandStats::meanus() const {
+  // @@protoc_insertion_point(field_get:StorageCloud.CommandStats.meanUs)
+  return _internal_meanus();
+}
+inline void CommandStats::_internal_set_meanus(uint64_t value) {
+  
+  _impl_.meanus_ = value;
+}
+inline void CommandStats::set_meanus(uint64_t value) {
+  _internal_set_meanus(value);
+  // @@protoc_insertion_point(field_set:StorageCloud.CommandStats.meanUs)
+}
+
+// uint64 p50Us = 7;
+inline void CommandStats::clear_p50us() {
+  _impl_.p50us_ = uint64_t{0u};
+}
+inline uint64_t CommandStats::_internal_p50us() const {
+  return _impl_.p50us_;
+}
+inline uint64_t CommandStats::p50us() const {
+  // @@protoc_insertion_point(field_get:StorageCloud.CommandStats.p50Us)
+  return _internal_p50us();
+}
+inline void CommandStats::_internal_set_p50us(uint64_t value) {
+  
+  _impl_.p50us_ = value;
+}
+inline void CommandStats::set_p50us(uint64_t value) {
+  _internal_set_p50us(value);
+  // @@protoc_insertion_point(field_set:StorageCloud.CommandStats.p50Us)
+}
+
+// uint64 p90Us = 8;
+inline void CommandStats::clear_p90us() {
+  _impl_.p90us_ = uint64_t{0u};
+}
+inline uint64_t CommandStats::_internal_p90us() const {
+  return _impl_.p90us_;
+}
+inline uint64_t CommandStats::p90us() const {
+  // @@protoc_insertion_point(field_get:StorageCloud.CommandStats.p90Us)
+  return _internal_p90us();
+}
+inline void CommandStats::_internal_set_p90us(uint64_t value) {
+  
+  _impl_.p90us_ = value;
+}
+inline void CommandStats::set_p90us(uint64_t value) {
+  _internal_set_p90us(value);
+  // @@protoc_insertion_point(field_set:StorageCloud.CommandStats.p90Us)
+}
+
+// uint64 p99Us = 9;
+inline void CommandStats::clear_p99us() {
+  _impl_.p99us_ = uint64_t{0u};
+}
+inline uint64_t CommandStats::_internal_p99us() const {
+  return _impl_.p99us_;
+}
+inline uint64_t CommandStats::p99us() const {
+  // @@protoc_insertion_point(field_get:StorageCloud.CommandStats.p99Us)
+  return _internal_p99us();
+}
+inline void CommandStats::_internal_set_p99us(uint64_t value) {
+  
+  _impl_.p99us_ = value;
+}
+inline void CommandStats::set_p99us(uint64_t value) {
+  _internal_set_p99us(value);
+  // @@protoc_insertion_point(field_set:StorageCloud.CommandStats.p99Us)
+}
+
+// uint64 maxUs = 10;
+inline void CommandStats::clear_maxus() {
+  _impl_.maxus_ = uint64_t{0u};
+}
+inline uint64_t CommandStats::_internal_maxus() const {
+  return _impl_.maxus_;
+}
+inline uint64_t CommandStats::maxus() const {
+  // @@protoc_insertion_point(field_get:StorageCloud.CommandStats.maxUs)
+  return _internal_maxus();
+}
+inline void CommandStats::_internal_set_maxus(uint64_t value) {
+  
+  _impl_.maxus_ = value;
+}
+inline void CommandStats::set_maxus(uint64_t value) {
+  _internal_set_maxus(value);
+  // @@protoc_insertion_point(field_set:StorageCloud.CommandStats.maxUs)
+}
+
+// -------------------------------------------------------------------
+
 // ServerResponse
 
 // .StorageCloud.ResponseType type = 1;
 inline void ServerResponse::clear_type() {
-  type_ = 0;
+  _impl_.type_ = 0;
+}
+inline ::StorageCloud::ResponseType ServerResponse::_internal_type() const {
+  return static_cast< ::StorageCloud::ResponseType >(_impl_.type_);
 }
 inline ::StorageCloud::ResponseType ServerResponse::type() const {
   // @@protoc_insertion_point(field_get:StorageCloud.ServerResponse.type)
-  return static_cast< ::StorageCloud::ResponseType >(type_);
+  return _internal_type();
 }
-inline void ServerResponse::set_type(::StorageCloud::ResponseType value) {
+inline void ServerResponse::_internal_set_type(::StorageCloud::ResponseType value) {
   
-  type_ = value;
+  _impl_.type_ = value;
+}
+inline void ServerResponse::set_type(::StorageCloud::ResponseType value) {
+  _internal_set_type(value);
   // @@protoc_insertion_point(field_set:StorageCloud.ServerResponse.type)
 }
 
 // repeated .StorageCloud.Param params = 2;
+inline int ServerResponse::_internal_params_size() const {
+  return _impl_.params_.size();
+}
 inline int ServerResponse::params_size() const {
-  return params_.size();
+  return _internal_params_size();
 }
 inline void ServerResponse::clear_params() {
-  params_.Clear();
+  _impl_.params_.Clear();
+}
+inline ::StorageCloud::Param* ServerResponse::mutable_params(int index) {
+  // @@protoc_insertion_point(field_mutable:StorageCloud.ServerResponse.params)
+  return _impl_.params_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::StorageCloud::Param >*
+ServerResponse::mutable_params() {
+  // @@protoc_insertion_point(field_mutable_list:StorageCloud.ServerResponse.params)
+  return &_impl_.params_;
+}
+inline const ::StorageCloud::Param& ServerResponse::_internal_params(int index) const {
+  return _impl_.params_.Get(index);
 }
 inline const ::StorageCloud::Param& ServerResponse::params(int index) const {
   // @@protoc_insertion_point(field_get:StorageCloud.ServerResponse.params)
-  return params_.Get(index);
+  return _internal_params(index);
 }
-inline ::StorageCloud::Param* ServerResponse::mutable_params(int index) {
-  // @@protoc_insertion_point(field_mutable:StorageCloud.ServerResponse.params)
-  return params_.Mutable(index);
+inline ::StorageCloud::Param* ServerResponse::_internal_add_params() {
+  return _impl_.params_.Add();
 }
 inline ::StorageCloud::Param* ServerResponse::add_params() {
+  ::StorageCloud::Param* _add = _internal_add_params();
   // @@protoc_insertion_point(field_add:StorageCloud.ServerResponse.params)
-  return params_.Add();
-}
-inline ::google::protobuf::RepeatedPtrField< ::StorageCloud::Param >*
-ServerResponse::mutable_params() {
-  // @@protoc_insertion_point(field_mutable_list:StorageCloud.ServerResponse.params)
-  return &params_;
+  return _add;
 }
-inline const ::google::protobuf::RepeatedPtrField< ::StorageCloud::Param >&
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::StorageCloud::Param >&
 ServerResponse::params() const {
   // @@protoc_insertion_point(field_list:StorageCloud.ServerResponse.params)
-  return params_;
+  return _impl_.params_;
 }
 
 // repeated string list = 3;
+inline int ServerResponse::_internal_list_size() const {
+  return _impl_.list_.size();
+}
 inline int ServerResponse::list_size() const {
-  return list_.size();
+  return _internal_list_size();
 }
 inline void ServerResponse::clear_list() {
-  list_.Clear();
+  _impl_.list_.Clear();
+}
+inline std::string* ServerResponse::add_list() {
+  std::string* _s = _internal_add_list();
+  // @@protoc_insertion_point(field_add_mutable:StorageCloud.ServerResponse.list)
+  return _s;
 }
-inline const ::std::string& ServerResponse::list(int index) const {
+inline const std::string& ServerResponse::_internal_list(int index) const {
+  return _impl_.list_.Get(index);
+}
+inline const std::string& ServerResponse::list(int index) const {
   // @@protoc_insertion_point(field_get:StorageCloud.ServerResponse.list)
-  return list_.Get(index);
+  return _internal_list(index);
 }
-inline ::std::string* ServerResponse::mutable_list(int index) {
+inline std::string* ServerResponse::mutable_list(int index) {
   // @@protoc_insertion_point(field_mutable:StorageCloud.ServerResponse.list)
-  return list_.Mutable(index);
+  return _impl_.list_.Mutable(index);
 }
-inline void ServerResponse::set_list(int index, const ::std::string& value) {
+inline void ServerResponse::set_list(int index, const std::string& value) {
+  _impl_.list_.Mutable(index)->assign(value);
   // @@protoc_insertion_point(field_set:StorageCloud.ServerResponse.list)
-  list_.Mutable(index)->assign(value);
 }
-#if LANG_CXX11
-inline void ServerResponse::set_list(int index, ::std::string&& value) {
+inline void ServerResponse::set_list(int index, std::string&& value) {
+  _impl_.list_.Mutable(index)->assign(std::move(value));
   // @@protoc_insertion_point(field_set:StorageCloud.ServerResponse.list)
-  list_.Mutable(index)->assign(std::move(value));
 }
-#endif
 inline void ServerResponse::set_list(int index, const char* value) {
-  GOOGLE_DCHECK(value != NULL);
-  list_.Mutable(index)->assign(value);
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.list_.Mutable(index)->assign(value);
   // @@protoc_insertion_point(field_set_char:StorageCloud.ServerResponse.list)
 }
 inline void ServerResponse::set_list(int index, const char* value, size_t size) {
-  list_.Mutable(index)->assign(
+  _impl_.list_.Mutable(index)->assign(
     reinterpret_cast<const char*>(value), size);
   // @@protoc_insertion_point(field_set_pointer:StorageCloud.ServerResponse.list)
 }
-inline ::std::string* ServerResponse::add_list() {
-  // @@protoc_insertion_point(field_add_mutable:StorageCloud.ServerResponse.list)
-  return list_.Add();
+inline std::string* ServerResponse::_internal_add_list() {
+  return _impl_.list_.Add();
 }
-inline void ServerResponse::add_list(const ::std::string& value) {
-  list_.Add()->assign(value);
+inline void ServerResponse::add_list(const std::string& value) {
+  _impl_.list_.Add()->assign(value);
   // @@protoc_insertion_point(field_add:StorageCloud.ServerResponse.list)
 }
-#if LANG_CXX11
-inline void ServerResponse::add_list(::std::string&& value) {
-  list_.Add(std::move(value));
+inline void ServerResponse::add_list(std::string&& value) {
+  _impl_.list_.Add(std::move(value));
   // @@protoc_insertion_point(field_add:StorageCloud.ServerResponse.list)
 }
-#endif
 inline void ServerResponse::add_list(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
-  list_.Add()->assign(value);
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.list_.Add()->assign(value);
   // @@protoc_insertion_point(field_add_char:StorageCloud.ServerResponse.list)
 }
 inline void ServerResponse::add_list(const char* value, size_t size) {
-  list_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  _impl_.list_.Add()->assign(reinterpret_cast<const char*>(value), size);
   // @@protoc_insertion_point(field_add_pointer:StorageCloud.ServerResponse.list)
 }
-inline const ::google::protobuf::RepeatedPtrField< ::std::string>&
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
 ServerResponse::list() const {
   // @@protoc_insertion_point(field_list:StorageCloud.ServerResponse.list)
-  return list_;
+  return _impl_.list_;
 }
-inline ::google::protobuf::RepeatedPtrField< ::std::string>*
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
 ServerResponse::mutable_list() {
   // @@protoc_insertion_point(field_mutable_list:StorageCloud.ServerResponse.list)
-  return &list_;
+  return &_impl_.list_;
 }
 
 // repeated .StorageCloud.File fileList = 4;
+inline int ServerResponse::_internal_filelist_size() const {
+  return _impl_.filelist_.size();
+}
 inline int ServerResponse::filelist_size() const {
-  return filelist_.size();
+  return _internal_filelist_size();
 }
 inline void ServerResponse::clear_filelist() {
-  filelist_.Clear();
+  _impl_.filelist_.Clear();
+}
+inline ::StorageCloud::File* ServerResponse::mutable_filelist(int index) {
+  // @@protoc_insertion_point(field_mutable:StorageCloud.ServerResponse.fileList)
+  return _impl_.filelist_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::StorageCloud::File >*
+ServerResponse::mutable_filelist() {
+  // @@protoc_insertion_point(field_mutable_list:StorageCloud.ServerResponse.fileList)
+  return &_impl_.filelist_;
+}
+inline const ::StorageCloud::File& ServerResponse::_internal_filelist(int index) const {
+  return _impl_.filelist_.Get(index);
 }
 inline const ::StorageCloud::File& ServerResponse::filelist(int index) const {
   // @@protoc_insertion_point(field_get:StorageCloud.ServerResponse.fileList)
-  return filelist_.Get(index);
+  return _internal_filelist(index);
 }
-inline ::StorageCloud::File* ServerResponse::mutable_filelist(int index) {
-  // @@protoc_insertion_point(field_mutable:StorageCloud.ServerResponse.fileList)
-  return filelist_.Mutable(index);
+inline ::StorageCloud::File* ServerResponse::_internal_add_filelist() {
+  return _impl_.filelist_.Add();
 }
 inline ::StorageCloud::File* ServerResponse::add_filelist() {
+  ::StorageCloud::File* _add = _internal_add_filelist();
   // @@protoc_insertion_point(field_add:StorageCloud.ServerResponse.fileList)
-  return filelist_.Add();
-}
-inline ::google::protobuf::RepeatedPtrField< ::StorageCloud::File >*
-ServerResponse::mutable_filelist() {
-  // @@protoc_insertion_point(field_mutable_list:StorageCloud.ServerResponse.fileList)
-  return &filelist_;
+  return _add;
 }
-inline const ::google::protobuf::RepeatedPtrField< ::StorageCloud::File >&
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::StorageCloud::File >&
 ServerResponse::filelist() const {
   // @@protoc_insertion_point(field_list:StorageCloud.ServerResponse.fileList)
-  return filelist_;
+  return _impl_.filelist_;
 }
 
 // repeated .StorageCloud.UserDetails userList = 5;
+inline int ServerResponse::_internal_userlist_size() const {
+  return _impl_.userlist_.size();
+}
 inline int ServerResponse::userlist_size() const {
-  return userlist_.size();
+  return _internal_userlist_size();
 }
 inline void ServerResponse::clear_userlist() {
-  userlist_.Clear();
+  _impl_.userlist_.Clear();
+}
+inline ::StorageCloud::UserDetails* ServerResponse::mutable_userlist(int index) {
+  // @@protoc_insertion_point(field_mutable:StorageCloud.ServerResponse.userList)
+  return _impl_.userlist_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::StorageCloud::UserDetails >*
+ServerResponse::mutable_userlist() {
+  // @@protoc_insertion_point(field_mutable_list:StorageCloud.ServerResponse.userList)
+  return &_impl_.userlist_;
+}
+inline const ::StorageCloud::UserDetails& ServerResponse::_internal_userlist(int index) const {
+  return _impl_.userlist_.Get(index);
 }
 inline const ::StorageCloud::UserDetails& ServerResponse::userlist(int index) const {
   // @@protoc_insertion_point(field_get:StorageCloud.ServerResponse.userList)
-  return userlist_.Get(index);
+  return _internal_userlist(index);
 }
-inline ::StorageCloud::UserDetails* ServerResponse::mutable_userlist(int index) {
-  // @@protoc_insertion_point(field_mutable:StorageCloud.ServerResponse.userList)
-  return userlist_.Mutable(index);
+inline ::StorageCloud::UserDetails* ServerResponse::_internal_add_userlist() {
+  return _impl_.userlist_.Add();
 }
 inline ::StorageCloud::UserDetails* ServerResponse::add_userlist() {
+  ::StorageCloud::UserDetails* _add = _internal_add_userlist();
   // @@protoc_insertion_point(field_add:StorageCloud.ServerResponse.userList)
-  return userlist_.Add();
+  return _add;
 }
-inline ::google::protobuf::RepeatedPtrField< ::StorageCloud::UserDetails >*
-ServerResponse::mutable_userlist() {
-  // @@protoc_insertion_point(field_mutable_list:StorageCloud.ServerResponse.userList)
-  return &userlist_;
-}
-inline const ::google::protobuf::RepeatedPtrField< ::StorageCloud::UserDetails >&
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::StorageCloud::UserDetails >&
 ServerResponse::userlist() const {
   // @@protoc_insertion_point(field_list:StorageCloud.ServerResponse.userList)
-  return userlist_;
+  return _impl_.userlist_;
 }
 
 // bytes data = 6;
 inline void ServerResponse::clear_data() {
-  data_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.data_.ClearToEmpty();
 }
-inline const ::std::string& ServerResponse::data() const {
+inline const std::string& ServerResponse::data() const {
   // @@protoc_insertion_point(field_get:StorageCloud.ServerResponse.data)
-  return data_.GetNoArena();
+  return _internal_data();
 }
-inline void ServerResponse::set_data(const ::std::string& value) {
-  
-  data_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ServerResponse::set_data(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.data_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:StorageCloud.ServerResponse.data)
 }
-#if LANG_CXX11
-inline void ServerResponse::set_data(::std::string&& value) {
-  
-  data_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:StorageCloud.ServerResponse.data)
+inline std::string* ServerResponse::mutable_data() {
+  std::string* _s = _internal_mutable_data();
+  // @@protoc_insertion_point(field_mutable:StorageCloud.ServerResponse.data)
+  return _s;
 }
-#endif
-inline void ServerResponse::set_data(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
-  
-  data_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:StorageCloud.ServerResponse.data)
+inline const std::string& ServerResponse::_internal_data() const {
+  return _impl_.data_.Get();
 }
-inline void ServerResponse::set_data(const void* value, size_t size) {
+inline void ServerResponse::_internal_set_data(const std::string& value) {
   
-  data_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:StorageCloud.ServerResponse.data)
+  _impl_.data_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* ServerResponse::mutable_data() {
+inline std::string* ServerResponse::_internal_mutable_data() {
   
-  // @@protoc_insertion_point(field_mutable:StorageCloud.ServerResponse.data)
-  return data_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.data_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* ServerResponse::release_data() {
+inline std::string* ServerResponse::release_data() {
   // @@protoc_insertion_point(field_release:StorageCloud.ServerResponse.data)
-  
-  return data_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.data_.Release();
 }
-inline void ServerResponse::set_allocated_data(::std::string* data) {
-  if (data != NULL) {
+inline void ServerResponse::set_allocated_data(std::string* data) {
+  if (data != nullptr) {
     
   } else {
     
   }
-  data_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), data);
+  _impl_.data_.SetAllocated(data, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.data_.IsDefault()) {
+    _impl_.data_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:StorageCloud.ServerResponse.data)
 }
 
+// repeated .StorageCloud.CommandStats stats = 7;
+inline int ServerResponse::_internal_stats_size() const {
+  return _impl_.stats_.size();
+}
+inline int ServerResponse::stats_size() const {
+  return _internal_stats_size();
+}
+inline void ServerResponse::clear_stats() {
+  _impl_.stats_.Clear();
+}
+inline ::StorageCloud::CommandStats* ServerResponse::mutable_stats(int index) {
+  // @@protoc_insertion_point(field_mutable:StorageCloud.ServerResponse.stats)
+  return _impl_.stats_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::StorageCloud::CommandStats >*
+ServerResponse::mutable_stats() {
+  // @@protoc_insertion_point(field_mutable_list:StorageCloud.ServerResponse.stats)
+  return &_impl_.stats_;
+}
+inline const ::StorageCloud::CommandStats& ServerResponse::_internal_stats(int index) const {
+  return _impl_.stats_.Get(index);
+}
+inline const ::StorageCloud::CommandStats& ServerResponse::stats(int index) const {
+  // @@protoc_insertion_point(field_get:StorageCloud.ServerResponse.stats)
+  return _internal_stats(index);
+}
+inline ::StorageCloud::CommandStats* ServerResponse::_internal_add_stats() {
+  return _impl_.stats_.Add();
+}
+inline ::StorageCloud::CommandStats* ServerResponse::add_stats() {
+  ::StorageCloud::CommandStats* _add = _internal_add_stats();
+  // @@protoc_insertion_point(field_add:StorageCloud.ServerResponse.stats)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::StorageCloud::CommandStats >&
+ServerResponse::stats() const {
+  // @@protoc_insertion_point(field_list:StorageCloud.ServerResponse.stats)
+  return _impl_.stats_;
+}
+
 #ifdef __GNUC__
   #pragma GCC diagnostic pop
 #endif  // __GNUC__
@@ -2718,53 +3903,54 @@ inline void ServerResponse::set_allocated_data(::std::string* data) {
 
 // -------------------------------------------------------------------
 
+// -------------------------------------------------------------------
+
 
 // @@protoc_insertion_point(namespace_scope)
 
 }  // namespace StorageCloud
 
-namespace google {
-namespace protobuf {
+PROTOBUF_NAMESPACE_OPEN
 
-template <> struct is_proto_enum< ::StorageCloud::HashAlgorithm> : ::google::protobuf::internal::true_type {};
+template <> struct is_proto_enum< ::StorageCloud::HashAlgorithm> : ::std::true_type {};
 template <>
 inline const EnumDescriptor* GetEnumDescriptor< ::StorageCloud::HashAlgorithm>() {
   return ::StorageCloud::HashAlgorithm_descriptor();
 }
-template <> struct is_proto_enum< ::StorageCloud::MessageType> : ::google::protobuf::internal::true_type {};
+template <> struct is_proto_enum< ::StorageCloud::MessageType> : ::std::true_type {};
 template <>
 inline const EnumDescriptor* GetEnumDescriptor< ::StorageCloud::MessageType>() {
   return ::StorageCloud::MessageType_descriptor();
 }
-template <> struct is_proto_enum< ::StorageCloud::CommandType> : ::google::protobuf::internal::true_type {};
+template <> struct is_proto_enum< ::StorageCloud::CommandType> : ::std::true_type {};
 template <>
 inline const EnumDescriptor* GetEnumDescriptor< ::StorageCloud::CommandType>() {
   return ::StorageCloud::CommandType_descriptor();
 }
-template <> struct is_proto_enum< ::StorageCloud::FileType> : ::google::protobuf::internal::true_type {};
+template <> struct is_proto_enum< ::StorageCloud::FileType> : ::std::true_type {};
 template <>
 inline const EnumDescriptor* GetEnumDescriptor< ::StorageCloud::FileType>() {
   return ::StorageCloud::FileType_descriptor();
 }
-template <> struct is_proto_enum< ::StorageCloud::UserRole> : ::google::protobuf::internal::true_type {};
+template <> struct is_proto_enum< ::StorageCloud::UserRole> : ::std::true_type {};
 template <>
 inline const EnumDescriptor* GetEnumDescriptor< ::StorageCloud::UserRole>() {
   return ::StorageCloud::UserRole_descriptor();
 }
-template <> struct is_proto_enum< ::StorageCloud::ResponseType> : ::google::protobuf::internal::true_type {};
+template <> struct is_proto_enum< ::StorageCloud::ResponseType> : ::std::true_type {};
 template <>
 inline const EnumDescriptor* GetEnumDescriptor< ::StorageCloud::ResponseType>() {
   return ::StorageCloud::ResponseType_descriptor();
 }
-template <> struct is_proto_enum< ::StorageCloud::EncryptionAlgorithm> : ::google::protobuf::internal::true_type {};
+template <> struct is_proto_enum< ::StorageCloud::EncryptionAlgorithm> : ::std::true_type {};
 template <>
 inline const EnumDescriptor* GetEnumDescriptor< ::StorageCloud::EncryptionAlgorithm>() {
   return ::StorageCloud::EncryptionAlgorithm_descriptor();
 }
 
-}  // namespace protobuf
-}  // namespace google
+PROTOBUF_NAMESPACE_CLOSE
 
 // @@protoc_insertion_point(global_scope)
 
-#endif  // PROTOBUF_messages_2eproto__INCLUDED
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_messages_2eproto
@@ -1,20 +1,256 @@
 #include "main.h"
 #include "utils.h"
 
+#if defined(__x86_64__)
+#include <nmmintrin.h>
+#include <emmintrin.h>
+#elif defined(__aarch64__)
+#include <arm_acle.h>
+#include <sys/auxv.h>
+#include <asm/hwcap.h>
+#include <arm_neon.h>
+#endif
+
+#ifdef HAVE_XXHASH
+#include <xxhash.h>
+#endif
+
 using namespace std;
 using namespace StorageCloud;
+using google::protobuf::internal::WireFormatLite;
+using google::protobuf::io::CodedInputStream;
+using google::protobuf::io::CodedOutputStream;
+
+bool parseEncodedMessage(const uint8_t buf[], const int len, encoded_view& msg) {
+    CodedInputStream in(buf, len);
+    uint32_t tag;
+
+    msg = encoded_view();
+
+    while((tag = in.ReadTag()) != 0) {
+        int field = WireFormatLite::GetTagFieldNumber(tag);
+        WireFormatLite::WireType wire_type = WireFormatLite::GetTagWireType(tag);
+        uint32_t value;
+
+        if(field == EncodedMessage::kDataSizeFieldNumber && wire_type == WireFormatLite::WIRETYPE_VARINT) {
+            if(!in.ReadVarint64(&msg.data_size)) {
+                return false;
+            }
+        } else if(field == EncodedMessage::kHashAlgorithmFieldNumber && wire_type == WireFormatLite::WIRETYPE_VARINT) {
+            if(!in.ReadVarint32(&value)) {
+                return false;
+            }
+            msg.hash_algorithm = (HashAlgorithm) value;
+        } else if(field == EncodedMessage::kTypeFieldNumber && wire_type == WireFormatLite::WIRETYPE_VARINT) {
+            if(!in.ReadVarint32(&value)) {
+                return false;
+            }
+            msg.type = (MessageType) value;
+        } else if((field == EncodedMessage::kHashFieldNumber || field == EncodedMessage::kDataFieldNumber)
+                  && wire_type == WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+            // bytes are not copied, the view points into buf
+            if(!in.ReadVarint32(&value) || value > (uint32_t) (len - in.CurrentPosition())) {
+                return false;
+            }
+
+            const uint8_t* ptr = buf + in.CurrentPosition();
+            in.Skip(value);
+
+            if(field == EncodedMessage::kHashFieldNumber) {
+                msg.hash = ptr;
+                msg.hash_len = value;
+            } else {
+                msg.data = ptr;
+                msg.data_len = value;
+            }
+        } else if(!WireFormatLite::SkipField(&in, tag)) {
+            return false;
+        }
+    }
+
+    return in.ConsumedEntireMessage();
+}
+
+size_t encodedMessageSize(const encoded_view& msg) {
+    size_t size = 0;
+
+    if(msg.data_size != 0) {
+        size += 1 + WireFormatLite::UInt64Size(msg.data_size);
+    }
+    if(msg.hash_algorithm != 0) {
+        size += 1 + WireFormatLite::EnumSize(msg.hash_algorithm);
+    }
+    if(msg.hash_len != 0) {
+        size += 1 + CodedOutputStream::VarintSize32(msg.hash_len) + msg.hash_len;
+    }
+    if(msg.type != 0) {
+        size += 1 + WireFormatLite::EnumSize(msg.type);
+    }
+    if(msg.data_len != 0) {
+        size += 1 + CodedOutputStream::VarintSize32(msg.data_len) + msg.data_len;
+    }
+
+    return size;
+}
+
+static uint8_t* writeBytesField(const int field, const uint8_t data[], const uint32_t len, uint8_t* target) {
+    target = WireFormatLite::WriteTagToArray(field, WireFormatLite::WIRETYPE_LENGTH_DELIMITED, target);
+    target = CodedOutputStream::WriteVarint32ToArray(len, target);
+    if(data != nullptr) {
+        memcpy(target, data, len);
+    }
+    return target + len;
+}
+
+uint8_t* writeEncodedMessage(const encoded_view& msg, uint8_t* target) {
+    if(msg.data_size != 0) {
+        target = WireFormatLite::WriteUInt64ToArray(EncodedMessage::kDataSizeFieldNumber, msg.data_size, target);
+    }
+    if(msg.hash_algorithm != 0) {
+        target = WireFormatLite::WriteEnumToArray(EncodedMessage::kHashAlgorithmFieldNumber, msg.hash_algorithm, target);
+    }
+    if(msg.hash_len != 0) {
+        target = writeBytesField(EncodedMessage::kHashFieldNumber, msg.hash, msg.hash_len, target);
+    }
+    if(msg.type != 0) {
+        target = WireFormatLite::WriteEnumToArray(EncodedMessage::kTypeFieldNumber, msg.type, target);
+    }
+    if(msg.data_len != 0) {
+        target = writeBytesField(EncodedMessage::kDataFieldNumber, msg.data, msg.data_len, target);
+    }
+
+    return target;
+}
+
+static void writeBigEndian(uint64_t value, uint8_t* out, const int len) {
+    for(int i=len-1; i>=0; i--) {
+        out[i] = (uint8_t) value;
+        value >>= 8;
+    }
+}
+
+size_t calculateHash(HashAlgorithm algo, const_byte_span in, byte_span digest) {
+    if(algo == HashAlgorithm::H_NOHASH) {
+        return 0;
+    }
+
+    if(!isHashSupported(algo) || digest.size < HASH_SIZE[algo]) {
+        cout<<"Error: unknown hashing algorithm ("<<HashAlgorithm_Name(algo)<<")"<<endl;
+        return 0;
+    }
 
-void calculateHash(HashAlgorithm algo, const uint8_t buf[], int len, uint8_t** digest, uint16_t* digest_len) {
     if(algo == HashAlgorithm::H_SHA512) {
-        *digest_len = SHA512_DIGEST_LENGTH;
-        *digest = new uint8_t[*digest_len];
-        SHA512(buf, (size_t) len, *digest);
-    } else if(algo == HashAlgorithm::H_NOHASH) {
-        *digest_len = 0;
-        *digest = nullptr;
+        SHA512(in.data, in.size, digest.data);
+    } else if(algo == HashAlgorithm::H_SHA256) {
+        SHA256(in.data, in.size, digest.data);
+    } else if(algo == HashAlgorithm::H_SHA1) {
+        SHA1(in.data, in.size, digest.data);
+    } else if(algo == HashAlgorithm::H_MD5) {
+        MD5(in.data, in.size, digest.data);
+    } else if(algo == HashAlgorithm::H_CRC32C) {
+        writeBigEndian(crc32c(in.data, in.size), digest.data, 4);
+#ifdef HAVE_XXHASH
+    } else if(algo == HashAlgorithm::H_XXH3) {
+        writeBigEndian(XXH3_64bits(in.data, in.size), digest.data, 8);
+#endif
+    }
+
+    return HASH_SIZE[algo];
+}
+
+HashContext::~HashContext() {
+    EVP_MD_CTX_free(md_ctx);
+#ifdef HAVE_XXHASH
+    XXH3_freeState((XXH3_state_t*) xxh_state);
+#endif
+}
+
+bool HashContext::init(const HashAlgorithm new_algo) {
+    const EVP_MD* md = nullptr;
+    algo = HashAlgorithm::NULL2;
+
+    if(new_algo == HashAlgorithm::H_SHA512) {
+        md = EVP_sha512();
+    } else if(new_algo == HashAlgorithm::H_SHA256) {
+        md = EVP_sha256();
+    } else if(new_algo == HashAlgorithm::H_SHA1) {
+        md = EVP_sha1();
+    } else if(new_algo == HashAlgorithm::H_MD5) {
+        md = EVP_md5();
+    } else if(new_algo == HashAlgorithm::H_CRC32C) {
+        crc = 0;
+#ifdef HAVE_XXHASH
+    } else if(new_algo == HashAlgorithm::H_XXH3) {
+        if(xxh_state == nullptr) {
+            xxh_state = XXH3_createState();
+        }
+        if(xxh_state == nullptr || XXH3_64bits_reset((XXH3_state_t*) xxh_state) != XXH_OK) {
+            return false;
+        }
+#endif
+    } else if(new_algo != HashAlgorithm::H_NOHASH) {
+        return false;
+    }
+
+    if(md != nullptr) {
+        if(md_ctx == nullptr) {
+            md_ctx = EVP_MD_CTX_new();
+        }
+        if(md_ctx == nullptr || EVP_DigestInit_ex(md_ctx, md, nullptr) <= 0) {
+            return false;
+        }
+    }
+
+    algo = new_algo;
+    return true;
+}
+
+void HashContext::update(const_byte_span in) {
+    if(algo == HashAlgorithm::H_CRC32C) {
+        crc = crc32c(in.data, in.size, crc);
+#ifdef HAVE_XXHASH
+    } else if(algo == HashAlgorithm::H_XXH3) {
+        XXH3_64bits_update((XXH3_state_t*) xxh_state, in.data, in.size);
+#endif
+    } else if(algo != HashAlgorithm::H_NOHASH && algo != HashAlgorithm::NULL2) {
+        EVP_DigestUpdate(md_ctx, in.data, in.size);
+    }
+}
+
+size_t HashContext::final(byte_span digest) {
+    if(algo == HashAlgorithm::H_NOHASH || algo == HashAlgorithm::NULL2 || digest.size < HASH_SIZE[algo]) {
+        return 0;
+    }
+
+    if(algo == HashAlgorithm::H_CRC32C) {
+        writeBigEndian(crc, digest.data, 4);
+#ifdef HAVE_XXHASH
+    } else if(algo == HashAlgorithm::H_XXH3) {
+        writeBigEndian(XXH3_64bits_digest((XXH3_state_t*) xxh_state), digest.data, 8);
+#endif
     } else {
-        *digest_len = 0;
-        cout<<"Error: unknown hashing algorithm ("<<HashAlgorithm_Name(algo)<<")"<<endl;
+        unsigned int len;
+        EVP_DigestFinal_ex(md_ctx, digest.data, &len);
+    }
+
+    return HASH_SIZE[algo];
+}
+
+bool isHashSupported(const HashAlgorithm algo) {
+    switch(algo) {
+        case HashAlgorithm::H_NOHASH:
+        case HashAlgorithm::H_SHA256:
+        case HashAlgorithm::H_SHA512:
+        case HashAlgorithm::H_SHA1:
+        case HashAlgorithm::H_MD5:
+        case HashAlgorithm::H_CRC32C:
+            return true;
+#ifdef HAVE_XXHASH
+        case HashAlgorithm::H_XXH3:
+            return true;
+#endif
+        default:
+            return false;
     }
 }
 
@@ -36,6 +272,149 @@ uint32_t parseSize(const uint8_t size_buf[]) {
     return ((size_buf[0]<<24u)|(size_buf[1]<<16u)|(size_buf[2]<<8u)|(size_buf[3]));
 }
 
+// layout: length(4) type(1) flags(1) reserved(2) stream(4) offset(8)
+void writeRawHeader(uint8_t buf[], const raw_frame_header& header) {
+    uint32_t length = header.length | RAW_FRAME_FLAG;
+
+    for(int i=0; i<4; i++) {
+        buf[i] = (uint8_t) (length >> (24 - 8*i));
+        buf[8+i] = (uint8_t) (header.stream >> (24 - 8*i));
+    }
+
+    buf[4] = header.type;
+    buf[5] = header.flags;
+    buf[6] = buf[7] = 0;
+
+    for(int i=0; i<8; i++) {
+        buf[12+i] = (uint8_t) (header.offset >> (56 - 8*i));
+    }
+}
+
+bool parseRawHeader(const uint8_t buf[], raw_frame_header& header) {
+    uint32_t length = parseSize(buf);
+
+    if(!(length & RAW_FRAME_FLAG)) {
+        return false;
+    }
+
+    header.length = length & ~RAW_FRAME_FLAG;
+    header.type = buf[4];
+    header.flags = buf[5];
+    header.stream = parseSize(buf + 8);
+    header.offset = ((uint64_t) parseSize(buf + 12) << 32u) | parseSize(buf + 16);
+
+    return header.length >= RAW_HEADER_SIZE;
+}
+
+// layout: length(4) version(1) type(1) flags(1) reserved(1) stream(4) checksum(4)
+void writeFrameHeader(uint8_t buf[], const frame_header& header) {
+    for(int i=0; i<4; i++) {
+        buf[i] = (uint8_t) (header.length >> (24 - 8*i));
+        buf[8+i] = (uint8_t) (header.stream >> (24 - 8*i));
+        buf[12+i] = (uint8_t) (header.checksum >> (24 - 8*i));
+    }
+
+    buf[4] = header.version;
+    buf[5] = header.type;
+    buf[6] = header.flags;
+    buf[7] = 0;
+}
+
+bool parseFrameHeader(const uint8_t buf[], frame_header& header) {
+    header.length = parseSize(buf);
+
+    if(header.length & RAW_FRAME_FLAG) {
+        return false;
+    }
+
+    header.version = buf[4];
+    header.type = buf[5];
+    header.flags = buf[6];
+    header.stream = parseSize(buf + 8);
+    header.checksum = parseSize(buf + 12);
+
+    return header.length >= V2_HEADER_SIZE;
+}
+
+static const uint32_t* crc32cTable() {
+    static uint32_t table[256];
+    static bool ready = [] {
+        for(uint32_t i=0; i<256; i++) {
+            uint32_t crc = i;
+            for(int j=0; j<8; j++) {
+                crc = (crc >> 1) ^ (0x82F63B78u & (0u - (crc & 1u)));
+            }
+            table[i] = crc;
+        }
+        return true;
+    }();
+
+    (void) ready;
+    return table;
+}
+
+#if defined(__x86_64__)
+__attribute__((target("sse4.2")))
+static uint32_t crc32cHardware(const uint8_t buf[], size_t len, uint32_t crc) {
+    uint64_t crc64 = crc;
+
+    for(; len >= 8; len -= 8, buf += 8) {
+        uint64_t word;
+        memcpy(&word, buf, 8);
+        crc64 = _mm_crc32_u64(crc64, word);
+    }
+
+    crc = (uint32_t) crc64;
+    for(; len > 0; len--, buf++) {
+        crc = _mm_crc32_u8(crc, *buf);
+    }
+
+    return crc;
+}
+
+static bool crc32cHardwareAvailable() {
+    return __builtin_cpu_supports("sse4.2");
+}
+#elif defined(__aarch64__)
+__attribute__((target("+crc")))
+static uint32_t crc32cHardware(const uint8_t buf[], size_t len, uint32_t crc) {
+    for(; len >= 8; len -= 8, buf += 8) {
+        uint64_t word;
+        memcpy(&word, buf, 8);
+        crc = __crc32cd(crc, word);
+    }
+
+    for(; len > 0; len--, buf++) {
+        crc = __crc32cb(crc, *buf);
+    }
+
+    return crc;
+}
+
+static bool crc32cHardwareAvailable() {
+    return (getauxval(AT_HWCAP) & HWCAP_CRC32) != 0;
+}
+#endif
+
+uint32_t crc32c(const uint8_t buf[], const size_t len, uint32_t crc) {
+    crc = ~crc;
+
+#if defined(__x86_64__) || defined(__aarch64__)
+    static const bool hardware = crc32cHardwareAvailable();
+    if(hardware) {
+        return ~crc32cHardware(buf, len, crc);
+    }
+#endif
+
+    const uint32_t* table = crc32cTable();
+
+    for(size_t i=0; i<len; i++) {
+        crc = table[(crc ^ buf[i]) & 0xFFu] ^ (crc >> 8);
+    }
+
+    return ~crc;
+}
+
 string printHash(const uint8_t hash_type, const uint8_t hash[]) {
     string wyn;
     char buf[3];
@@ -47,42 +426,64 @@ string printHash(const uint8_t hash_type, const uint8_t hash[]) {
     return wyn;
 }
 
-void encrypt(const EncryptionAlgorithm algo, const uint8_t in[], const uint32_t in_len, uint8_t** out, uint32_t* out_len) {
+// adds delta to every byte, 16 bytes at a time with SSE2 / NEON
+static void addToBytes(const uint8_t in[], uint8_t out[], const size_t len, const uint8_t delta) {
+    size_t i = 0;
+
+#if defined(__SSE2__)
+    const __m128i d = _mm_set1_epi8((char) delta);
+    for(; i + 16 <= len; i += 16) {
+        __m128i v = _mm_loadu_si128((const __m128i*) (in + i));
+        _mm_storeu_si128((__m128i*) (out + i), _mm_add_epi8(v, d));
+    }
+#elif defined(__ARM_NEON)
+    const uint8x16_t d = vdupq_n_u8(delta);
+    for(; i + 16 <= len; i += 16) {
+        vst1q_u8(out + i, vaddq_u8(vld1q_u8(in + i), d));
+    }
+#endif
+
+    for(; i < len; i++) {
+        out[i] = (uint8_t) (in[i] + delta);
+    }
+}
+
+bool encrypt(const EncryptionAlgorithm algo, const_byte_span in, byte_span out) {
+    if(out.size < in.size) {
+        return false;
+    }
+
     if(algo == EncryptionAlgorithm::NOENCRYPTION) {
-        *out_len = in_len;
-        *out = new uint8_t[*out_len];
-        for (int i = 0; i < in_len; i++) {
-            (*out)[i] = in[i];
+        if(out.data != in.data) {
+            memmove(out.data, in.data, in.size);
         }
     } else if(algo == EncryptionAlgorithm::CAESAR) {
-        *out_len = in_len;
-        *out = new uint8_t[*out_len];
-        for (int i = 0; i < in_len; i++) {
-            (*out)[i] = (uint8_t) (in[i] + 1);
-        }
+        addToBytes(in.data, out.data, in.size, 1);
     } else {
-        *out_len = 0;
         cout<<"Error: unknown encryption algorithm"<<endl;
+        return false;
     }
+
+    return true;
 }
 
-void decrypt(const EncryptionAlgorithm algo, const uint8_t in[], const uint32_t in_len, uint8_t** out, uint32_t* out_len) {
-     if(algo == EncryptionAlgorithm::NOENCRYPTION) {
-         *out_len = in_len;
-         *out = new uint8_t[*out_len];
-         for (int i = 0; i < in_len; i++) {
-             (*out)[i] = in[i];
-         }
-     } else if(algo == EncryptionAlgorithm::CAESAR) {
-         *out_len = in_len;
-         *out = new uint8_t[*out_len];
-         for (int i = 0; i < in_len; i++) {
-             (*out)[i] = (uint8_t) (in[i] - 1);
-         }
-     } else {
-         *out_len = 0;
-         cout<<"Error: unknown encryption algorithm"<<endl;
-     }
+bool decrypt(const EncryptionAlgorithm algo, const_byte_span in, byte_span out) {
+    if(out.size < in.size) {
+        return false;
+    }
+
+    if(algo == EncryptionAlgorithm::NOENCRYPTION) {
+        if(out.data != in.data) {
+            memmove(out.data, in.data, in.size);
+        }
+    } else if(algo == EncryptionAlgorithm::CAESAR) {
+        addToBytes(in.data, out.data, in.size, (uint8_t) -1);
+    } else {
+        cout<<"Error: unknown encryption algorithm"<<endl;
+        return false;
+    }
+
+    return true;
 }
 
 char getch() {
@@ -8,14 +8,78 @@ const uint8_t HASH_SIZE[StorageCloud::HashAlgorithm_ARRAYSIZE] = {
         SHA512_DIGEST_LENGTH,
         SHA_DIGEST_LENGTH,
         MD5_DIGEST_LENGTH,
+        4,
+        8,
 };
 
-void calculateHash(StorageCloud::HashAlgorithm, const uint8_t*, int, uint8_t**, uint16_t*);
+#define MAX_HASH_SIZE SHA512_DIGEST_LENGTH
+
+// non-owning view of bytes, transforms accept the same span as input and output
+struct byte_span {
+    uint8_t* data;
+    size_t size;
+
+    byte_span(uint8_t* d, size_t s): data(d), size(s) {};
+};
+
+struct const_byte_span {
+    const uint8_t* data;
+    size_t size;
+
+    const_byte_span(const uint8_t* d, size_t s): data(d), size(s) {};
+    const_byte_span(const byte_span& span): data(span.data), size(span.size) {};
+};
+
+// incremental hashing, one context can be reinitialized for many messages without allocating
+class HashContext {
+private:
+    StorageCloud::HashAlgorithm algo = StorageCloud::HashAlgorithm::NULL2;
+    EVP_MD_CTX* md_ctx = nullptr;
+    void* xxh_state = nullptr;
+    uint32_t crc = 0;
+
+public:
+    HashContext() = default;
+    HashContext(const HashContext&) = delete;
+    ~HashContext();
+
+    bool init(StorageCloud::HashAlgorithm);
+    void update(const_byte_span);
+    // writes HASH_SIZE of the algorithm bytes, returns their number
+    size_t final(byte_span);
+};
+
+// EncodedMessage fields, hash and data point into the buffer the message was parsed from
+struct encoded_view {
+    uint64_t data_size = 0;
+    StorageCloud::HashAlgorithm hash_algorithm = StorageCloud::HashAlgorithm::NULL2;
+    const uint8_t* hash = nullptr;
+    uint32_t hash_len = 0;
+    StorageCloud::MessageType type = StorageCloud::MessageType::NULL3;
+    const uint8_t* data = nullptr;
+    uint32_t data_len = 0;
+};
+
+bool parseEncodedMessage(const uint8_t*, int, encoded_view&);
+size_t encodedMessageSize(const encoded_view&);
+// serializes like EncodedMessage::SerializeToArray, returns pointer past the last written byte
+// null data only reserves data_len bytes at the end, to be filled in place by the caller
+uint8_t* writeEncodedMessage(const encoded_view&, uint8_t*);
+
+// digest needs HASH_SIZE of the algorithm bytes, returns number of bytes written
+size_t calculateHash(StorageCloud::HashAlgorithm, const_byte_span, byte_span);
+bool isHashSupported(StorageCloud::HashAlgorithm);
 bool compareHash(const uint8_t*, uint16_t, const uint8_t*, uint16_t);
 uint32_t parseSize(const uint8_t*);
+void writeRawHeader(uint8_t*, const raw_frame_header&);
+bool parseRawHeader(const uint8_t*, raw_frame_header&);
+void writeFrameHeader(uint8_t*, const frame_header&);
+bool parseFrameHeader(const uint8_t*, frame_header&);
+uint32_t crc32c(const uint8_t*, size_t, uint32_t = 0);
 std::string printHash(const uint8_t, const uint8_t*);
-void encrypt(StorageCloud::EncryptionAlgorithm, const uint8_t*, uint32_t, uint8_t**, uint32_t*);
-void decrypt(StorageCloud::EncryptionAlgorithm, const uint8_t*, uint32_t, uint8_t**, uint32_t*);
+// out has to be at least as big as in and may be the same buffer
+bool encrypt(StorageCloud::EncryptionAlgorithm, const_byte_span, byte_span);
+bool decrypt(StorageCloud::EncryptionAlgorithm, const_byte_span, byte_span);
 
 char getch();
 